@@ -0,0 +1,107 @@
+"""
+构建前把 esp/web/ 下的网页压缩为 gzip 并生成 src/web_assets.h
+
+PlatformIO 通过 extra_scripts 在每次编译前运行；也可以单独执行:
+    python3 esp/scripts/embed_web.py
+内容未变化时不重写头文件，避免触发不必要的重新编译。
+
+路径映射: index.html -> "/"，其余 name.html -> "/name"，其它文件 -> "/文件名"
+ETag 为压缩后内容的 SHA-1 前 16 位，页面更新后浏览器缓存自动失效。
+"""
+
+import gzip
+import hashlib
+import os
+
+try:
+    Import("env")  # noqa: F821  由 PlatformIO (SCons) 提供
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+WEB_DIR = os.path.join(PROJECT_DIR, "web")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "web_assets.h")
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+}
+
+
+def url_path(filename):
+    stem, ext = os.path.splitext(filename)
+    if filename == "index.html":
+        return "/"
+    if ext == ".html":
+        return "/" + stem
+    return "/" + filename
+
+
+def symbol(filename):
+    return "WEB_" + "".join(c.upper() if c.isalnum() else "_" for c in filename) + "_GZ"
+
+
+def generate():
+    files = sorted(f for f in os.listdir(WEB_DIR) if os.path.isfile(os.path.join(WEB_DIR, f)))
+    lines = [
+        "// 自动生成，请勿修改：由 esp/scripts/embed_web.py 从 esp/web/ 生成",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset {",
+        "  const char* path;         // URL 路径",
+        "  const char* contentType;",
+        "  const uint8_t* data;      // gzip 压缩后的内容",
+        "  size_t length;",
+        "  const char* etag;         // 带引号的 ETag",
+        "};",
+        "",
+    ]
+    entries = []
+    total_raw = 0
+    total_gz = 0
+    for filename in files:
+        with open(os.path.join(WEB_DIR, filename), "rb") as f:
+            raw = f.read()
+        # mtime 固定为 0，内容不变时输出不变
+        data = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha1(data).hexdigest()[:16]
+        name = symbol(filename)
+        content_type = CONTENT_TYPES.get(os.path.splitext(filename)[1], "application/octet-stream")
+        total_raw += len(raw)
+        total_gz += len(data)
+
+        lines.append("// %s: %d -> %d 字节" % (filename, len(raw), len(data)))
+        lines.append("static const uint8_t %s[] PROGMEM = {" % name)
+        for i in range(0, len(data), 16):
+            lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+        entries.append('  { "%s", "%s", %s, sizeof(%s), "\\"%s\\"" },' % (
+            url_path(filename), content_type, name, name, etag))
+
+    lines.append("static const WebAsset WEB_ASSETS[] = {")
+    lines.extend(entries)
+    lines.append("};")
+    lines.append("static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);")
+    lines.append("")
+    lines.append("#endif // WEB_ASSETS_H")
+    content = "\n".join(lines) + "\n"
+
+    old = None
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT, "r", encoding="utf-8") as f:
+            old = f.read()
+    if content != old:
+        with open(OUTPUT, "w", encoding="utf-8") as f:
+            f.write(content)
+    print("web_assets.h: %d 个文件，%d -> %d 字节" % (len(files), total_raw, total_gz))
+
+
+generate()
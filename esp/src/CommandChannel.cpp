@@ -0,0 +1,259 @@
+#include "CommandChannel.h"
+#include <ArduinoJson.h>
+
+CommandChannel::CommandChannel(HardwareSerial& serial, AsyncWebSocket& socket)
+  : m_serial(serial), m_socket(socket), m_lock(nullptr), m_nextSeq(1) {
+  memset(m_pending, 0, sizeof(m_pending));
+  memset(&m_stats, 0, sizeof(m_stats));
+}
+
+bool CommandChannel::begin() {
+  m_lock = xSemaphoreCreateMutex();
+  // 序号从随机值开始，ESP32 重启后不会与 Arduino 端缓存的最近序号重复
+  m_nextSeq = (uint16_t)(esp_random() & 0xFFFF);
+  if (m_nextSeq == 0) {
+    m_nextSeq = 1;
+  }
+  return m_lock != nullptr;
+}
+
+uint16_t CommandChannel::submit(const char* command, uint32_t clientId, uint32_t tag) {
+  if (m_lock == nullptr) {
+    return 0;
+  }
+  size_t len = strlen(command);
+  uint16_t seq = 0;
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  m_stats.submitted++;
+  if (len > 0 && len <= CMD_MAX_LENGTH && strchr(command, '\n') == nullptr && !m_sendQueue.isFull()) {
+    for (size_t i = 0; i < CMD_MAX_PENDING; i++) {
+      PendingCommand& pending = m_pending[i];
+      if (!pending.active) {
+        seq = m_nextSeq;
+        m_nextSeq = (m_nextSeq == 0xFFFF) ? 1 : m_nextSeq + 1;
+        pending.active = true;
+        pending.sent = false;
+        pending.seq = seq;
+        pending.retries = 0;
+        pending.clientId = clientId;
+        pending.tag = tag;
+        pending.submittedUs = micros();
+        memcpy(pending.text, command, len + 1);
+        SendItem item = { (uint8_t)i, 0 };
+        m_sendQueue.push(item);
+        break;
+      }
+    }
+  }
+  if (seq == 0) {
+    m_stats.rejected++;
+  }
+  xSemaphoreGive(m_lock);
+  return seq;
+}
+
+bool CommandChannel::submitRaw(const uint8_t* data, size_t len) {
+  if (m_lock == nullptr || len == 0 || len > 0xFFFF) {
+    return false;
+  }
+  bool queued = false;
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  if (!m_sendQueue.isFull() && m_raw.available() >= len) {
+    m_raw.push(data, len);
+    SendItem item = { RAW_ITEM, (uint16_t)len };
+    m_sendQueue.push(item);
+    queued = true;
+  }
+  xSemaphoreGive(m_lock);
+  return queued;
+}
+
+void CommandChannel::update() {
+  if (m_lock == nullptr) {
+    return;
+  }
+  PendingCommand failed[CMD_MAX_PENDING];
+  size_t failedCount = 0;
+  uint32_t now = millis();
+
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  // 新命令和原样文本按提交顺序发送
+  SendItem item;
+  while (m_sendQueue.pop(item)) {
+    if (item.slot == RAW_ITEM) {
+      uint8_t buf[64];
+      size_t remaining = item.rawLen;
+      while (remaining > 0) {
+        size_t count = m_raw.pop(buf, remaining < sizeof(buf) ? remaining : sizeof(buf));
+        m_serial.write(buf, count);
+        remaining -= count;
+      }
+    } else {
+      PendingCommand& pending = m_pending[item.slot];
+      pending.firstSentUs = micros();
+      transmit(pending);
+      pending.sent = true;
+    }
+  }
+
+  for (size_t i = 0; i < CMD_MAX_PENDING; i++) {
+    PendingCommand& pending = m_pending[i];
+    if (!pending.active || !pending.sent) {
+      continue;
+    }
+    if (now - pending.lastSentMs >= CMD_RETRY_TIMEOUT_MS) {
+      if (pending.retries < CMD_MAX_RETRIES) {
+        pending.retries++;
+        m_stats.retries++;
+        transmit(pending);
+      } else {
+        m_stats.timeouts++;
+        pending.active = false;
+        failed[failedCount++] = pending;
+      }
+    }
+  }
+  xSemaphoreGive(m_lock);
+
+  Result timeout = { false, "timeout", 0, -1, -1, (uint32_t)micros() };
+  for (size_t i = 0; i < failedCount; i++) {
+    reportResult(failed[i], timeout);
+  }
+}
+
+void CommandChannel::handleAck(const char* line) {
+  complete(line, true);
+}
+
+void CommandChannel::handleNak(const char* line) {
+  complete(line, false);
+}
+
+// 确认格式: $ACK:<序号>[,<接收us>,<执行us>] 或 $NAK:<序号>[,<原因>]
+void CommandChannel::complete(const char* line, bool ok) {
+  uint32_t ackUs = micros();
+  char* endptr;
+  unsigned long seq = strtoul(line, &endptr, 10);
+  if (endptr == line || seq == 0 || seq > 0xFFFF || m_lock == nullptr) {
+    return;
+  }
+  Result result = { ok, nullptr, 0, -1, -1, ackUs };
+  FixedString<24> reason;
+  if (!ok) {
+    reason = (*endptr == ',') ? endptr + 1 : "rejected";
+    result.reason = reason.c_str();
+  } else {
+    long recvUs, actUs;
+    if (sscanf(endptr, ",%ld,%ld", &recvUs, &actUs) == 2) {
+      result.megaRecvUs = recvUs;
+      result.megaActUs = actUs;
+    }
+  }
+
+  PendingCommand done;
+  bool found = false;
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  for (size_t i = 0; i < CMD_MAX_PENDING; i++) {
+    PendingCommand& pending = m_pending[i];
+    if (pending.active && pending.sent && pending.seq == (uint16_t)seq) {
+      uint32_t rttUs = ackUs - pending.firstSentUs;
+      result.rttUs = rttUs;
+      pending.active = false;
+      done = pending;
+      found = true;
+      if (ok) {
+        m_stats.acked++;
+      } else {
+        m_stats.nacked++;
+      }
+      m_stats.lastRttUs = rttUs;
+      if (m_stats.minRttUs == 0 || rttUs < m_stats.minRttUs) {
+        m_stats.minRttUs = rttUs;
+      }
+      if (rttUs > m_stats.maxRttUs) {
+        m_stats.maxRttUs = rttUs;
+      }
+      m_stats.totalRttUs += rttUs;
+      break;
+    }
+  }
+  xSemaphoreGive(m_lock);
+
+  // 重发后先后到达的重复确认直接忽略
+  if (found) {
+    reportResult(done, result);
+  }
+}
+
+// 发送一次命令（调用者持有锁）
+void CommandChannel::transmit(PendingCommand& command) {
+  FixedString<CMD_MAX_LENGTH + 8> line;
+  line.appendf("#%u:%s\n", (unsigned)command.seq, command.text);
+  m_serial.write((const uint8_t*)line.c_str(), line.length());
+  command.lastSentMs = millis();
+}
+
+void CommandChannel::reportResult(const PendingCommand& command, const Result& result) {
+  uint32_t queueUs = command.sent ? command.firstSentUs - command.submittedUs : 0;
+  if (result.ok) {
+    Serial.printf("命令 #%u [%s] ACK，往返 %.2f ms（排队 %u us，Arduino 接收 %d us / 执行 %d us），重发 %u 次\n",
+                  command.seq, command.text, result.rttUs / 1000.0f, (unsigned)queueUs,
+                  (int)result.megaRecvUs, (int)result.megaActUs, command.retries);
+  } else {
+    Serial.printf("命令 #%u [%s] 失败: %s，重发 %u 次\n", command.seq, command.text, result.reason,
+                  command.retries);
+  }
+
+  if (command.clientId == 0) {
+    return;
+  }
+  JsonDocument doc;
+  doc["type"] = "ack";
+  doc["id"] = command.tag;
+  doc["seq"] = command.seq;
+  doc["ok"] = result.ok;
+  if (result.ok) {
+    doc["rtt"] = result.rttUs;
+    doc["queueUs"] = queueUs;
+    if (result.megaRecvUs >= 0) {
+      doc["megaRecvUs"] = result.megaRecvUs;
+      doc["megaActUs"] = result.megaActUs;
+    }
+  } else {
+    doc["reason"] = result.reason;
+  }
+  doc["retries"] = command.retries;
+  char json[192];
+  // 回复耗时包含 JSON 格式化，在发送前最后一刻计算
+  doc["replyUs"] = micros() - result.ackUs;
+  size_t len = serializeJson(doc, json, sizeof(json));
+  AsyncWebSocketClient* client = m_socket.client(command.clientId);
+  if (len > 0 && client != nullptr && client->canSend()) {
+    client->text(json, len);
+  }
+}
+
+void CommandChannel::formatStatus(FixedString<256>& out) {
+  out.clear();
+  if (m_lock == nullptr) {
+    out = "{}";
+    return;
+  }
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  uint32_t completed = m_stats.acked + m_stats.nacked;
+  size_t pending = 0;
+  for (size_t i = 0; i < CMD_MAX_PENDING; i++) {
+    if (m_pending[i].active) {
+      pending++;
+    }
+  }
+  out.appendf("{\"submitted\":%u,\"acked\":%u,\"nacked\":%u,\"timeouts\":%u,\"retries\":%u,"
+              "\"rejected\":%u,\"pending\":%u,\"rttLastUs\":%u,\"rttMinUs\":%u,\"rttMaxUs\":%u,"
+              "\"rttAvgUs\":%u}",
+              (unsigned)m_stats.submitted, (unsigned)m_stats.acked, (unsigned)m_stats.nacked,
+              (unsigned)m_stats.timeouts, (unsigned)m_stats.retries, (unsigned)m_stats.rejected,
+              (unsigned)pending, (unsigned)m_stats.lastRttUs, (unsigned)m_stats.minRttUs,
+              (unsigned)m_stats.maxRttUs,
+              completed > 0 ? (unsigned)(m_stats.totalRttUs / completed) : 0u);
+  xSemaphoreGive(m_lock);
+}
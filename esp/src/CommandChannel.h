@@ -0,0 +1,118 @@
+#ifndef COMMAND_CHANNEL_H
+#define COMMAND_CHANNEL_H
+
+#include <Arduino.h>
+#include <AsyncWebSocket.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "FixedString.h"
+#include "RingBuffer.h"
+
+// --- 可靠命令配置 ---
+#define CMD_MAX_PENDING      8    // 同时等待确认的命令数
+#define CMD_MAX_LENGTH       56   // 命令文本最大长度（加上 "#序号:" 不超过 Arduino 端行缓冲 64）
+#define CMD_RETRY_TIMEOUT_MS 100  // 多久未收到确认即重发
+#define CMD_MAX_RETRIES      4    // 最多重发次数，之后报告超时
+#define CMD_RAW_BUFFER_SIZE  1024 // 原样转发文本的缓冲区（2 的幂）
+#define CMD_SEND_QUEUE_SIZE  32   // 等待首次发送的条目数（2 的幂）
+
+/**
+ * 发往 Arduino 的可靠命令通道
+ *
+ * 每条命令分配一个序号，以 "#<序号>:<命令>" 发送；Arduino 执行后回复
+ * "$ACK:<序号>,<接收us>,<执行us>" 或 "$NAK:<序号>,<原因>"（见 src/Utils/SerialCommandParser.h）。
+ * 超时未确认时用同一序号重发，Arduino 端按序号去重，命令不会重复执行。
+ * 收到确认后记录往返延时（从第一次发送算起），并把结果回复给提交命令的 WebSocket 客户端：
+ *   {"type":"ack","id":<客户端编号>,"seq":<序号>,"ok":true,"rtt":<微秒>,"retries":<重发次数>,
+ *    "queueUs":..,"megaRecvUs":..,"megaActUs":..,"replyUs":..}
+ * 各段耗时（微秒）：queueUs 为 ESP32 收到命令到写入串口，rtt 为写入串口到收到确认，
+ * 其中 megaRecvUs/megaActUs 为 Arduino 报告的接收和执行耗时，replyUs 为收到确认到发出回复。
+ *
+ * 浏览器串口终端的原样文本也经 submitRaw() 进入同一发送队列（不带序号、不确认），
+ * 新命令和原样文本按提交顺序发出，Arduino 收到的顺序与浏览器发送的顺序一致。
+ *
+ * submit()/submitRaw() 在 async_tcp 任务中调用，update() 在 loop() 中发送和重发，
+ * 确认由串口接收任务经 LineRouter 交给 handleAck()/handleNak()，用互斥锁保护。
+ */
+class CommandChannel {
+public:
+  CommandChannel(HardwareSerial& serial, AsyncWebSocket& socket);
+
+  bool begin();
+
+  // 提交命令，返回分配的序号；队列已满或命令过长时返回 0
+  // clientId 为 0 表示本地提交（如 /setcolor），结果只打印到 USB 串口
+  uint16_t submit(const char* command, uint32_t clientId, uint32_t tag);
+
+  // 提交原样转发的文本，与可靠命令按提交顺序发送；缓冲区放不下时整段丢弃并返回 false
+  bool submitRaw(const uint8_t* data, size_t len);
+
+  // 在 loop() 中调用：发送新命令、重发超时的命令
+  void update();
+
+  // Arduino 的确认（前缀之后的内容）
+  void handleAck(const char* line);
+  void handleNak(const char* line);
+
+  // 统计信息（JSON）
+  void formatStatus(FixedString<256>& out);
+
+private:
+  struct PendingCommand {
+    bool active;
+    bool sent;                   // 已发送过至少一次
+    uint16_t seq;
+    uint8_t retries;
+    uint32_t clientId;
+    uint32_t tag;                // 客户端自定义编号，原样带回
+    uint32_t submittedUs;
+    uint32_t firstSentUs;
+    uint32_t lastSentMs;
+    char text[CMD_MAX_LENGTH + 1];
+  };
+
+  struct Stats {
+    uint32_t submitted;
+    uint32_t acked;
+    uint32_t nacked;
+    uint32_t timeouts;
+    uint32_t retries;
+    uint32_t rejected;           // 队列满或命令过长
+    uint32_t lastRttUs;
+    uint32_t minRttUs;
+    uint32_t maxRttUs;
+    uint64_t totalRttUs;
+  };
+
+  // 等待首次发送的条目：可靠命令为槽位下标，原样文本为 RAW_ITEM 及其长度
+  struct SendItem {
+    uint8_t slot;
+    uint16_t rawLen;
+  };
+  static const uint8_t RAW_ITEM = 0xFF;
+
+  HardwareSerial& m_serial;
+  AsyncWebSocket& m_socket;
+  SemaphoreHandle_t m_lock;
+  PendingCommand m_pending[CMD_MAX_PENDING];
+  RingBuffer<SendItem, CMD_SEND_QUEUE_SIZE> m_sendQueue;
+  RingBuffer<uint8_t, CMD_RAW_BUFFER_SIZE> m_raw;
+  uint16_t m_nextSeq;
+  Stats m_stats;
+
+  // 一条命令的结果及各段耗时
+  struct Result {
+    bool ok;
+    const char* reason;
+    uint32_t rttUs;
+    int32_t megaRecvUs;          // Arduino 未报告时为 -1（例如重复命令的缓存回复）
+    int32_t megaActUs;
+    uint32_t ackUs;              // 收到确认的时间
+  };
+
+  void complete(const char* line, bool ok);
+  void transmit(PendingCommand& command);
+  void reportResult(const PendingCommand& command, const Result& result);
+};
+
+#endif // COMMAND_CHANNEL_H
@@ -0,0 +1,219 @@
+#include "FlightRecorder.h"
+#include <LittleFS.h>
+
+// Arduino 端 Logger 的错误日志标记：标准格式与带前缀格式
+static const char* const ERROR_PATTERNS[2] = { "[ERROR]", "$LOG:ERROR" };
+
+FlightRecorder::FlightRecorder()
+  : m_start(0), m_end(0), m_lock(nullptr), m_frozen(false), m_savePending(false),
+    m_fsReady(false), m_postTrigger(-1), m_ignoredBytes(0) {
+  m_matchIndex[0] = 0;
+  m_matchIndex[1] = 0;
+}
+
+bool FlightRecorder::begin() {
+  m_lock = xSemaphoreCreateMutex();
+#if FLIGHT_SAVE_TO_LITTLEFS
+  // 首次使用时自动格式化分区
+  m_fsReady = LittleFS.begin(true);
+  if (!m_fsReady) {
+    Serial.println("LittleFS 挂载失败，黑匣子只保存在 RAM 中");
+  }
+#endif
+  return m_lock != nullptr;
+}
+
+void FlightRecorder::capture(const uint8_t* data, size_t len) {
+  if (data == nullptr || len == 0 || m_lock == nullptr) {
+    return;
+  }
+  uint32_t now = millis();
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  if (m_frozen) {
+    m_ignoredBytes += len;
+    xSemaphoreGive(m_lock);
+    return;
+  }
+
+  append(now, (uint16_t)min(len, (size_t)(ANNOTATION_FLAG - 1)), data, len);
+
+  bool errorSeen = scanForError(data, len);
+  if (m_postTrigger >= 0) {
+    // 已触发：记录完错误之后的一段数据再冻结
+    m_postTrigger -= (int32_t)len;
+    if (m_postTrigger <= 0) {
+      m_frozen = true;
+      m_savePending = true;
+    }
+  } else if (errorSeen) {
+    m_reason = "Arduino 报告错误";
+    m_postTrigger = FLIGHT_POST_TRIGGER_BYTES;
+    static const char NOTE[] = "触发: Arduino 报告错误";
+    append(now, ANNOTATION_FLAG | (sizeof(NOTE) - 1), (const uint8_t*)NOTE, sizeof(NOTE) - 1);
+  }
+  xSemaphoreGive(m_lock);
+}
+
+void FlightRecorder::update() {
+  if (m_lock == nullptr) {
+    return;
+  }
+  // 标志和冻结内容由 uartRxTask 在锁内写入，取出副本后再打印和保存
+  FixedString<64> reason;
+  uint32_t start, end;
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  bool pending = m_savePending;
+  m_savePending = false;
+  if (pending) {
+    reason = m_reason.c_str();
+    start = m_start;
+    end = m_end;
+  }
+  xSemaphoreGive(m_lock);
+  if (!pending) {
+    return;
+  }
+
+  Serial.printf("黑匣子已冻结 (%s)，%u 字节\n", reason.c_str(), (unsigned)(end - start));
+#if FLIGHT_SAVE_TO_LITTLEFS
+  if (m_fsReady) {
+    saveToFile(start, end);
+  }
+#endif
+}
+
+void FlightRecorder::freeze(const char* reason) {
+  if (m_lock == nullptr) {
+    return;
+  }
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  if (!m_frozen) {
+    m_reason = reason;
+    size_t len = m_reason.length();
+    append(millis(), ANNOTATION_FLAG | (uint16_t)len, (const uint8_t*)m_reason.c_str(), len);
+    m_frozen = true;
+    m_savePending = true;
+  }
+  xSemaphoreGive(m_lock);
+}
+
+void FlightRecorder::resume() {
+  if (m_lock == nullptr) {
+    return;
+  }
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  m_frozen = false;
+  m_postTrigger = -1;
+  m_reason.clear();
+  xSemaphoreGive(m_lock);
+}
+
+void FlightRecorder::clear() {
+  if (m_lock == nullptr) {
+    return;
+  }
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  // 绝对偏移继续递增，正在进行的增量下载不会读到旧数据
+  m_start = m_end;
+  m_ignoredBytes = 0;
+  xSemaphoreGive(m_lock);
+}
+
+size_t FlightRecorder::read(uint32_t offset, uint8_t* out, size_t maxLen) {
+  if (m_lock == nullptr) {
+    return 0;
+  }
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  size_t count = 0;
+  if (offset - m_start < m_end - m_start) {
+    count = min(maxLen, (size_t)(m_end - offset));
+    for (size_t i = 0; i < count; i++) {
+      out[i] = getByte(offset + i);
+    }
+  }
+  xSemaphoreGive(m_lock);
+  return count;
+}
+
+void FlightRecorder::formatStatus(FixedString<256>& out) {
+  out.clear();
+  if (m_lock == nullptr) {
+    out = "{}";
+    return;
+  }
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  out.appendf("{\"frozen\":%s,\"triggered\":%s,\"reason\":\"%s\",\"start\":%u,\"end\":%u,"
+              "\"bytes\":%u,\"capacity\":%u,\"ignored\":%u,",
+              m_frozen ? "true" : "false", m_postTrigger >= 0 ? "true" : "false",
+              m_reason.c_str(), (unsigned)m_start, (unsigned)m_end, (unsigned)(m_end - m_start),
+              (unsigned)FLIGHT_RECORDER_BYTES, (unsigned)m_ignoredBytes);
+  xSemaphoreGive(m_lock);
+  out.appendf("\"saved\":%s}", hasSavedFile() ? "true" : "false");
+}
+
+bool FlightRecorder::hasSavedFile() const {
+  return m_fsReady && LittleFS.exists(FLIGHT_SAVED_PATH);
+}
+
+// 写入一块（调用者持有锁），放不下时先丢弃最早的块
+void FlightRecorder::append(uint32_t timestamp, uint16_t lengthField, const uint8_t* data, size_t len) {
+  len = min(len, (size_t)(FLIGHT_RECORDER_BYTES - HEADER_SIZE));
+  lengthField = (lengthField & ANNOTATION_FLAG) | (uint16_t)len;
+  evict(HEADER_SIZE + len);
+
+  putByte(m_end++, (uint8_t)(timestamp & 0xFF));
+  putByte(m_end++, (uint8_t)((timestamp >> 8) & 0xFF));
+  putByte(m_end++, (uint8_t)((timestamp >> 16) & 0xFF));
+  putByte(m_end++, (uint8_t)(timestamp >> 24));
+  putByte(m_end++, (uint8_t)(lengthField & 0xFF));
+  putByte(m_end++, (uint8_t)(lengthField >> 8));
+  for (size_t i = 0; i < len; i++) {
+    putByte(m_end++, data[i]);
+  }
+}
+
+void FlightRecorder::evict(size_t needed) {
+  while (m_end - m_start + needed > FLIGHT_RECORDER_BYTES) {
+    uint16_t lengthField = (uint16_t)getByte(m_start + 4) | ((uint16_t)getByte(m_start + 5) << 8);
+    m_start += HEADER_SIZE + (lengthField & ~ANNOTATION_FLAG);
+  }
+}
+
+// 在数据流中查找错误日志标记，模式可能跨越两次接收
+bool FlightRecorder::scanForError(const uint8_t* data, size_t len) {
+  bool found = false;
+  for (size_t i = 0; i < len; i++) {
+    for (uint8_t p = 0; p < 2; p++) {
+      const char* pattern = ERROR_PATTERNS[p];
+      uint8_t& index = m_matchIndex[p];
+      if (data[i] == (uint8_t)pattern[index]) {
+        index++;
+        if (pattern[index] == '\0') {
+          found = true;
+          index = 0;
+        }
+      } else {
+        index = (data[i] == (uint8_t)pattern[0]) ? 1 : 0;
+      }
+    }
+  }
+  return found;
+}
+
+// 保存冻结时的 [start, end) 范围；read() 自行加锁，期间被 clear() 清除的部分不再写入
+void FlightRecorder::saveToFile(uint32_t start, uint32_t end) {
+  File file = LittleFS.open(FLIGHT_SAVED_PATH, "w");
+  if (!file) {
+    Serial.println("无法写入黑匣子文件");
+    return;
+  }
+  uint8_t buf[256];
+  uint32_t offset = start;
+  size_t n;
+  while (offset != end && (n = read(offset, buf, min(sizeof(buf), (size_t)(end - offset)))) > 0) {
+    file.write(buf, n);
+    offset += n;
+  }
+  file.close();
+  Serial.printf("黑匣子已保存到 LittleFS %s (%u 字节)\n", FLIGHT_SAVED_PATH, (unsigned)(offset - start));
+}
@@ -0,0 +1,85 @@
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "FixedString.h"
+
+// --- 黑匣子配置 ---
+#define FLIGHT_RECORDER_BYTES      32768  // 环形缓冲区大小（2的幂）
+#define FLIGHT_POST_TRIGGER_BYTES  2048   // 检测到错误后继续记录的字节数，然后冻结
+#define FLIGHT_SAVE_TO_LITTLEFS    1      // 1: 冻结后把缓冲区保存到 LittleFS，断电后仍可下载
+#define FLIGHT_SAVED_PATH          "/flight.bin"
+
+/**
+ * 黑匣子：记录 Arduino 发来的原始串口数据及接收时间
+ *
+ * 数据按块存入 RAM 环形缓冲区，满时丢弃最早的块。每块格式（小端）：
+ *   时间戳 ms (4) | 长度 (2) | 数据
+ * 长度最高位为 1 时是标注块（如冻结原因），内容为文本。
+ * 可用 tools/flight_dump.py 解码。
+ *
+ * 位置使用自启动以来的绝对字节偏移，HTTP 下载可以从上次结束处继续。
+ * capture() 在 loop() 中调用，读取在 async_tcp 任务中进行，用互斥锁保护。
+ */
+class FlightRecorder {
+public:
+  static const uint16_t ANNOTATION_FLAG = 0x8000;
+  static const size_t HEADER_SIZE = 6;
+
+  FlightRecorder();
+
+  // 创建锁并挂载 LittleFS
+  bool begin();
+
+  // 记录一块接收数据（冻结后忽略）
+  void capture(const uint8_t* data, size_t len);
+
+  // 在 loop() 中调用：冻结后保存到 LittleFS
+  void update();
+
+  // 立即冻结 / 恢复记录 / 清空
+  void freeze(const char* reason);
+  void resume();
+  void clear();
+
+  bool isFrozen() const { return m_frozen; }
+
+  // 当前缓冲区中最早和结束的绝对偏移
+  uint32_t getStart() const { return m_start; }
+  uint32_t getEnd() const { return m_end; }
+
+  // 从绝对偏移 offset 读取最多 maxLen 字节；数据已被覆盖或超出末尾时返回 0
+  size_t read(uint32_t offset, uint8_t* out, size_t maxLen);
+
+  // 状态 JSON
+  void formatStatus(FixedString<256>& out);
+
+  bool hasSavedFile() const;
+
+private:
+  uint8_t m_data[FLIGHT_RECORDER_BYTES];
+  uint32_t m_start;           // 最早一块的绝对偏移
+  uint32_t m_end;             // 写入位置的绝对偏移
+  SemaphoreHandle_t m_lock;
+
+  bool m_frozen;
+  bool m_savePending;
+  bool m_fsReady;
+  int32_t m_postTrigger;      // 触发后剩余的记录字节数，<0 表示未触发
+  uint32_t m_ignoredBytes;    // 冻结期间未记录的字节数
+  FixedString<64> m_reason;
+
+  // 错误日志匹配（跨块）
+  uint8_t m_matchIndex[2];
+
+  void append(uint32_t timestamp, uint16_t lengthField, const uint8_t* data, size_t len);
+  void evict(size_t needed);
+  void putByte(uint32_t pos, uint8_t value) { m_data[pos & (FLIGHT_RECORDER_BYTES - 1)] = value; }
+  uint8_t getByte(uint32_t pos) const { return m_data[pos & (FLIGHT_RECORDER_BYTES - 1)]; }
+  bool scanForError(const uint8_t* data, size_t len);
+  void saveToFile(uint32_t start, uint32_t end);
+};
+
+#endif // FLIGHT_RECORDER_H
@@ -0,0 +1,79 @@
+#include "LineRouter.h"
+
+LineRouter::LineRouter()
+  : m_routeCount(0), m_atLineStart(true), m_heldLen(0), m_activeRoute(-1), m_overflows(0) {
+}
+
+bool LineRouter::addRoute(const char* prefix, Handler handler, void* context) {
+  size_t len = strlen(prefix);
+  if (m_routeCount >= MAX_ROUTES || prefix[0] != '$' || len > MAX_PREFIX_LEN || handler == nullptr) {
+    return false;
+  }
+  Route& route = m_routes[m_routeCount++];
+  route.prefix = prefix;
+  route.prefixLen = (uint8_t)len;
+  route.handler = handler;
+  route.context = context;
+  return true;
+}
+
+size_t LineRouter::filter(const uint8_t* data, size_t len, uint8_t* out) {
+  size_t outLen = 0;
+  for (size_t i = 0; i < len; i++) {
+    uint8_t b = data[i];
+    if (m_activeRoute >= 0) {
+      if (b == '\n') {
+        const Route& route = m_routes[m_activeRoute];
+        if (m_line.truncated()) {
+          m_overflows++;
+        } else {
+          route.handler(m_line.c_str(), route.context);
+        }
+        m_activeRoute = -1;
+        m_atLineStart = true;
+      } else if (b != '\r') {
+        m_line.append((char)b);
+      }
+      continue;
+    }
+
+    // 行首的 '$' 可能是某个前缀，确定之前先不输出
+    if (m_heldLen > 0 || (m_atLineStart && b == '$')) {
+      m_held[m_heldLen++] = (char)b;
+      int8_t match = matchHeld();
+      if (match >= 0) {
+        m_activeRoute = match;
+        m_heldLen = 0;
+        m_line.clear();
+        continue;
+      }
+      if (match == -2) {
+        continue;
+      }
+      // 不是结构化消息（例如 $LOG:），连同本字节原样输出
+      memcpy(out + outLen, m_held, m_heldLen);
+      outLen += m_heldLen;
+      m_heldLen = 0;
+      m_atLineStart = (b == '\n');
+      continue;
+    }
+
+    out[outLen++] = b;
+    m_atLineStart = (b == '\n');
+  }
+  return outLen;
+}
+
+int8_t LineRouter::matchHeld() const {
+  bool partial = false;
+  for (uint8_t r = 0; r < m_routeCount; r++) {
+    const Route& route = m_routes[r];
+    if (m_heldLen <= route.prefixLen && memcmp(route.prefix, m_held, m_heldLen) == 0) {
+      if (m_heldLen == route.prefixLen) {
+        return (int8_t)r;
+      }
+      partial = true;
+    }
+  }
+  return partial ? -2 : -1;
+}
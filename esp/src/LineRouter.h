@@ -0,0 +1,56 @@
+#ifndef LINE_ROUTER_H
+#define LINE_ROUTER_H
+
+#include <Arduino.h>
+#include "FixedString.h"
+
+/**
+ * 按行首前缀从 Arduino 串口数据中取出结构化消息
+ *
+ * 以已注册前缀（如 "$TEL:"、"$ACK:"）开头的整行交给对应的处理函数，
+ * 不再作为日志文本转发；其余字节原样输出。前缀可能跨越两次接收，
+ * 尚未确定的行首字节会暂存到下一次 filter()。只在串口接收任务中调用。
+ */
+class LineRouter {
+public:
+  static const uint8_t MAX_ROUTES = 4;
+  static const uint8_t MAX_PREFIX_LEN = 8;
+
+  // 处理函数：line 为前缀之后、换行之前的内容
+  typedef void (*Handler)(const char* line, void* context);
+
+  LineRouter();
+
+  // 注册前缀（必须以 '$' 开头，不超过 MAX_PREFIX_LEN）
+  bool addRoute(const char* prefix, Handler handler, void* context);
+
+  // 取出 data 中的结构化消息，其余字节写入 out 并返回字节数
+  // out 至少需要 len + MAX_PREFIX_LEN 字节（上次暂存的行首字节会一并写出）
+  size_t filter(const uint8_t* data, size_t len, uint8_t* out);
+
+  // 因过长被丢弃的消息数
+  uint32_t getOverflowCount() const { return m_overflows; }
+
+private:
+  struct Route {
+    const char* prefix;
+    uint8_t prefixLen;
+    Handler handler;
+    void* context;
+  };
+
+  Route m_routes[MAX_ROUTES];
+  uint8_t m_routeCount;
+
+  bool m_atLineStart;
+  char m_held[MAX_PREFIX_LEN];    // 行首暂存的字节
+  uint8_t m_heldLen;
+  int8_t m_activeRoute;           // 正在接收的消息所属的路由，-1 表示无
+  FixedString<128> m_line;
+  uint32_t m_overflows;
+
+  // 暂存字节与某个前缀完全匹配时返回其下标；-2 表示仍可能匹配，-1 表示都不匹配
+  int8_t matchHeld() const;
+};
+
+#endif // LINE_ROUTER_H
@@ -0,0 +1,161 @@
+#include "Telemetry.h"
+#include <ArduinoJson.h>
+
+Telemetry::Telemetry(AsyncWebSocket& socket)
+  : m_socket(socket), m_lock(nullptr), m_jsonLen(0), m_seq(0), m_parseErrors(0) {
+  memset(m_clients, 0, sizeof(m_clients));
+  m_json[0] = '\0';
+}
+
+bool Telemetry::begin() {
+  m_lock = xSemaphoreCreateMutex();
+  return m_lock != nullptr;
+}
+
+// 解析一行遥测并转为 JSON，发给正在等待的客户端
+void Telemetry::handleLine(const char* line) {
+  unsigned long timeMs;
+  unsigned state, navState, irMask, loopHz;
+  int distanceMm, error, integral, derivative, turn;
+  if (sscanf(line, "%lu,%u,%u,%u,%d,%d,%d,%d,%d,%u", &timeMs, &state, &navState,
+             &irMask, &distanceMm, &error, &integral, &derivative, &turn, &loopHz) != 10) {
+    m_parseErrors++;
+    return;
+  }
+
+  JsonDocument doc;
+  doc["seq"] = m_seq + 1;
+  doc["t"] = timeMs;
+  doc["state"] = state;
+  doc["nav"] = navState;
+  doc["ir"] = irMask;
+  doc["dist"] = distanceMm;
+  doc["err"] = error;
+  doc["i"] = integral;
+  doc["d"] = derivative;
+  doc["turn"] = turn;
+  doc["hz"] = loopHz;
+
+  char json[sizeof(m_json)];
+  size_t len = serializeJson(doc, json, sizeof(json));
+  if (len == 0 || m_lock == nullptr) {
+    m_parseErrors++;
+    return;
+  }
+
+  // 记录需要推送的客户端，发送在锁外进行
+  uint32_t targets[TELEMETRY_MAX_CLIENTS];
+  size_t targetCount = 0;
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  memcpy(m_json, json, len + 1);
+  m_jsonLen = len;
+  m_seq++;
+  for (size_t i = 0; i < TELEMETRY_MAX_CLIENTS; i++) {
+    ClientSlot& slot = m_clients[i];
+    if (slot.id != 0 && slot.waiting) {
+      slot.waiting = false;
+      slot.lastSeq = m_seq;
+      targets[targetCount++] = slot.id;
+    }
+  }
+  xSemaphoreGive(m_lock);
+
+  for (size_t i = 0; i < targetCount; i++) {
+    if (!sendTo(targets[i], json, len)) {
+      markWaiting(targets[i]);
+    }
+  }
+}
+
+// 客户端请求下一帧：有未发送过的数据立即回复，否则标记为等待
+void Telemetry::handleRequest(uint32_t clientId) {
+  char json[sizeof(m_json)];
+  size_t len = 0;
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  ClientSlot* slot = findSlot(clientId);
+  if (slot != nullptr) {
+    if (m_seq != slot->lastSeq && m_jsonLen > 0) {
+      memcpy(json, m_json, m_jsonLen + 1);
+      len = m_jsonLen;
+      slot->lastSeq = m_seq;
+      slot->waiting = false;
+    } else {
+      slot->waiting = true;
+    }
+  }
+  xSemaphoreGive(m_lock);
+
+  if (len > 0 && !sendTo(clientId, json, len)) {
+    markWaiting(clientId);
+  }
+}
+
+void Telemetry::onEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len) {
+  if (m_lock == nullptr) {
+    return;
+  }
+  switch (type) {
+    case WS_EVT_CONNECT: {
+      xSemaphoreTake(m_lock, portMAX_DELAY);
+      ClientSlot* slot = findSlot(0);
+      if (slot != nullptr) {
+        slot->id = client->id();
+        slot->lastSeq = 0;
+        slot->waiting = false;
+      }
+      xSemaphoreGive(m_lock);
+      if (slot == nullptr) {
+        Serial.printf("遥测客户端已满，关闭 #%u\n", client->id());
+        client->close();
+      }
+      }
+      break;
+    case WS_EVT_DISCONNECT: {
+      xSemaphoreTake(m_lock, portMAX_DELAY);
+      ClientSlot* slot = findSlot(client->id());
+      if (slot != nullptr) {
+        slot->id = 0;
+      }
+      xSemaphoreGive(m_lock);
+      }
+      break;
+    case WS_EVT_DATA:
+      // 任意一条消息都表示页面已准备好接收下一帧
+      handleRequest(client->id());
+      break;
+    default:
+      break;
+  }
+  (void)arg;
+  (void)data;
+  (void)len;
+}
+
+// 查找客户端对应的槽位（调用者持有锁），clientId 为 0 时查找空闲槽位
+Telemetry::ClientSlot* Telemetry::findSlot(uint32_t clientId) {
+  for (size_t i = 0; i < TELEMETRY_MAX_CLIENTS; i++) {
+    if (m_clients[i].id == clientId) {
+      return &m_clients[i];
+    }
+  }
+  return nullptr;
+}
+
+// 发送队列已满时返回 false，由调用者改为等待下一帧，页面不会因一次丢帧而停止请求
+bool Telemetry::sendTo(uint32_t clientId, const char* json, size_t len) {
+  AsyncWebSocketClient* client = m_socket.client(clientId);
+  if (client == nullptr || !client->canSend()) {
+    return false;
+  }
+  client->text(json, len);
+  return true;
+}
+
+void Telemetry::markWaiting(uint32_t clientId) {
+  xSemaphoreTake(m_lock, portMAX_DELAY);
+  ClientSlot* slot = findSlot(clientId);
+  if (slot != nullptr) {
+    slot->waiting = true;
+  }
+  xSemaphoreGive(m_lock);
+}
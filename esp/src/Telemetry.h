@@ -0,0 +1,61 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include <AsyncWebSocket.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// --- 遥测配置 ---
+#define TELEMETRY_MAX_CLIENTS 4    // 同时打开遥测页面的浏览器数
+#define TELEMETRY_PREFIX      "$TEL:"
+
+/**
+ * 实时遥测：解析 Arduino 发来的 $TEL 行，推送给遥测页面
+ *
+ * Arduino 每隔固定时间输出一行（格式见 src/Control/TelemetryReporter.h），
+ * 由 LineRouter 从串口数据中取出交给 handleLine()，不再作为日志转发到 /ws。
+ * 最新一帧转为紧凑 JSON 保存；页面每画完一帧（requestAnimationFrame）发一条请求，
+ * 有新数据时立即回复，否则等下一帧到达再发，发送速率不超过浏览器的刷新率。
+ *
+ * handleLine() 在串口接收任务中调用，请求在 async_tcp 任务中处理，用互斥锁保护。
+ */
+class Telemetry {
+public:
+  explicit Telemetry(AsyncWebSocket& socket);
+
+  bool begin();
+
+  // 解析一行遥测（前缀之后的内容）并推送给等待中的客户端
+  void handleLine(const char* line);
+
+  // 遥测 WebSocket 事件
+  void onEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len);
+
+  uint32_t getFrameCount() const { return m_seq; }
+  uint32_t getParseErrors() const { return m_parseErrors; }
+
+private:
+  struct ClientSlot {
+    uint32_t id;        // 0 表示空闲
+    uint32_t lastSeq;   // 已发给该客户端的最新帧序号
+    bool waiting;       // 已请求但还没有新数据
+  };
+
+  AsyncWebSocket& m_socket;
+  SemaphoreHandle_t m_lock;
+  ClientSlot m_clients[TELEMETRY_MAX_CLIENTS];
+
+  // 最新一帧（JSON）及序号
+  char m_json[192];
+  size_t m_jsonLen;
+  uint32_t m_seq;
+  uint32_t m_parseErrors;
+
+  void handleRequest(uint32_t clientId);
+  ClientSlot* findSlot(uint32_t clientId);
+  bool sendTo(uint32_t clientId, const char* json, size_t len);
+  void markWaiting(uint32_t clientId);
+};
+
+#endif // TELEMETRY_H
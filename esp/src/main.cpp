@@ -2,6 +2,14 @@
 #include <ESPAsyncWebServer.h>
 #include <HardwareSerial.h>
 #include <AsyncWebSocket.h>
+#include "FixedString.h"
+#include "FlightRecorder.h"
+#include "Telemetry.h"
+#include "CommandChannel.h"
+#include "LineRouter.h"
+#include <ArduinoJson.h>
+#include "web_assets.h"
+#include <LittleFS.h>
 
 // --- WiFi 配置 ---
 const char* WIFI_SSID = "S23";
@@ -12,258 +20,274 @@ const char* WIFI_PASS = "12345678";
 #define ARDUINO_RX_PIN 1      // ESP32 RX GPIO1 连接 Arduino TX2 (Pin 16 on Mega) - 确认接线!
 #define ARDUINO_TX_PIN 0      // ESP32 TX GPIO0 连接 Arduino RX2 (Pin 17 on Mega) - 确认接线!
 #define ARDUINO_BAUD_RATE 115200
+#define ARDUINO_RX_BUFFER_SIZE 16384  // UART 驱动 RX 环形缓冲区，115200 波特率(约 11.5KB/s)下约可容纳 1.4s 的数据
+#define UART_RX_TASK_STACK     4096
+#define UART_RX_TASK_PRIORITY  5      // 高于 loop() (1)，低于 WiFi 任务
+
+// --- Arduino -> WebSocket 转发配置 ---
+// 串口数据先攒在缓冲区中，满足任一条件时作为一帧发送，减少小帧开销
+#define WS_FORWARD_MAX_BYTES    1024 // 攒够这么多字节立即发送
+#define WS_FORWARD_MAX_DELAY_MS 20   // 最早的字节等待超过这么久即发送
+#define DEBUG_ECHO_UART         0    // 1: 把 Arduino 数据逐字节回显到 USB 串口（仅调试用，很慢）
 
 // --- 全局对象 ---
 HardwareSerial ArduinoSerial(ARDUINO_SERIAL_PORT);
 AsyncWebServer server(80);
 AsyncWebSocket ws("/ws"); // WebSocket服务器实例，监听 /ws 路径
+AsyncWebSocket telemetryWs("/telemetry/ws"); // 遥测页面的数据通道
+
+// 黑匣子：保存 Arduino 发来的原始数据，无浏览器连接时也不丢失
+FlightRecorder flightRecorder;
+
+// 实时遥测：从串口数据中取出 $TEL 行，按页面刷新率推送
+Telemetry telemetry(telemetryWs);
+
+// 可靠命令：带序号发送，等待 Arduino 确认，超时重发
+CommandChannel commandChannel(ArduinoSerial, ws);
+
+// 按行首前缀取出遥测和命令确认，其余作为日志转发
+LineRouter arduinoLines;
+
+// Arduino -> WebSocket 转发缓冲（只在 uartRxTask 中访问）
+// 末尾预留 LineRouter 可能补写的行首字节
+uint8_t wsForwardBuf[WS_FORWARD_MAX_BYTES + LineRouter::MAX_PREFIX_LEN];
+uint8_t uartRxBuf[256];
+size_t wsForwardLen = 0;
+unsigned long wsForwardFirstMs = 0; // 缓冲中最早字节的接收时间
+
+// 串口接收任务：由 onReceive 回调唤醒，负责写入黑匣子和转发
+TaskHandle_t uartRxTaskHandle = nullptr;
+
+// 串口接收统计（接收任务和驱动回调写入，HTTP 读取）
+struct UartStats {
+  volatile uint32_t rxBytes;         // 已读取的字节数
+  volatile uint32_t fifoOverflows;   // 硬件 FIFO 溢出次数（驱动来不及搬运）
+  volatile uint32_t bufferFull;      // RX 环形缓冲区满的次数（接收任务来不及读取）
+  volatile uint32_t lineErrors;      // 帧错误、校验错误、break
+  volatile uint32_t rxHighWater;     // RX 缓冲区最高占用字节数
+  volatile uint32_t wsFrames;        // 已发送的 WebSocket 帧数
+  volatile uint32_t wsDroppedBytes;  // 客户端发送队列满而丢弃的字节数
+};
+UartStats uartStats = {};
+
+// --- 网页资源 ---
+// esp/web/ 下的页面在构建前由 scripts/embed_web.py 压缩后生成到 web_assets.h，
+// 以 gzip 原样发送，并带 ETag 供浏览器缓存；动态状态通过 /status 获取
+
+// 辅助函数：把 IP 地址格式化到固定缓冲区
+template <size_t N>
+void formatIp(const IPAddress& ip, FixedString<N>& out) {
+  out.clear();
+  out.appendf("%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+}
 
-// --- HTML 页面内容 ---
-
-// 主页面 HTML (添加 WebSocket 串口监视器 UI 和 JS)
-const char MAIN_PAGE_HTML[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-<meta charset="UTF-8">
-<meta name="viewport" content="width=device-width, initial-scale=1">
-<title>上位机控制面板</title>
-<style>
-  body { font-family: Arial, sans-serif; padding: 20px; background-color: #f4f4f4; }
-  .container { max-width: 800px; margin: auto; background: #fff; padding: 20px; border-radius: 8px; box-shadow: 0 0 10px rgba(0,0,0,0.1); }
-  h1 { color: #333; text-align: center; }
-  h2 { color: #444; margin-top: 30px; border-bottom: 1px solid #eee; padding-bottom: 5px; }
-  p { color: #555; line-height: 1.6; }
-  a { color: #007bff; text-decoration: none; }
-  a:hover { text-decoration: underline; }
-  .status, .serial-monitor { margin-top: 15px; padding: 15px; background-color: #e9ecef; border-radius: 4px; }
-  #serialOutput { width: 98%; height: 200px; margin-bottom: 10px; border: 1px solid #ccc; background-color: #fff; font-family: monospace; font-size: 13px; overflow-y: scroll; padding: 5px; }
-  #serialInput { width: calc(100% - 80px); padding: 8px; border: 1px solid #ccc; border-radius: 4px; margin-right: 5px; }
-  button { padding: 8px 15px; background-color: #007bff; color: white; border: none; border-radius: 4px; cursor: pointer; }
-  button:hover { background-color: #0056b3; }
-</style>
-</head>
-<body>
-<div class="container">
-  <h1>上位机 控制面板</h1>
-  
-  <div class="status">
-    <h2>系统状态</h2>
-    <p><strong>WiFi 状态:</strong> <span id="wifiStatus">%WIFI_STATUS%</span></p>
-    <p><strong>IP 地址:</strong> <span id="ipAddress">%IP_ADDRESS%</span></p>
-    <p><strong>WebSocket:</strong> <span id="wsStatus">未连接</span></p>
-  </div>
-
-  <div class="serial-monitor">
-    <h2>远程串口 (Arduino - Serial2)</h2>
-    <textarea id="serialOutput" readonly></textarea>
-    <input type="text" id="serialInput" placeholder="输入要发送到 Arduino 的数据...">
-    <button onclick="sendSerialData()">发送</button>
-  </div>
-
-  <p style="text-align: center; margin-top: 20px;">
-    <a href="/color">0</a>
-  </p>
-</div>
-
-<script>
-  let gateway = `ws://${window.location.hostname}/ws`;
-  let websocket;
-  const serialOutput = document.getElementById('serialOutput');
-  const serialInput = document.getElementById('serialInput');
-  const wsStatusElement = document.getElementById('wsStatus');
-
-  function initWebSocket() {
-    console.log('尝试连接 WebSocket...');
-    wsStatusElement.textContent = '正在连接...';
-    websocket = new WebSocket(gateway);
-    websocket.onopen    = onOpen;
-    websocket.onclose   = onClose;
-    websocket.onmessage = onMessage;
-    websocket.onerror   = onError;
+// 发送压缩后的网页资源；浏览器缓存的 ETag 一致时返回 304
+void sendWebAsset(AsyncWebServerRequest *request, const WebAsset& asset) {
+  if (request->hasHeader("If-None-Match") &&
+      strcmp(request->getHeader("If-None-Match")->value().c_str(), asset.etag) == 0) {
+    AsyncWebServerResponse *response = request->beginResponse(304);
+    response->addHeader("ETag", asset.etag);
+    request->send(response);
+    return;
   }
+  AsyncWebServerResponse *response = request->beginResponse_P(200, asset.contentType, asset.data, asset.length);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", asset.etag);
+  // 每次使用前用 ETag 验证，固件更新后页面立即生效
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
 
-  function onOpen(event) {
-    console.log('WebSocket 连接已打开');
-    wsStatusElement.textContent = '已连接';
-    wsStatusElement.style.color = 'green';
+// 系统状态（JSON），供页面定时刷新
+void sendSystemStatus(AsyncWebServerRequest *request) {
+  bool connected = (WiFi.status() == WL_CONNECTED);
+  FixedString<16> ip;
+  if (connected) {
+    formatIp(WiFi.localIP(), ip);
+  } else {
+    ip = "N/A";
   }
+  FixedString<192> status;
+  status.appendf("{\"connected\":%s,\"ip\":\"%s\",\"rssi\":%d,\"uptime\":%lu,\"freeHeap\":%u,\"wsClients\":%u}",
+                 connected ? "true" : "false", ip.c_str(), connected ? (int)WiFi.RSSI() : 0,
+                 (unsigned long)millis(), (unsigned)ESP.getFreeHeap(), (unsigned)ws.count());
+  request->send(200, "application/json", status.c_str());
+}
 
-  function onClose(event) {
-    console.log('WebSocket 连接已关闭');
-    wsStatusElement.textContent = '已断开';
-    wsStatusElement.style.color = 'red';
-    setTimeout(initWebSocket, 2000); // 尝试 2 秒后重连
+// 辅助函数：解析 HTTP Range 头（bytes=a-b / bytes=a- / bytes=-n），total 为可用字节数
+bool parseByteRange(const char* header, uint32_t total, uint32_t& first, uint32_t& last) {
+  if (total == 0 || strncmp(header, "bytes=", 6) != 0) {
+    return false;
   }
+  const char* p = header + 6;
+  char* endptr;
+  if (*p == '-') {
+    uint32_t suffix = strtoul(p + 1, &endptr, 10);
+    if (endptr == p + 1 || suffix == 0) {
+      return false;
+    }
+    first = suffix >= total ? 0 : total - suffix;
+    last = total - 1;
+    return true;
+  }
+  first = strtoul(p, &endptr, 10);
+  if (endptr == p || *endptr != '-' || first >= total) {
+    return false;
+  }
+  p = endptr + 1;
+  last = (*p == '\0') ? total - 1 : strtoul(p, &endptr, 10);
+  if (last >= total) {
+    last = total - 1;
+  }
+  return last >= first;
+}
 
-  function onMessage(event) {
-    console.log('收到消息:', event.data);
-    // 尝试将收到的数据（可能是 Blob）转为文本
-    if (event.data instanceof Blob) {
-        let reader = new FileReader();
-        reader.onload = function() {
-            appendSerialOutput(reader.result);
-        };
-        reader.onerror = function(e) {
-            console.error("FileReader Error: ", e);
-             appendSerialOutput(`[Error reading Blob: ${e}]\n`);
-        }
-        reader.readAsText(event.data); // 假设是文本数据
+// 把攒下的 Arduino 数据作为一帧发给所有 WebSocket 客户端
+void flushWsForward() {
+  if (wsForwardLen == 0) {
+    return;
+  }
+  if (ws.count() > 0) {
+    if (ws.availableForWriteAll()) {
+      ws.binaryAll(wsForwardBuf, wsForwardLen);
+      uartStats.wsFrames++;
     } else {
-        // 如果不是 Blob，直接作为文本处理
-        appendSerialOutput(event.data);
+      uartStats.wsDroppedBytes += wsForwardLen;
     }
   }
+  wsForwardLen = 0;
+}
 
- function appendSerialOutput(text) {
-    serialOutput.value += text; // 直接追加文本
-    // 自动滚动到底部
-    serialOutput.scrollTop = serialOutput.scrollHeight;
- }
-
-  function onError(event) {
-    console.error('WebSocket 错误:', event);
-    wsStatusElement.textContent = '错误';
-     wsStatusElement.style.color = 'orange';
+// 回显 Arduino 数据到 USB 串口：可打印字符原样输出，其余按十六进制
+void echoToUsb(const uint8_t* data, size_t len) {
+#if DEBUG_ECHO_UART
+  Serial.print("收到来自 Arduino (UART1): ");
+  for (size_t i = 0; i < len; i++) {
+    if (isprint(data[i])) {
+      Serial.print((char)data[i]);
+    } else {
+      Serial.printf("[%02X]", data[i]);
+    }
   }
+  Serial.println();
+#else
+  (void)data;
+  (void)len;
+#endif
+}
 
-  function sendSerialData() {
-    const dataToSend = serialInput.value;
-    if (dataToSend && websocket && websocket.readyState === WebSocket.OPEN) {
-      console.log('发送数据:', dataToSend);
-      websocket.send(dataToSend);
-      serialInput.value = ''; // 清空输入框
-    } else {
-        console.log('WebSocket 未连接或输入为空');
-        if (!websocket || websocket.readyState !== WebSocket.OPEN) {
-             wsStatusElement.textContent = '未连接，无法发送';
-             wsStatusElement.style.color = 'red';
-        }
+// 读取 RX 缓冲区中的全部数据：原样写入黑匣子，取出结构化消息后攒入转发缓冲，满一帧即发送
+void drainArduinoSerial() {
+  size_t pending;
+  while ((pending = ArduinoSerial.available()) > 0) {
+    if (pending > uartStats.rxHighWater) {
+      uartStats.rxHighWater = pending;
+    }
+    size_t room = WS_FORWARD_MAX_BYTES - wsForwardLen;
+    size_t len = ArduinoSerial.readBytes(uartRxBuf, min(min(room, sizeof(uartRxBuf)), pending));
+    if (len == 0) {
+      break;
+    }
+    uartStats.rxBytes += len;
+    flightRecorder.capture(uartRxBuf, len);
+    echoToUsb(uartRxBuf, len);
+    size_t textLen = arduinoLines.filter(uartRxBuf, len, wsForwardBuf + wsForwardLen);
+    if (textLen > 0 && wsForwardLen == 0) {
+      wsForwardFirstMs = millis();
+    }
+    wsForwardLen += textLen;
+    if (wsForwardLen >= WS_FORWARD_MAX_BYTES) {
+      flushWsForward();
     }
   }
+}
 
-  // 处理 Enter 键发送
-  serialInput.addEventListener('keyup', function(event) {
-      if (event.key === 'Enter') {
-          event.preventDefault(); // 防止可能的表单提交
-          sendSerialData();
-      }
-  });
+// 串口接收任务：等待 onReceive 通知；没有新数据时按转发延时醒来，发送不足一帧的数据
+void uartRxTask(void* param) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(WS_FORWARD_MAX_DELAY_MS));
+    drainArduinoSerial();
+    if (wsForwardLen > 0 && millis() - wsForwardFirstMs >= WS_FORWARD_MAX_DELAY_MS) {
+      flushWsForward();
+    }
+  }
+}
 
-  // 页面加载时初始化 WebSocket
-  window.addEventListener('load', initWebSocket);
-
-  // 更新主页面的 WiFi 状态和 IP (如果它们是通过模板动态设置的)
-  // 如果 processor 函数正常工作, 这些可能不需要JS更新，但保留以备后用
-  document.addEventListener('DOMContentLoaded', () => {
-      const wifiStatusSpan = document.getElementById('wifiStatus');
-      const ipAddressSpan = document.getElementById('ipAddress');
-      // 你可以通过 fetch 或其他方式定期更新这些状态，如果需要的话
-      // 例如: fetch('/api/status').then(...)
-      // 但对于静态值，模板替换就足够了
-  });
+// UART 驱动回调（在驱动的事件任务中执行）：只负责唤醒接收任务
+void onArduinoReceive() {
+  if (uartRxTaskHandle != nullptr) {
+    xTaskNotifyGive(uartRxTaskHandle);
+  }
+}
 
-</script>
-</body>
-</html>
-)rawliteral";
-
-// 颜色选择页面 HTML (原 HTML_PAGE_CONTENT)
-const char COLOR_PAGE_HTML[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-<meta charset="UTF-8">
-<meta name="viewport" content="width=device-width, initial-scale=1">
-<title>ESP32 颜色控制器</title>
-<style>
-  body { font-family: Arial, sans-serif; padding: 20px; background-color: #f4f4f4; }
-  .container { max-width: 400px; margin: auto; background: #fff; padding: 20px; border-radius: 8px; box-shadow: 0 0 10px rgba(0,0,0,0.1); text-align: center; }
-  h1 { color: #333; }
-  button {
-    background-color: #555;
-    color: white;
-    padding: 15px 20px;
-    border: none;
-    border-radius: 5px;
-    cursor: pointer;
-    font-size: 16px;
-    margin: 10px 5px;
-    width: calc(50% - 15px); /* Two buttons per row approx */
-    box-sizing: border-box;
-    transition: background-color 0.3s;
+void onArduinoReceiveError(hwSerialError_t error) {
+  switch (error) {
+    case UART_FIFO_OVF_ERROR:
+      uartStats.fifoOverflows++;
+      break;
+    case UART_BUFFER_FULL_ERROR:
+      uartStats.bufferFull++;
+      break;
+    default:
+      uartStats.lineErrors++;
+      break;
   }
-  button:hover { background-color: #777; }
-  #status { margin-top: 20px; font-weight: bold; color: #333; }
-  /* Specific button colors */
-  button[data-color="1"] { background-color:rgb(251, 251, 251); } /* Red */
-  button[data-color="2"] { background-color:rgb(0, 0, 0); } /* Green */
-  button[data-color="3"] { background-color:rgb(255, 0, 0); } /* Blue */
-  button[data-color="4"] { background-color:rgb(0, 8, 255); color: #333; } /* Yellow */
-  button[data-color="5"] { background-color:rgb(246, 255, 0); } /* Black */
-  button[data-color="1"]:hover { background-color: #d32f2f; }
-  button[data-color="2"]:hover { background-color: #388E3C; }
-  button[data-color="3"]:hover { background-color: #1976D2; }
-  button[data-color="4"]:hover { background-color: #fbc02d; }
-  button[data-color="5"]:hover { background-color: #424242; }
-</style>
-</head>
-<body>
-<div class="container">
-  <h1>选择颜色发送给 Arduino</h1>
-  <button data-color="1" onclick="sendColor(1)">白色 (1)</button>
-  <button data-color="2" onclick="sendColor(2)">黑色 (2)</button>
-  <button data-color="3" onclick="sendColor(3)">红色 (3)</button>
-  <button data-color="4" onclick="sendColor(4)">蓝色 (4)</button>
-  <button data-color="5" onclick="sendColor(5)">黄色 (5)</button>
-  <p id="status">请选择一个颜色。</p>
-</div>
-
-<script>
-function sendColor(code) {
-  const statusElement = document.getElementById('status');
-  statusElement.textContent = '正在发送颜色代码 ' + code + '...';
-  console.log('Sending color code: ' + code); // Debug log in browser console
-
-  fetch('/setcolor?code=' + code)
-    .then(response => {
-      if (!response.ok) {
-        // Try to get error message from response body
-        return response.text().then(text => { throw new Error('请求失败: ' + response.status + ' - ' + (text || '未知错误')); });
-      }
-      return response.text(); // Get success message
-    })
-    .then(data => {
-      console.log('Server response:', data);
-      statusElement.textContent = '颜色代码 ' + code + ' 已发送！';
-    })
-    .catch(error => {
-      console.error('发送错误:', error);
-      statusElement.textContent = '错误: ' + error.message;
-    });
+  // 溢出时缓冲区已满，立即唤醒接收任务
+  onArduinoReceive();
+}
+
+// 串口接收统计（JSON）
+void sendUartStats(AsyncWebServerRequest *request) {
+  FixedString<320> stats;
+  stats.appendf("{\"baud\":%u,\"rxBufferSize\":%u,\"rxBytes\":%u,\"fifoOverflows\":%u,"
+                "\"bufferFull\":%u,\"lineErrors\":%u,\"rxHighWater\":%u,"
+                "\"wsFrames\":%u,\"wsDroppedBytes\":%u,"
+                "\"telemetryFrames\":%u,\"telemetryErrors\":%u,\"lineOverflows\":%u}",
+                (unsigned)ARDUINO_BAUD_RATE, (unsigned)ARDUINO_RX_BUFFER_SIZE,
+                (unsigned)uartStats.rxBytes, (unsigned)uartStats.fifoOverflows,
+                (unsigned)uartStats.bufferFull, (unsigned)uartStats.lineErrors,
+                (unsigned)uartStats.rxHighWater, (unsigned)uartStats.wsFrames,
+                (unsigned)uartStats.wsDroppedBytes,
+                (unsigned)telemetry.getFrameCount(), (unsigned)telemetry.getParseErrors(),
+                (unsigned)arduinoLines.getOverflowCount());
+  request->send(200, "application/json", stats.c_str());
 }
-</script>
-</body>
-</html>
-)rawliteral";
-
-// 辅助函数：处理 HTML 模板替换
-String processor(const String& var){
-  Serial.println("Processing variable: " + var);
-  if(var == "WIFI_STATUS"){
-    return (WiFi.status() == WL_CONNECTED) ? "已连接" : "未连接";
+
+// 处理浏览器提交的可靠命令 {"cmd":"STOP","id":<编号>}，格式错误或队列满时立即回复失败
+void submitWebCommand(AsyncWebSocketClient *client, const uint8_t *data, size_t len) {
+  JsonDocument request;
+  const char* reason = nullptr;
+  uint32_t tag = 0;
+  if (deserializeJson(request, (const char*)data, len) != DeserializationError::Ok ||
+      !request["cmd"].is<const char*>()) {
+    reason = "bad_request";
+  } else {
+    tag = request["id"] | 0;
+    if (commandChannel.submit(request["cmd"].as<const char*>(), client->id(), tag) == 0) {
+      reason = "busy";
+    }
   }
-  if(var == "IP_ADDRESS"){
-    return (WiFi.status() == WL_CONNECTED) ? WiFi.localIP().toString() : "N/A";
+  if (reason != nullptr) {
+    FixedString<96> reply;
+    reply.appendf("{\"type\":\"ack\",\"id\":%u,\"ok\":false,\"reason\":\"%s\"}", (unsigned)tag, reason);
+    client->text(reply.c_str(), reply.length());
   }
-  return String(); // 返回空字符串表示未找到变量
+}
+
+// 黑匣子状态（JSON）
+void sendRecorderStatus(AsyncWebServerRequest *request) {
+  FixedString<256> status;
+  flightRecorder.formatStatus(status);
+  request->send(200, "application/json", status.c_str());
 }
 
 // WebSocket 事件处理函数
 void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
   switch (type) {
     case WS_EVT_CONNECT:{
-      Serial.printf("WebSocket client #%u connected from %s\n", client->id(), client->remoteIP().toString().c_str());
+      FixedString<16> ipStr;
+      formatIp(client->remoteIP(), ipStr);
+      Serial.printf("WebSocket client #%u connected from %s\n", client->id(), ipStr.c_str());
       // 发送欢迎消息或初始状态 (可选)
       // client->text("Welcome!"); 
       }
@@ -276,13 +300,16 @@ void onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsE
       AwsFrameInfo *info = (AwsFrameInfo*)arg;
       if (info->final && info->index == 0 && info->len == len) {
         // 仅处理完整的文本消息 (示例简化)
-        if (info->opcode == WS_TEXT) {
-          data[len] = 0; // 确保空终止
-          String msg = (char*)data;
-          Serial.printf("WS msg from client #%u: %s\n", client->id(), msg.c_str());
-          // 将收到的文本数据发送给 Arduino
-          ArduinoSerial.print(msg); // 使用 print 发送文本
-          Serial.printf("Forwarded to Arduino (Serial2): %s\n", msg.c_str());
+        if (info->opcode == WS_TEXT && len > 0 && data[0] == '{') {
+          // JSON 消息为可靠命令，经 commandChannel 带序号发送并等待确认
+          submitWebCommand(client, data, len);
+        } else if (info->opcode == WS_TEXT) {
+          // 其余文本原样转发（无确认）；data 不以 '\0' 结尾，按长度打印
+          Serial.printf("WS msg from client #%u: %.*s\n", client->id(), (int)len, (const char*)data);
+          // 与可靠命令进入同一发送队列，由 loop() 按提交顺序转发给 Arduino
+          if (!commandChannel.submitRaw(data, len)) {
+            Serial.printf("发送队列已满，丢弃 %u 字节\n", (unsigned)len);
+          }
         }
         // 可以添加对 WS_BINARY 的处理，如果需要接收二进制
       }
@@ -309,10 +336,30 @@ void setup() {
                 ARDUINO_SERIAL_PORT, ARDUINO_RX_PIN, ARDUINO_TX_PIN, ARDUINO_BAUD_RATE);
   Serial.println("请务必确认 ESP32 的 TX(GPIO0) 连接 Arduino 的 RX2(16)，ESP32 的 RX(GPIO1) 连接 Arduino 的 TX2(17)！");
 
-  // 初始化连接 Arduino 的串口
+  // 黑匣子在 WiFi 连接前启动，记录完整的启动过程
+  flightRecorder.begin();
+  telemetry.begin();
+  commandChannel.begin();
+  arduinoLines.addRoute(TELEMETRY_PREFIX, [](const char* line, void* context) {
+    static_cast<Telemetry*>(context)->handleLine(line);
+  }, &telemetry);
+  arduinoLines.addRoute("$ACK:", [](const char* line, void* context) {
+    static_cast<CommandChannel*>(context)->handleAck(line);
+  }, &commandChannel);
+  arduinoLines.addRoute("$NAK:", [](const char* line, void* context) {
+    static_cast<CommandChannel*>(context)->handleNak(line);
+  }, &commandChannel);
+
+  // 初始化连接 Arduino 的串口：RX 缓冲区必须在 begin() 之前设置
+  ArduinoSerial.setRxBufferSize(ARDUINO_RX_BUFFER_SIZE);
   ArduinoSerial.begin(ARDUINO_BAUD_RATE, SERIAL_8N1, ARDUINO_RX_PIN, ARDUINO_TX_PIN);
   delay(100); // 短暂等待串口稳定
 
+  // 接收由独立任务处理，WiFi/WebSocket 繁忙时不会耽误读取
+  xTaskCreate(uartRxTask, "uartRx", UART_RX_TASK_STACK, nullptr, UART_RX_TASK_PRIORITY, &uartRxTaskHandle);
+  ArduinoSerial.onReceiveError(onArduinoReceiveError);
+  ArduinoSerial.onReceive(onArduinoReceive);
+
   // 连接 WiFi
   Serial.printf("正在连接 WiFi: %s ...", WIFI_SSID);
   WiFi.mode(WIFI_STA);
@@ -337,40 +384,48 @@ void setup() {
 
   // --- 配置 Web 服务器路由 ---
 
-  // 根路径: 提供主页面 HTML，使用模板处理器替换状态
-  server.on("/", HTTP_GET, [](AsyncWebServerRequest *request){
-    Serial.println("收到根路径请求 /");
-    // 使用 processor 函数替换模板中的占位符
-    request->send_P(200, "text/html", MAIN_PAGE_HTML, processor);
-  });
+  // 静态页面（主页面 "/"、颜色页面 "/color" 等）
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset* asset = &WEB_ASSETS[i];
+    server.on(asset->path, HTTP_GET, [asset](AsyncWebServerRequest *request){
+      sendWebAsset(request, *asset);
+    });
+  }
 
-  // 颜色子页面路径
-  server.on("/color", HTTP_GET, [](AsyncWebServerRequest *request){
-    Serial.println("收到颜色页面请求 /color");
-    request->send_P(200, "text/html", COLOR_PAGE_HTML);
+  // 系统状态
+  server.on("/status", HTTP_GET, [](AsyncWebServerRequest *request){
+    sendSystemStatus(request);
   });
 
   // 设置颜色路径
   server.on("/setcolor", HTTP_GET, [](AsyncWebServerRequest *request){
-    String responseMessage = "";
+    FixedString<96> responseMessage;
     int httpCode = 400; // Default to Bad Request
 
     if (request->hasParam("code")) {
-      String codeStr = request->getParam("code")->value();
+      const char* codeStr = request->getParam("code")->value().c_str();
       // 尝试将参数转换为整数
       char *endptr;
-      long colorCode_long = strtol(codeStr.c_str(), &endptr, 10);
+      long colorCode_long = strtol(codeStr, &endptr, 10);
 
       // 检查转换是否成功且没有多余字符，并且值在范围内
-      if (*endptr == '\0' && codeStr.length() > 0 && colorCode_long >= 1 && colorCode_long <= 5) {
+      if (*endptr == '\0' && *codeStr != '\0' && colorCode_long >= 1 && colorCode_long <= 5) {
         int colorCode = (int)colorCode_long; // 安全转换
-        ArduinoSerial.println(colorCode); // 发送给 Arduino (println 会添加换行符)
-        Serial.printf("收到网页请求: 发送颜色代码 %d 到 Arduino (UART1)\n", colorCode);
-        responseMessage = "颜色代码 " + codeStr + " 已发送到 Arduino。";
-        httpCode = 200; // OK
+        // 经可靠命令通道发送，丢失时自动重发，确认结果打印到 USB 串口
+        FixedString<8> colorCommand;
+        colorCommand.appendf("%d", colorCode);
+        uint16_t seq = commandChannel.submit(colorCommand.c_str(), 0, 0);
+        if (seq != 0) {
+          Serial.printf("收到网页请求: 发送颜色代码 %d 到 Arduino (UART1)，序号 %u\n", colorCode, seq);
+          responseMessage.appendf("颜色代码 %s 已发送到 Arduino。", codeStr);
+          httpCode = 200; // OK
+        } else {
+          responseMessage = "命令队列已满，请稍后重试。";
+          httpCode = 503; // Service Unavailable
+        }
       } else {
-        Serial.printf("收到无效颜色代码请求: '%s'\n", codeStr.c_str());
-        responseMessage = "无效的颜色代码: '" + codeStr + "'. 请输入 1 到 5 之间的数字。";
+        Serial.printf("收到无效颜色代码请求: '%s'\n", codeStr);
+        responseMessage.appendf("无效的颜色代码: '%.16s'. 请输入 1 到 5 之间的数字。", codeStr);
         httpCode = 400; // Bad Request
       }
     } else {
@@ -378,7 +433,95 @@ void setup() {
       responseMessage = "请求中缺少 'code' 参数。";
       httpCode = 400; // Bad Request
     }
-    request->send(httpCode, "text/plain", responseMessage);
+    request->send(httpCode, "text/plain", responseMessage.c_str());
+  });
+
+  // 串口接收统计
+  server.on("/uart", HTTP_GET, [](AsyncWebServerRequest *request){
+    sendUartStats(request);
+  });
+
+  // 可靠命令统计（确认数、超时、往返延时）
+  server.on("/commands", HTTP_GET, [](AsyncWebServerRequest *request){
+    FixedString<256> status;
+    commandChannel.formatStatus(status);
+    request->send(200, "application/json", status.c_str());
+  });
+
+  // --- 黑匣子 ---
+  server.on("/recorder", HTTP_GET, [](AsyncWebServerRequest *request){
+    sendRecorderStatus(request);
+  });
+
+  // 下载 RAM 中的记录：?from=<绝对偏移> 用于增量下载，支持 Range 头
+  // 未冻结时最早的数据可能在下载过程中被覆盖，需要完整快照时先冻结
+  server.on("/recorder/download", HTTP_GET, [](AsyncWebServerRequest *request){
+    uint32_t start = flightRecorder.getStart();
+    uint32_t end = flightRecorder.getEnd();
+    uint32_t from = start;
+    if (request->hasParam("from")) {
+      uint32_t requested = strtoul(request->getParam("from")->value().c_str(), nullptr, 10);
+      if (requested - start <= end - start) {
+        from = requested; // 已被覆盖的偏移从最早处开始
+      }
+    }
+    uint32_t to = end;
+    bool partial = false;
+    uint32_t first, last;
+    if (request->hasHeader("Range") &&
+        parseByteRange(request->getHeader("Range")->value().c_str(), end - from, first, last)) {
+      to = from + last + 1;
+      from += first;
+      partial = true;
+    }
+
+    AsyncWebServerResponse *response = request->beginResponse("application/octet-stream", to - from,
+      [from, to](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        uint32_t offset = from + index;
+        if (offset >= to) {
+          return 0;
+        }
+        return flightRecorder.read(offset, buffer, min(maxLen, (size_t)(to - offset)));
+      });
+    FixedString<48> header;
+    header.appendf("%u", (unsigned)from);
+    response->addHeader("X-Flight-Start", header.c_str());
+    header.clear();
+    header.appendf("%u", (unsigned)to);
+    response->addHeader("X-Flight-End", header.c_str());
+    response->addHeader("Accept-Ranges", "bytes");
+    response->addHeader("Content-Disposition", "attachment; filename=\"flight.bin\"");
+    if (partial) {
+      header.clear();
+      header.appendf("bytes %u-%u/%u", (unsigned)first, (unsigned)last, (unsigned)(end - (from - first)));
+      response->addHeader("Content-Range", header.c_str());
+      response->setCode(206);
+    }
+    request->send(response);
+  });
+
+  // 下载冻结时保存到 LittleFS 的记录（重启后仍在）
+  server.on("/recorder/saved", HTTP_GET, [](AsyncWebServerRequest *request){
+    if (!flightRecorder.hasSavedFile()) {
+      request->send(404, "text/plain", "没有已保存的黑匣子记录");
+      return;
+    }
+    request->send(LittleFS, FLIGHT_SAVED_PATH, "application/octet-stream", true);
+  });
+
+  server.on("/recorder/freeze", HTTP_GET, [](AsyncWebServerRequest *request){
+    flightRecorder.freeze("手动冻结");
+    sendRecorderStatus(request);
+  });
+
+  server.on("/recorder/resume", HTTP_GET, [](AsyncWebServerRequest *request){
+    flightRecorder.resume();
+    sendRecorderStatus(request);
+  });
+
+  server.on("/recorder/clear", HTTP_GET, [](AsyncWebServerRequest *request){
+    flightRecorder.clear();
+    sendRecorderStatus(request);
   });
 
   // 处理未找到的路由 (可选)
@@ -392,6 +535,13 @@ void setup() {
   server.addHandler(&ws);       // 将 WebSocket 处理器添加到 Web 服务器
   Serial.println("WebSocket 服务器已配置在 /ws");
 
+  telemetryWs.onEvent([](AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type,
+                         void *arg, uint8_t *data, size_t len) {
+    telemetry.onEvent(client, type, arg, data, len);
+  });
+  server.addHandler(&telemetryWs);
+  Serial.println("遥测 WebSocket 已配置在 /telemetry/ws");
+
   // 启动服务器 (现在包括 WebSocket)
   server.begin();
   Serial.println("HTTP 和 WebSocket 服务器已启动");
@@ -406,30 +556,13 @@ void loop() {
   // 清理旧的 WS 客户端 (如果需要，ESPAsyncWebServer 会处理)
   // ws.cleanupClients(); 
 
-  // 检查来自 Arduino 的数据并转发给 WebSocket 客户端
-  if (ArduinoSerial.available() > 0) {
-    // 读取所有可用字节
-    size_t len = ArduinoSerial.available();
-    uint8_t buf[128]; // 使用固定大小的缓冲区
-    len = ArduinoSerial.readBytes(buf, min((size_t)128, len)); // 读取最多128字节
-    
-    if (len > 0) {
-        // 转发给所有 WebSocket 客户端 (使用 binary 发送)
-        ws.binaryAll(buf, len);
-        
-        // 同时在 ESP32 的 Serial 上打印调试信息 (可选)
-        Serial.print("收到来自 Arduino (UART1) 并转发到 WS: ");
-        // 打印为字符（如果可打印）或十六进制
-        for(size_t i=0; i<len; i++) {
-           if (isprint(buf[i])) {
-               Serial.print((char)buf[i]);
-           } else {
-               Serial.printf("[%02X]", buf[i]);
-           }
-        }
-        Serial.println();
-    }
-  }
+  // 按提交顺序发送可靠命令和 WebSocket 原样文本，重发超时未确认的命令
+  commandChannel.update();
+
+  // 来自 Arduino 的数据由 uartRxTask 读取和转发
+
+  // 黑匣子冻结后保存到 LittleFS
+  flightRecorder.update();
 
   // ESPAsyncWebServer 和 WebSocket 都是异步的，不需要 delay()
 }
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include "ArmScripts.h"
+#include <avr/pgmspace.h>
+#include <string.h>
+
+// 常用位姿（微秒）
+#define POSE_REST   1500,  900
+#define POSE_GROUND 2150,  450
+#define POSE_BOX    1500, 1600
+
+// 夹爪位置（微秒）
+#define CLAW_OPEN   150
+#define CLAW_CLOSE  900
+#define CLAW_REST   600
+
+// --- 关键帧表 ---
+// 格式: {底部, 中间, 夹爪, 最短过渡时间ms, 保持时间ms}
+
+// 多个脚本共用的关键帧
+#define FRAME_GROUND_OPEN   {POSE_GROUND, CLAW_OPEN,  0, 0}  // 在地面张开夹爪
+#define FRAME_GROUND_CLOSED {POSE_GROUND, CLAW_CLOSE, 0, 0}  // 在地面夹紧
+#define FRAME_BOX_CLOSED    {POSE_BOX,    CLAW_CLOSE, 0, 0}  // 夹紧停在物料盒上方
+
+static const ArmKeyframe SCRIPT_REST[] PROGMEM = {
+    {POSE_REST, CLAW_REST, 0, 0}
+};
+
+static const ArmKeyframe SCRIPT_GRAB[] PROGMEM = {
+    {POSE_GROUND, 0,          0, 0},    // 下降并张开夹爪
+    FRAME_GROUND_CLOSED,                // 闭合夹爪
+    FRAME_BOX_CLOSED                    // 抬起到物料盒上方，保持夹紧以便识别颜色
+};
+
+static const ArmKeyframe SCRIPT_STOW[] PROGMEM = {
+    {POSE_BOX,    0,          0, 1000}  // 松开夹爪，等待物块落入物料盒
+};
+
+static const ArmKeyframe SCRIPT_RELEASE[] PROGMEM = {
+    FRAME_BOX_CLOSED,                   // 从物料盒夹紧物块
+    FRAME_GROUND_CLOSED,                // 放下物块
+    {POSE_GROUND, -50,        0, 0},    // 完全松开夹爪
+    {POSE_REST,   CLAW_REST,  0, 0}     // 复位
+};
+
+static const ArmKeyframe SCRIPT_PICK_UP[] PROGMEM = {
+    FRAME_GROUND_OPEN,
+    FRAME_GROUND_CLOSED,
+    FRAME_BOX_CLOSED
+};
+
+static const ArmKeyframe SCRIPT_DROP[] PROGMEM = {
+    FRAME_GROUND_CLOSED,
+    FRAME_GROUND_OPEN,
+    {POSE_BOX,    ARM_KEEP,   0, 0}
+};
+
+static const ArmKeyframe SCRIPT_MOVE_UP[] PROGMEM = {
+    {POSE_BOX, ARM_KEEP, 0, 0}
+};
+
+static const ArmKeyframe SCRIPT_MOVE_DOWN[] PROGMEM = {
+    {POSE_GROUND, ARM_KEEP, 0, 0}
+};
+
+static const ArmKeyframe SCRIPT_MOVE_TO_BOX[] PROGMEM = {
+    {POSE_BOX, ARM_KEEP, 0, 0}
+};
+
+static const ArmKeyframe SCRIPT_OPEN_GRIPPER[] PROGMEM = {
+    {ARM_KEEP, ARM_KEEP, CLAW_OPEN, 0, 0}
+};
+
+static const ArmKeyframe SCRIPT_CLOSE_GRIPPER[] PROGMEM = {
+    {ARM_KEEP, ARM_KEEP, CLAW_CLOSE, 0, 0}
+};
+
+#define SCRIPT_ENTRY(table) { table, sizeof(table) / sizeof(table[0]) }
+
+// 脚本表，顺序与ArmScriptId一致（不含CUSTOM）
+static const ArmScriptInfo SCRIPT_TABLE[] PROGMEM = {
+    SCRIPT_ENTRY(SCRIPT_REST),
+    SCRIPT_ENTRY(SCRIPT_GRAB),
+    SCRIPT_ENTRY(SCRIPT_STOW),
+    SCRIPT_ENTRY(SCRIPT_RELEASE),
+    SCRIPT_ENTRY(SCRIPT_PICK_UP),
+    SCRIPT_ENTRY(SCRIPT_DROP),
+    SCRIPT_ENTRY(SCRIPT_MOVE_UP),
+    SCRIPT_ENTRY(SCRIPT_MOVE_DOWN),
+    SCRIPT_ENTRY(SCRIPT_MOVE_TO_BOX),
+    SCRIPT_ENTRY(SCRIPT_OPEN_GRIPPER),
+    SCRIPT_ENTRY(SCRIPT_CLOSE_GRIPPER)
+};
+
+// 脚本名称，顺序与ArmScriptId一致
+// armScriptName()把名称复制到该大小的缓冲区，更长的名称在编译时报错
+#define ARM_SCRIPT_NAME_SIZE 8
+#define SCRIPT_NAME(var, text) \
+    static const char var[] PROGMEM = text; \
+    static_assert(sizeof(text) <= ARM_SCRIPT_NAME_SIZE, "脚本名称超出ARM_SCRIPT_NAME_SIZE")
+
+SCRIPT_NAME(N_REST, "REST");
+SCRIPT_NAME(N_GRAB, "GRAB");
+SCRIPT_NAME(N_STOW, "STOW");
+SCRIPT_NAME(N_RELEASE, "RELEASE");
+SCRIPT_NAME(N_PICK_UP, "PICKUP");
+SCRIPT_NAME(N_DROP, "DROP");
+SCRIPT_NAME(N_MOVE_UP, "UP");
+SCRIPT_NAME(N_MOVE_DOWN, "DOWN");
+SCRIPT_NAME(N_MOVE_TO_BOX, "BOX");
+SCRIPT_NAME(N_OPEN, "OPEN");
+SCRIPT_NAME(N_CLOSE, "CLOSE");
+SCRIPT_NAME(N_CUSTOM, "CUSTOM");
+
+static const char* const NAME_TABLE[] PROGMEM = {
+    N_REST, N_GRAB, N_STOW, N_RELEASE, N_PICK_UP, N_DROP, N_MOVE_UP,
+    N_MOVE_DOWN, N_MOVE_TO_BOX, N_OPEN, N_CLOSE, N_CUSTOM
+};
+
+bool getArmScriptInfo(ArmScriptId id, ArmScriptInfo& info) {
+    if (id >= ARM_SCRIPT_CUSTOM) {
+        return false;
+    }
+    memcpy_P(&info, &SCRIPT_TABLE[id], sizeof(ArmScriptInfo));
+    return true;
+}
+
+const char* armScriptName(ArmScriptId id) {
+    // 名称存放于Flash，复制到静态缓冲区后返回
+    static char nameBuffer[ARM_SCRIPT_NAME_SIZE];
+    if (id >= ARM_SCRIPT_COUNT) {
+        return "NONE";
+    }
+    strcpy_P(nameBuffer, (const char*)pgm_read_word(&NAME_TABLE[id]));
+    return nameBuffer;
+}
+
+ArmScriptId armScriptFromName(const char* name) {
+    for (uint8_t i = 0; i < ARM_SCRIPT_COUNT; i++) {
+        if (strcasecmp_P(name, (const char*)pgm_read_word(&NAME_TABLE[i])) == 0) {
+            return static_cast<ArmScriptId>(i);
+        }
+    }
+    return ARM_SCRIPT_NONE;
+}
@@ -0,0 +1,51 @@
+#ifndef ARM_SCRIPTS_H
+#define ARM_SCRIPTS_H
+
+#include <Arduino.h>
+
+// 关键帧中表示"保持该关节当前位置"的特殊值
+const int16_t ARM_KEEP = -32768;
+
+// 机械臂关键帧：目标位姿 + 过渡时间 + 保持时间
+struct ArmKeyframe {
+    int16_t base;          // 底部舵机（微秒）
+    int16_t arm;           // 中间舵机（微秒）
+    int16_t claw;          // 夹爪舵机（微秒）
+    uint16_t transitionMs; // 最短过渡时间，0表示按关节上限最快到达
+    uint16_t holdMs;       // 到位后保持时间
+};
+
+// 动作脚本编号
+enum ArmScriptId {
+    ARM_SCRIPT_REST,          // 回到初始姿态
+    ARM_SCRIPT_GRAB,          // 任务抓取：地面夹取物块并抬到物料盒上方（保持夹紧）
+    ARM_SCRIPT_STOW,          // 任务抓取：松开夹爪，物块落入物料盒
+    ARM_SCRIPT_RELEASE,       // 任务释放：从物料盒取出物块放到地面并复位
+    ARM_SCRIPT_PICK_UP,       // 夹取物块并抬起保持
+    ARM_SCRIPT_DROP,          // 放下物块并抬起
+    ARM_SCRIPT_MOVE_UP,       // 上升到安全位置（保持夹爪）
+    ARM_SCRIPT_MOVE_DOWN,     // 下降到抓取位置（保持夹爪）
+    ARM_SCRIPT_MOVE_TO_BOX,   // 移动到物料盒位置（保持夹爪）
+    ARM_SCRIPT_OPEN_GRIPPER,  // 打开夹爪
+    ARM_SCRIPT_CLOSE_GRIPPER, // 关闭夹爪
+    ARM_SCRIPT_CUSTOM,        // RAM中的自定义脚本，可通过串口编辑
+    ARM_SCRIPT_COUNT,
+    ARM_SCRIPT_NONE = 0xFF
+};
+
+// 脚本描述（存放于Flash）
+struct ArmScriptInfo {
+    const ArmKeyframe* frames; // 关键帧数组（PROGMEM）
+    uint8_t length;            // 关键帧数量
+};
+
+// 读取Flash中脚本的描述，CUSTOM脚本返回false
+bool getArmScriptInfo(ArmScriptId id, ArmScriptInfo& info);
+
+// 脚本名称（用于串口命令和日志）
+const char* armScriptName(ArmScriptId id);
+
+// 按名称查找脚本（不区分大小写），未找到返回ARM_SCRIPT_NONE
+ArmScriptId armScriptFromName(const char* name);
+
+#endif // ARM_SCRIPTS_H
@@ -1,22 +1,49 @@
 #include "RoboticArm.h"
 #include "../Utils/Logger.h"
 
-RoboticArm::RoboticArm() : isCalibrated(false) {
+RoboticArm::RoboticArm()
+    : isCalibrated(false)
+    , moveStartTime(0)
+    , moveDuration(0)
+    , moving(false)
+    , customBindings(0)
+    , activeScript(ARM_SCRIPT_NONE)
+    , scriptFrame(0)
+    , scriptLength(0)
+    , scriptHoldMs(0)
+    , scriptHolding(false)
+    , holdStartTime(0) {
     // 初始化当前位置为初始位置
     for (int i = 0; i < SERVO_NUM; i++) {
         currentPositions[i] = servo_initial_pos[i];
+        trajectories[i].startPos = servo_initial_pos[i];
+        trajectories[i].targetPos = servo_initial_pos[i];
+        trajectories[i].accelTime = 0;
+        trajectories[i].accel = 0;
     }
     // 修改爪子初始角度
     servo_initial_pos[2] = 600;
+    
+    // 默认关节速度/加速度上限
+    trajectories[ARM_JOINT_BASE].maxVelocity = ARM_BASE_MAX_VELOCITY;
+    trajectories[ARM_JOINT_BASE].maxAccel = ARM_BASE_MAX_ACCEL;
+    trajectories[ARM_JOINT_ARM].maxVelocity = ARM_ARM_MAX_VELOCITY;
+    trajectories[ARM_JOINT_ARM].maxAccel = ARM_ARM_MAX_ACCEL;
+    trajectories[ARM_JOINT_CLAW].maxVelocity = ARM_CLAW_MAX_VELOCITY;
+    trajectories[ARM_JOINT_CLAW].maxAccel = ARM_CLAW_MAX_ACCEL;
 }
 
 void RoboticArm::init() {
     // 初始化舵机
+    // 上电时舵机实际位置未知，直接写入初始位置而不做插补
     for (byte i = 0; i < SERVO_NUM; i++) {
         myservos[i].attach(servo_pin[i]);
         myservos[i].writeMicroseconds(servo_initial_pos[i]);
         currentPositions[i] = servo_initial_pos[i];
+        trajectories[i].startPos = servo_initial_pos[i];
+        trajectories[i].targetPos = servo_initial_pos[i];
     }
+    moving = false;
     
     // 初始化超声波传感器
     ultrasonic.init();
@@ -29,8 +56,7 @@ void RoboticArm::calibrate() {
     Logger::info("RoboticArm", "开始校准机械臂");
     
     // 回到初始位置，爪子角度为600
-    servoControl(1500, 900, 600);
-    delay(1000);
+    runScript(ARM_SCRIPT_REST);
     
     // 标记为已校准
     isCalibrated = true;
@@ -38,24 +64,164 @@ void RoboticArm::calibrate() {
     Logger::info("RoboticArm", "机械臂校准完成");
 }
 
-void RoboticArm::servoControl(int angle_base, int angle_arm, int angle_claw) {
+float RoboticArm::minimumMoveTime(float distance, float maxVelocity, float maxAccel) {
+    if (distance <= 0 || maxVelocity <= 0 || maxAccel <= 0) {
+        return 0;
+    }
+    
+    // 换算为毫秒单位
+    float v = maxVelocity / 1000.0f;     // 微秒/毫秒
+    float a = maxAccel / 1000000.0f;     // 微秒/毫秒²
+    
+    if (distance <= v * v / a) {
+        // 距离太短达不到速度上限：三角形速度曲线
+        return 2.0f * sqrt(distance / a);
+    }
+    // 梯形速度曲线：加速 + 匀速 + 减速
+    return distance / v + v / a;
+}
+
+void RoboticArm::servoControl(int angle_base, int angle_arm, int angle_claw, unsigned long minDurationMs) {
+    int targets[SERVO_NUM] = {angle_base, angle_arm, angle_claw};
+    float minTimes[SERVO_NUM];
+    float duration = (float)minDurationMs;
+    
+    // 1. 以当前位置为起点，按各关节自身上限求最短时间，取最慢关节为本次运动时长
+    for (byte i = 0; i < SERVO_NUM; i++) {
+        JointTrajectory& traj = trajectories[i];
+        traj.startPos = currentPositions[i];
+        traj.targetPos = constrain(targets[i], ARM_SERVO_MIN_US, ARM_SERVO_MAX_US);
+        
+        float distance = abs(traj.targetPos - traj.startPos);
+        minTimes[i] = minimumMoveTime(distance, traj.maxVelocity, traj.maxAccel);
+        if (minTimes[i] > duration) {
+            duration = minTimes[i];
+        }
+    }
+    
+    // 2. 其余关节按比例拉伸时间轴，使三个关节同时到达
+    //    时间拉伸k倍后速度降为1/k、加速度降为1/k²，不会超出上限
+    for (byte i = 0; i < SERVO_NUM; i++) {
+        JointTrajectory& traj = trajectories[i];
+        float distance = abs(traj.targetPos - traj.startPos);
+        
+        if (distance <= 0 || duration <= 0) {
+            traj.accelTime = 0;
+            traj.accel = 0;
+            continue;
+        }
+        
+        float v = traj.maxVelocity / 1000.0f;
+        float a = traj.maxAccel / 1000000.0f;
+        float minAccelTime = (distance <= v * v / a) ? minTimes[i] / 2.0f : v / a;
+        float stretch = (minTimes[i] > 0) ? duration / minTimes[i] : 1.0f;
+        
+        traj.accelTime = minAccelTime * stretch;
+        // 由 距离 = a * ta * (T - ta) 反求实际加速度，保证终点精确
+        traj.accel = distance / (traj.accelTime * (duration - traj.accelTime));
+    }
+    
+    moveDuration = (unsigned long)(duration + 0.5f);
+    moveStartTime = millis();
+    moving = true;
+    
+    // 输出调用者给出的目标值（与原来的输出一致），限幅只作用于实际写入舵机的脉宽
     char cmd_return[64];
-    sprintf(cmd_return, "#000P%04dT2000!#001P%04dT2000!#002P%04dT2000!",
-            angle_base, angle_arm, angle_claw);
+    sprintf(cmd_return, "#000P%04dT%04lu!#001P%04dT%04lu!#002P%04dT%04lu!",
+            angle_base, moveDuration,
+            angle_arm, moveDuration,
+            angle_claw, moveDuration);
     Serial.println((char *)cmd_return);
+    
+    // 记录日志
+    Logger::debug("RoboticArm", "舵机目标: 底部=%d, 中间=%d, 夹爪=%d, 预计用时=%lu ms", 
+                 angle_base, angle_arm, angle_claw, moveDuration);
+    
+    // 立即输出轨迹起点
+    update();
+}
 
-    myservos[0].writeMicroseconds(angle_base);
-    myservos[1].writeMicroseconds(angle_arm);
-    myservos[2].writeMicroseconds(angle_claw);
+int RoboticArm::sampleJoint(const JointTrajectory& traj, float elapsedMs) const {
+    float total = (float)moveDuration;
+    if (traj.accel <= 0 || elapsedMs >= total) {
+        return traj.targetPos;
+    }
     
-    // 更新当前位置
-    currentPositions[0] = angle_base;
-    currentPositions[1] = angle_arm;
-    currentPositions[2] = angle_claw;
+    float distance = abs(traj.targetPos - traj.startPos);
+    float ta = traj.accelTime;
+    float travelled;
     
-    // 记录日志
-    Logger::debug("RoboticArm", "舵机位置: 底部=%d, 中间=%d, 夹爪=%d", 
-                 angle_base, angle_arm, angle_claw);
+    if (elapsedMs < ta) {
+        // 加速段
+        travelled = 0.5f * traj.accel * elapsedMs * elapsedMs;
+    } else if (elapsedMs <= total - ta) {
+        // 匀速段
+        travelled = 0.5f * traj.accel * ta * ta + traj.accel * ta * (elapsedMs - ta);
+    } else {
+        // 减速段
+        float remaining = total - elapsedMs;
+        travelled = distance - 0.5f * traj.accel * remaining * remaining;
+    }
+    
+    int offset = (int)(travelled + 0.5f);
+    return (traj.targetPos >= traj.startPos) ? traj.startPos + offset : traj.startPos - offset;
+}
+
+void RoboticArm::update() {
+    if (moving) {
+        unsigned long elapsed = millis() - moveStartTime;
+        
+        for (byte i = 0; i < SERVO_NUM; i++) {
+            int pos = sampleJoint(trajectories[i], (float)elapsed);
+            if (pos != currentPositions[i]) {
+                myservos[i].writeMicroseconds(pos);
+                currentPositions[i] = pos;
+            }
+        }
+        
+        // 轨迹结束后再等待一小段时间让舵机追上设定值
+        if (elapsed >= moveDuration + ARM_SETTLE_TIME) {
+            moving = false;
+        }
+    }
+    
+    if (activeScript != ARM_SCRIPT_NONE) {
+        updateScript();
+    }
+}
+
+void RoboticArm::waitForMove() {
+    while (moving) {
+        update();
+        delay(SERVO_DELAY);
+    }
+}
+
+void RoboticArm::moveTo(int baseAngle, int armAngle, int clawAngle, unsigned long minDurationMs) {
+    servoControl(baseAngle, armAngle, clawAngle, minDurationMs);
+}
+
+void RoboticArm::setJointLimits(ArmJoint joint, float maxVelocity, float maxAccel) {
+    if (joint < 0 || joint >= SERVO_NUM || maxVelocity <= 0 || maxAccel <= 0) {
+        Logger::warning("RoboticArm", "无效的关节限幅参数: 关节=%d", joint);
+        return;
+    }
+    trajectories[joint].maxVelocity = maxVelocity;
+    trajectories[joint].maxAccel = maxAccel;
+}
+
+void RoboticArm::stopMotion() {
+    if (!moving) {
+        return;
+    }
+    // 以当前插补位置为终点，舵机停在原地
+    for (byte i = 0; i < SERVO_NUM; i++) {
+        trajectories[i].startPos = currentPositions[i];
+        trajectories[i].targetPos = currentPositions[i];
+        trajectories[i].accel = 0;
+    }
+    moving = false;
+    Logger::info("RoboticArm", "机械臂运动已停止");
 }
 
 bool RoboticArm::checkGrabCondition() {
@@ -65,8 +231,27 @@ bool RoboticArm::checkGrabCondition() {
     Serial2.print(distance);
     Serial2.println(" cm");
     
-    // 当距离在12-13.5cm范围内时返回true
-    return (distance >= 12.5f && distance <= 13.5f);
+    // 当距离在12.5-13.5cm范围内时返回true
+    return isGrabDistance(distance);
+}
+
+float RoboticArm::getObjectDistance() {
+    return ultrasonic.getDistance();
+}
+
+bool RoboticArm::isGrabDistance(float distance) {
+    return (distance >= ARM_GRAB_MIN_DISTANCE && distance <= ARM_GRAB_MAX_DISTANCE);
+}
+
+void RoboticArm::moveToPreGrasp() {
+    ArmKeyframe frame;
+    if (!getKeyframe(ARM_SCRIPT_GRAB, 0, frame)) {
+        return;
+    }
+    
+    // 只执行第0帧的运动，不进入脚本播放
+    Logger::debug("RoboticArm", "移动到预抓取姿态");
+    startKeyframe(frame);
 }
 
 bool RoboticArm::grab() {
@@ -81,20 +266,9 @@ bool RoboticArm::grab() {
         return false;
     }
     
-    // 执行抓取动作序列
+    // 执行抓取动作序列：打开夹爪下降、闭合、抬起
     Logger::info("RoboticArm", "执行抓取动作");
-    
-    // 旋转到抓取位置并打开夹爪
-    servoControl(2150, 450, 150);
-    delay(2000);
-    
-    // 闭合夹爪抓取物体 - 使用900作为闭合值
-    servoControl(2150, 450, 900);
-    delay(2000);
-    
-    // 抬起物体 - 保持夹爪闭合
-    servoControl(1500, 1600, 900);
-    delay(2000);
+    runScript(ARM_SCRIPT_PICK_UP);
     
     // 返回抓取成功
     return true;
@@ -106,70 +280,405 @@ void RoboticArm::release() {
         return;
     }
     
-    // 执行释放动作序列
+    // 执行释放动作序列：放下、打开夹爪、回到安全位置
     Logger::info("RoboticArm", "执行释放动作");
-    
-    // 放下机械臂到放置区
-    servoControl(2150, 450, 900); // 确保夹爪仍然闭合
-    delay(2000);
-    
-    // 打开夹爪释放物体
-    servoControl(2150, 450, 150);
-    delay(2000);
-    
-    // 回到安全位置
-    moveUp();
+    runScript(ARM_SCRIPT_DROP);
 }
 
 void RoboticArm::openGripper() {
     Logger::info("RoboticArm", "打开夹爪");
-    servoControl(currentPositions[0], currentPositions[1], 150);
-    delay(1000);
+    runScript(ARM_SCRIPT_OPEN_GRIPPER);
 }
 
 void RoboticArm::closeGripper() {
     Logger::info("RoboticArm", "关闭夹爪");
-    servoControl(currentPositions[0], currentPositions[1], 900);
-    delay(1000);
+    runScript(ARM_SCRIPT_CLOSE_GRIPPER);
 }
 
 void RoboticArm::moveUp() {
     Logger::info("RoboticArm", "机械臂上升到安全位置");
-    servoControl(1500, 1600, currentPositions[2]);
-    delay(2000);
+    runScript(ARM_SCRIPT_MOVE_UP);
 }
 
 void RoboticArm::moveDown() {
     Logger::info("RoboticArm", "机械臂下降到抓取位置");
-    servoControl(2150, 450, currentPositions[2]);
-    delay(2000);
+    runScript(ARM_SCRIPT_MOVE_DOWN);
 }
 
 void RoboticArm::moveToBox() {
     Logger::info("RoboticArm", "机械臂移动到物料盒位置");
-    servoControl(1500, 1600, currentPositions[2]);
-    delay(2000);
+    runScript(ARM_SCRIPT_MOVE_TO_BOX);
 }
 
 void RoboticArm::reset() {
     Logger::info("RoboticArm", "机械臂复位");
     
-    // 复位到默认位置，爪子角度为600
-    servoControl(1500, 900, 600);
-    delay(2000);
-    
-    // 重新校准
+    // 复位到默认位置并重新校准
     calibrate();
 }
 
 void RoboticArm::adjustArm(int baseAngle, int armAngle, int clawAngle) {
     Logger::info("RoboticArm", "调整机械臂位置");
     servoControl(baseAngle, armAngle, clawAngle);
-    delay(2000);
+    waitForMove();
+}
+
+// ==================== 关键帧脚本 ====================
+
+uint8_t RoboticArm::getScriptLength(ArmScriptId id) const {
+    if (id == ARM_SCRIPT_CUSTOM || (id < ARM_SCRIPT_CUSTOM && (customBindings & (1 << id)))) {
+        return customFrames.size();
+    }
+    ArmScriptInfo info;
+    if (!getArmScriptInfo(id, info)) {
+        return 0;
+    }
+    return info.length;
+}
+
+bool RoboticArm::getKeyframe(ArmScriptId id, uint8_t index, ArmKeyframe& frame) const {
+    // 1. 被替换为自定义脚本
+    if (id == ARM_SCRIPT_CUSTOM || (id < ARM_SCRIPT_CUSTOM && (customBindings & (1 << id)))) {
+        if (index >= customFrames.size()) {
+            return false;
+        }
+        frame = customFrames[index];
+        return true;
+    }
+    
+    ArmScriptInfo info;
+    if (!getArmScriptInfo(id, info) || index >= info.length) {
+        return false;
+    }
+    
+    // 2. 运行时覆盖的关键帧
+    for (const KeyframeOverride& entry : scriptOverrides) {
+        if (entry.script == id && entry.index == index) {
+            frame = entry.frame;
+            return true;
+        }
+    }
+    
+    // 3. Flash中的原始关键帧
+    memcpy_P(&frame, &info.frames[index], sizeof(ArmKeyframe));
+    return true;
+}
+
+void RoboticArm::startKeyframe(const ArmKeyframe& frame) {
+    int base = (frame.base == ARM_KEEP) ? currentPositions[ARM_JOINT_BASE] : frame.base;
+    int arm = (frame.arm == ARM_KEEP) ? currentPositions[ARM_JOINT_ARM] : frame.arm;
+    int claw = (frame.claw == ARM_KEEP) ? currentPositions[ARM_JOINT_CLAW] : frame.claw;
+    
+    scriptHoldMs = frame.holdMs;
+    scriptHolding = false;
+    servoControl(base, arm, claw, frame.transitionMs);
+}
+
+void RoboticArm::updateScript() {
+    // 等待当前关键帧到位
+    if (moving) {
+        return;
+    }
+    
+    // 到位后进入保持阶段
+    if (!scriptHolding) {
+        scriptHolding = true;
+        holdStartTime = millis();
+    }
+    if (millis() - holdStartTime < scriptHoldMs) {
+        return;
+    }
+    
+    // 切换到下一帧
+    scriptFrame++;
+    ArmKeyframe frame;
+    if (scriptFrame >= scriptLength || !getKeyframe(activeScript, scriptFrame, frame)) {
+        Logger::debug("RoboticArm", "脚本 %s 播放完成", armScriptName(activeScript));
+        activeScript = ARM_SCRIPT_NONE;
+        return;
+    }
+    startKeyframe(frame);
+}
+
+void RoboticArm::playScript(ArmScriptId id, uint8_t startFrame) {
+    ArmKeyframe frame;
+    uint8_t length = getScriptLength(id);
+    
+    if (startFrame >= length || !getKeyframe(id, startFrame, frame)) {
+        Logger::warning("RoboticArm", "脚本 %s 无可播放的关键帧 (起始帧 %d, 长度 %d)",
+                        armScriptName(id), startFrame, length);
+        activeScript = ARM_SCRIPT_NONE;
+        return;
+    }
+    
+    activeScript = id;
+    scriptFrame = startFrame;
+    scriptLength = length;
+    Logger::debug("RoboticArm", "开始播放脚本 %s (%d 帧)", armScriptName(id), length);
+    startKeyframe(frame);
+}
+
+void RoboticArm::runScript(ArmScriptId id) {
+    playScript(id);
+    while (activeScript != ARM_SCRIPT_NONE) {
+        update();
+        delay(SERVO_DELAY);
+    }
+}
+
+void RoboticArm::stopScript() {
+    activeScript = ARM_SCRIPT_NONE;
+    stopMotion();
+}
+
+bool RoboticArm::isScriptRunning() const {
+    return activeScript != ARM_SCRIPT_NONE;
+}
+
+ArmScriptId RoboticArm::getActiveScript() const {
+    return activeScript;
+}
+
+uint8_t RoboticArm::getScriptFrame() const {
+    return scriptFrame;
+}
+
+bool RoboticArm::setKeyframe(ArmScriptId id, uint8_t index, const ArmKeyframe& frame) {
+    if (id == ARM_SCRIPT_CUSTOM) {
+        if (index < customFrames.size()) {
+            customFrames[index] = frame;
+            return true;
+        }
+        // 只允许在末尾追加
+        return index == customFrames.size() && customFrames.push_back(frame);
+    }
+    
+    ArmScriptInfo info;
+    if (!getArmScriptInfo(id, info) || index >= info.length) {
+        return false;
+    }
+    
+    // 已有覆盖则直接修改
+    for (KeyframeOverride& entry : scriptOverrides) {
+        if (entry.script == id && entry.index == index) {
+            entry.frame = frame;
+            return true;
+        }
+    }
+    
+    KeyframeOverride entry;
+    entry.script = id;
+    entry.index = index;
+    entry.frame = frame;
+    if (!scriptOverrides.push_back(entry)) {
+        Logger::warning("RoboticArm", "关键帧覆盖表已满 (%d)", MAX_SCRIPT_OVERRIDES);
+        return false;
+    }
+    return true;
+}
+
+void RoboticArm::clearScriptOverrides(ArmScriptId id) {
+    if (id == ARM_SCRIPT_CUSTOM) {
+        customFrames.clear();
+        return;
+    }
+    
+    scriptOverrides.remove_if([id](const KeyframeOverride& entry) {
+        return entry.script == id;
+    });
+}
+
+bool RoboticArm::loadScriptToCustom(ArmScriptId id) {
+    if (id >= ARM_SCRIPT_CUSTOM) {
+        return false;
+    }
+    
+    // 先解除替换，确保复制的是Flash脚本（含覆盖）
+    uint16_t savedBindings = customBindings;
+    customBindings = 0;
+    
+    uint8_t length = getScriptLength(id);
+    if (length > CUSTOM_SCRIPT_MAX_FRAMES) {
+        length = CUSTOM_SCRIPT_MAX_FRAMES;
+    }
+    customFrames.resize(length);
+    for (uint8_t i = 0; i < length; i++) {
+        getKeyframe(id, i, customFrames[i]);
+    }
+    
+    customBindings = savedBindings;
+    return true;
+}
+
+bool RoboticArm::bindScriptToCustom(ArmScriptId id, bool bind) {
+    if (id >= ARM_SCRIPT_CUSTOM) {
+        return false;
+    }
+    if (bind) {
+        customBindings |= (1 << id);
+    } else {
+        customBindings &= ~(1 << id);
+    }
+    return true;
+}
+
+void RoboticArm::printScript(ArmScriptId id) {
+    uint8_t length = getScriptLength(id);
+    Logger::info("RoboticArm", "脚本 %s: %d 帧%s", armScriptName(id), length,
+                 (id < ARM_SCRIPT_CUSTOM && (customBindings & (1 << id))) ? " (已替换为CUSTOM)" : "");
+    
+    ArmKeyframe frame;
+    for (uint8_t i = 0; i < length; i++) {
+        if (getKeyframe(id, i, frame)) {
+            Logger::info("RoboticArm", "  [%d] %d %d %d T=%u H=%u", i,
+                         frame.base, frame.arm, frame.claw, frame.transitionMs, frame.holdMs);
+        }
+    }
+}
+
+// 解析关键帧中的位置值，"K"表示保持当前位置
+static int16_t parseJointValue(const char* token) {
+    if (token[0] == 'K' || token[0] == 'k') {
+        return ARM_KEEP;
+    }
+    return (int16_t)atoi(token);
+}
+
+bool RoboticArm::isMotionCommand(const char* command) {
+    if (strncasecmp(command, "ARM", 3) != 0 || command[3] != ' ') {
+        return false;
+    }
+    const char* action = command + 3;
+    while (*action == ' ') {
+        action++;
+    }
+    if (*action == '\0') {
+        return false;
+    }
+    // 只读和停止命令任何时候都允许
+    const char* const allowed[] = { "SHOW", "STOP" };
+    for (uint8_t i = 0; i < 2; i++) {
+        size_t len = strlen(allowed[i]);
+        if (strncasecmp(action, allowed[i], len) == 0 && (action[len] == '\0' || action[len] == ' ')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RoboticArm::handleCommand(const char* command) {
+    // 命令格式:
+    //   ARM PLAY <脚本>                               播放脚本
+    //   ARM STOP                                      停止播放
+    //   ARM SHOW <脚本>                               打印脚本
+    //   ARM SET <脚本> <帧> <底部> <中间> <夹爪> <过渡ms> <保持ms>
+    //                                                 修改关键帧，位置写K表示保持
+    //   ARM CLEAR <脚本>                              清除运行时修改
+    //   ARM LOAD <脚本>                               复制脚本到CUSTOM
+    //   ARM BIND <脚本> / ARM UNBIND <脚本>           播放时改用CUSTOM脚本
+    //   ARM LIMIT <关节0-2> <速度> <加速度>           修改关节速度/加速度上限
+    if (strncasecmp(command, "ARM", 3) != 0 || (command[3] != ' ' && command[3] != '\0')) {
+        return false;
+    }
+    
+    char buffer[64];
+    strncpy(buffer, command, sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = '\0';
+    
+    const uint8_t MAX_TOKENS = 9;
+    char* tokens[MAX_TOKENS];
+    uint8_t count = 0;
+    char* savePtr = nullptr;
+    for (char* token = strtok_r(buffer, " \t\r\n", &savePtr);
+         token != nullptr && count < MAX_TOKENS;
+         token = strtok_r(nullptr, " \t\r\n", &savePtr)) {
+        tokens[count++] = token;
+    }
+    
+    if (count < 2) {
+        Logger::warning("RoboticArm", "ARM命令缺少参数");
+        return true;
+    }
+    
+    const char* action = tokens[1];
+    ArmScriptId id = (count >= 3) ? armScriptFromName(tokens[2]) : ARM_SCRIPT_NONE;
+    
+    if (strcasecmp(action, "STOP") == 0) {
+        stopScript();
+        return true;
+    }
+    
+    if (strcasecmp(action, "LIMIT") == 0) {
+        if (count < 5) {
+            Logger::warning("RoboticArm", "用法: ARM LIMIT <关节0-2> <速度> <加速度>");
+            return true;
+        }
+        setJointLimits(static_cast<ArmJoint>(atoi(tokens[2])), atof(tokens[3]), atof(tokens[4]));
+        return true;
+    }
+    
+    if (id == ARM_SCRIPT_NONE) {
+        Logger::warning("RoboticArm", "未知的脚本名称: %s", count >= 3 ? tokens[2] : "");
+        return true;
+    }
+    
+    if (strcasecmp(action, "PLAY") == 0) {
+        playScript(id);
+    } else if (strcasecmp(action, "SHOW") == 0) {
+        printScript(id);
+    } else if (strcasecmp(action, "SET") == 0) {
+        if (count < 9) {
+            Logger::warning("RoboticArm", "用法: ARM SET <脚本> <帧> <底部> <中间> <夹爪> <过渡ms> <保持ms>");
+            return true;
+        }
+        ArmKeyframe frame;
+        frame.base = parseJointValue(tokens[4]);
+        frame.arm = parseJointValue(tokens[5]);
+        frame.claw = parseJointValue(tokens[6]);
+        frame.transitionMs = (uint16_t)atol(tokens[7]);
+        frame.holdMs = (uint16_t)atol(tokens[8]);
+        if (setKeyframe(id, (uint8_t)atoi(tokens[3]), frame)) {
+            Logger::info("RoboticArm", "已修改脚本 %s 第 %s 帧", armScriptName(id), tokens[3]);
+        } else {
+            Logger::warning("RoboticArm", "修改关键帧失败: %s 第 %s 帧", armScriptName(id), tokens[3]);
+        }
+    } else if (strcasecmp(action, "CLEAR") == 0) {
+        clearScriptOverrides(id);
+    } else if (strcasecmp(action, "LOAD") == 0) {
+        loadScriptToCustom(id);
+    } else if (strcasecmp(action, "BIND") == 0) {
+        bindScriptToCustom(id, true);
+    } else if (strcasecmp(action, "UNBIND") == 0) {
+        bindScriptToCustom(id, false);
+    } else {
+        Logger::warning("RoboticArm", "未知的ARM命令: %s", action);
+    }
+    return true;
 }
 
 bool RoboticArm::isMoving() const {
-    // 在实际应用中，可以根据舵机的反馈来判断机械臂是否在运动
-    // 这里简化处理，直接返回false
-    return false;
-} 
\ No newline at end of file
+    return moving;
+}
+
+unsigned long RoboticArm::getPredictedCompletionTime() const {
+    if (!moving) {
+        return millis();
+    }
+    return moveStartTime + moveDuration + ARM_SETTLE_TIME;
+}
+
+unsigned long RoboticArm::getRemainingMoveTime() const {
+    if (!moving) {
+        return 0;
+    }
+    unsigned long elapsed = millis() - moveStartTime;
+    unsigned long total = moveDuration + ARM_SETTLE_TIME;
+    return (elapsed >= total) ? 0 : total - elapsed;
+}
+
+int RoboticArm::getJointPosition(ArmJoint joint) const {
+    if (joint < 0 || joint >= SERVO_NUM) {
+        return 0;
+    }
+    return currentPositions[joint];
+}
@@ -5,6 +5,15 @@
 #include <Servo.h>
 #include "../Utils/Config.h"
 #include "../Sensor/Ultrasonic.h"
+#include "ArmScripts.h"
+#include "../Utils/StaticVector.h"
+
+// 关节编号
+enum ArmJoint {
+    ARM_JOINT_BASE = 0, // 底部舵机
+    ARM_JOINT_ARM  = 1, // 中间舵机
+    ARM_JOINT_CLAW = 2  // 夹爪舵机
+};
 
 class RoboticArm {
 private:
@@ -18,13 +27,69 @@ private:
     // 舵机初始位置（微秒）
     int servo_initial_pos[SERVO_NUM] = {1500, 900, 600};
     
-    // 当前位置
+    // 当前位置（轨迹插补后实际写入舵机的值）
     int currentPositions[SERVO_NUM];
     
     bool isCalibrated;  // 是否已校准
     
-    // 舵机控制函数
-    void servoControl(int angle_base, int angle_arm, int angle_claw);
+    // 单关节梯形速度轨迹
+    struct JointTrajectory {
+        int startPos;        // 起点（微秒）
+        int targetPos;       // 终点（微秒）
+        float maxVelocity;   // 速度上限（微秒/秒）
+        float maxAccel;      // 加速度上限（微秒/秒²）
+        float accelTime;     // 本次运动加速段时长（毫秒）
+        float accel;         // 本次运动实际加速度（微秒/毫秒²）
+    };
+    JointTrajectory trajectories[SERVO_NUM];
+    
+    unsigned long moveStartTime; // 本次运动开始时间
+    unsigned long moveDuration;  // 本次运动轨迹时长（毫秒，不含稳定时间）
+    bool moving;                 // 是否有轨迹正在执行
+    
+    // --- 关键帧脚本解释器 ---
+    static const uint8_t MAX_SCRIPT_OVERRIDES = 8;      // 运行时可覆盖的关键帧数量
+    static const uint8_t CUSTOM_SCRIPT_MAX_FRAMES = 8;  // 自定义脚本最大帧数
+    
+    // 运行时覆盖的关键帧（用于串口调参，不需重新烧录）
+    struct KeyframeOverride {
+        uint8_t script;
+        uint8_t index;
+        ArmKeyframe frame;
+    };
+    StaticVector<KeyframeOverride, MAX_SCRIPT_OVERRIDES> scriptOverrides;
+    
+    StaticVector<ArmKeyframe, CUSTOM_SCRIPT_MAX_FRAMES> customFrames; // 自定义脚本（RAM）
+    uint16_t customBindings;   // 位图：播放时被替换为自定义脚本的脚本
+    
+    ArmScriptId activeScript;  // 正在播放的脚本，ARM_SCRIPT_NONE表示空闲
+    uint8_t scriptFrame;       // 当前关键帧序号
+    uint8_t scriptLength;      // 当前脚本帧数
+    uint16_t scriptHoldMs;     // 当前关键帧的保持时间
+    bool scriptHolding;        // 是否处于保持阶段
+    unsigned long holdStartTime;
+    
+    // 获取脚本的有效帧数/关键帧（已考虑替换与覆盖）
+    uint8_t getScriptLength(ArmScriptId id) const;
+    bool getKeyframe(ArmScriptId id, uint8_t index, ArmKeyframe& frame) const;
+    
+    // 开始执行一个关键帧
+    void startKeyframe(const ArmKeyframe& frame);
+    
+    // 推进脚本播放
+    void updateScript();
+    
+    // 舵机控制函数：规划一条到目标位置的轨迹（非阻塞）
+    void servoControl(int angle_base, int angle_arm, int angle_claw, unsigned long minDurationMs = 0);
+    
+    // 按速度/加速度上限计算单关节最短运动时间（毫秒）
+    static float minimumMoveTime(float distance, float maxVelocity, float maxAccel);
+    
+    // 计算关节在轨迹上某一时刻的位置
+    int sampleJoint(const JointTrajectory& traj, float elapsedMs) const;
+    
+    // 阻塞等待当前运动完成（供兼容的阻塞接口使用）
+    void waitForMove();
     
 public:
     RoboticArm();
@@ -32,6 +97,9 @@ public:
     // 初始化机械臂
     void init();
     
+    // 轨迹插补更新，需在主循环中周期调用
+    void update();
+    
     // 校准机械臂
     void calibrate();
     
@@ -60,14 +128,80 @@ public:
     // 机械臂放置到物料盒位置
     void moveToBox();
     
-    // 机械臂调整角度
+    // 机械臂调整角度（阻塞，到位即返回）
     void adjustArm(int baseAngle, int armAngle, int clawAngle);
     
-    // 判断机械臂是否处于运动中
+    // 非阻塞运动到目标位置，由update()推进
+    // minDurationMs: 最短运动时长，为0时按各关节速度/加速度上限以最快速度到达
+    void moveTo(int baseAngle, int armAngle, int clawAngle, unsigned long minDurationMs = 0);
+    
+    // 设置单个关节的速度（微秒/秒）与加速度（微秒/秒²）上限
+    void setJointLimits(ArmJoint joint, float maxVelocity, float maxAccel);
+    
+    // 立即停止当前轨迹，保持在当前位置
+    void stopMotion();
+    
+    // 判断机械臂是否处于运动中（轨迹未执行完或尚在稳定时间内）
     bool isMoving() const;
+    
+    // 预计运动完成时刻（millis()时间戳），空闲时返回当前时间
+    unsigned long getPredictedCompletionTime() const;
+    
+    // 距离运动完成的剩余时间（毫秒）
+    unsigned long getRemainingMoveTime() const;
+    
+    // 获取关节当前位置（微秒）
+    int getJointPosition(ArmJoint joint) const;
+
+    // --- 关键帧脚本 ---
+    // 非阻塞播放脚本，由update()推进；startFrame可跳过已完成的前几帧
+    void playScript(ArmScriptId id, uint8_t startFrame = 0);
+    
+    // 阻塞播放脚本直到完成
+    void runScript(ArmScriptId id);
+    
+    // 停止脚本播放（当前轨迹同时停止）
+    void stopScript();
+    
+    // 是否有脚本正在播放
+    bool isScriptRunning() const;
+    
+    // 获取正在播放的脚本及关键帧序号
+    ArmScriptId getActiveScript() const;
+    uint8_t getScriptFrame() const;
+    
+    // 在运行时修改脚本的关键帧；对CUSTOM脚本，index等于当前长度时追加一帧
+    bool setKeyframe(ArmScriptId id, uint8_t index, const ArmKeyframe& frame);
+    
+    // 清除脚本的运行时修改（CUSTOM脚本则清空）
+    void clearScriptOverrides(ArmScriptId id);
+    
+    // 将脚本复制到CUSTOM脚本以便编辑
+    bool loadScriptToCustom(ArmScriptId id);
+    
+    // 播放指定脚本时改用CUSTOM脚本（bind=false恢复Flash中的脚本）
+    bool bindScriptToCustom(ArmScriptId id, bool bind);
+    
+    // 打印脚本内容
+    void printScript(ArmScriptId id);
+    
+    // 处理"ARM ..."串口命令，非ARM命令返回false
+    bool handleCommand(const char* command);
+    
+    // 是否为会驱动机械臂或修改脚本的ARM命令（SHOW、STOP以外），任务运行中不应执行
+    static bool isMotionCommand(const char* command);
 
     // 检查是否满足抓取条件
     bool checkGrabCondition();
+    
+    // 读取前方物块距离（cm）
+    float getObjectDistance();
+    
+    // 判断距离是否处于抓取窗口内
+    static bool isGrabDistance(float distance);
+    
+    // 非阻塞移动到预抓取姿态（GRAB脚本第0帧），之后可从第1帧继续播放GRAB
+    void moveToPreGrasp();
 };
 
-#endif // ROBOTIC_ARM_H 
\ No newline at end of file
+#endif // ROBOTIC_ARM_H 
@@ -0,0 +1,97 @@
+#include "ColorIdentifier.h"
+#include "../Utils/Logger.h"
+
+ColorIdentifier::ColorIdentifier(SensorManager& sm)
+    : m_sensorManager(sm)
+    , m_active(false)
+    , m_startTime(0)
+    , m_lastSeq(0)
+    , m_samples(0)
+    , m_streakColor(COLOR_UNKNOWN)
+    , m_streak(0)
+    , m_confidenceSum(0)
+    , m_result(COLOR_UNKNOWN)
+{
+    memset(m_votes, 0, sizeof(m_votes));
+}
+
+void ColorIdentifier::start() {
+    m_active = true;
+    m_startTime = millis();
+    // 只使用开始之后的读数（抓取前的读数不是物块）
+    m_lastSeq = m_sensorManager.getColorSampleSeq();
+    m_samples = 0;
+    m_streakColor = COLOR_UNKNOWN;
+    m_streak = 0;
+    m_confidenceSum = 0;
+    m_result = COLOR_UNKNOWN;
+    memset(m_votes, 0, sizeof(m_votes));
+}
+
+bool ColorIdentifier::update() {
+    if (!m_active) {
+        return true;
+    }
+    // 传感器未响应或I2C持续失败时没有新读数，不能无限等待
+    if (millis() - m_startTime >= COLOR_ID_TIMEOUT_MS) {
+        m_active = false;
+        Logger::warning("ColorID", "%lu ms 内未能确认颜色（%d 次采样），得票最多: %d",
+                        (unsigned long)COLOR_ID_TIMEOUT_MS, m_samples, getMajorityColor());
+        return true;
+    }
+    
+    uint16_t seq = m_sensorManager.getColorSampleSeq();
+    if (seq == m_lastSeq) {
+        return false;
+    }
+    m_lastSeq = seq;
+    
+    ColorSample sample;
+    if (!m_sensorManager.getLatestColorSample(sample)) {
+        return false;
+    }
+    m_samples++;
+    
+    ColorCode color = sample.color;
+    uint8_t confidence = sample.confidence;
+    if (color == COLOR_UNKNOWN || confidence < COLOR_MIN_CONFIDENCE) {
+        // 低置信度读数打断连续计数
+        m_streak = 0;
+        m_streakColor = COLOR_UNKNOWN;
+    } else {
+        m_votes[color]++;
+        if (color == m_streakColor) {
+            m_streak++;
+            m_confidenceSum += confidence;
+        } else {
+            m_streakColor = color;
+            m_streak = 1;
+            m_confidenceSum = confidence;
+        }
+        
+        if (m_streak >= COLOR_ID_STABLE_SAMPLES) {
+            m_result = color;
+            m_active = false;
+            Logger::info("ColorID", "识别为颜色%d（%d 次采样，平均置信度 %d%%）",
+                         color, m_samples, m_confidenceSum / m_streak);
+            return true;
+        }
+    }
+    
+    if (m_samples >= COLOR_ID_MAX_SAMPLES) {
+        m_active = false;
+        Logger::warning("ColorID", "%d 次采样未能确认颜色，得票最多: %d", m_samples, getMajorityColor());
+        return true;
+    }
+    return false;
+}
+
+ColorCode ColorIdentifier::getMajorityColor() const {
+    uint8_t best = COLOR_UNKNOWN;
+    for (uint8_t i = COLOR_UNKNOWN + 1; i < COLOR_COUNT; i++) {
+        if (m_votes[i] > m_votes[best]) {
+            best = i;
+        }
+    }
+    return static_cast<ColorCode>(best);
+}
@@ -0,0 +1,49 @@
+#ifndef COLOR_IDENTIFIER_H
+#define COLOR_IDENTIFIER_H
+
+#include <Arduino.h>
+#include "../Utils/Config.h"
+#include "../Sensor/SensorManager.h"
+
+/**
+ * 抓取后识别夹爪中物块的颜色（非阻塞）
+ * 
+ * 读取SensorManager后台采样的读数（需已启用setColorSampling），每个新读数处理一次，
+ * 置信度低于 COLOR_MIN_CONFIDENCE 的读数不计入；
+ * 连续 COLOR_ID_STABLE_SAMPLES 次读到同一颜色即确认（去抖，排除夹爪晃动时的过渡读数）。
+ * 采样 COLOR_ID_MAX_SAMPLES 次或超过 COLOR_ID_TIMEOUT_MS 仍未确认则放弃，由调用者改为等待ESP32手动输入，
+ * 此时 getMajorityColor() 给出得票最多的颜色作为最后的兜底。
+ */
+class ColorIdentifier {
+public:
+    explicit ColorIdentifier(SensorManager& sm);
+    
+    // 开始一次识别
+    void start();
+    
+    // 在主循环中调用，有新读数时处理；识别结束（确认或放弃）返回true
+    bool update();
+    
+    bool isIdentified() const { return m_result != COLOR_UNKNOWN; }
+    ColorCode getColor() const { return m_result; }
+    
+    // 得票最多的颜色，没有有效读数时为COLOR_UNKNOWN
+    ColorCode getMajorityColor() const;
+    
+    uint8_t getSampleCount() const { return m_samples; }
+    
+private:
+    SensorManager& m_sensorManager;
+    
+    bool m_active;
+    unsigned long m_startTime;       // start()的时间，用于超时
+    uint16_t m_lastSeq;              // 已处理的采样序号
+    uint8_t m_samples;               // 已处理的读数个数（含无效读数）
+    ColorCode m_streakColor;         // 当前连续读到的颜色
+    uint8_t m_streak;
+    uint8_t m_votes[COLOR_COUNT];    // 各颜色的有效读数次数
+    uint16_t m_confidenceSum;        // 当前连续读数的置信度之和，用于日志
+    ColorCode m_result;
+};
+
+#endif // COLOR_IDENTIFIER_H
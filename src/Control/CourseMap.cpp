@@ -0,0 +1,280 @@
+#include "CourseMap.h"
+#include <avr/pgmspace.h>
+
+#define N_ COURSE_NO_NODE
+
+/**
+ * 场地拓扑（单位：厘米）
+ * 
+ *        P3 ---- J3
+ *                |
+ *        P2 ---- J2
+ *                |
+ *        P1 ---- J1
+ *                |
+ *                J0 ---- C1 ---- C2 ---- C3 ---- C4 ---- C5
+ *                |       |       |       |       |       |
+ *               BASE     Z1      Z2      Z3      Z4      Z5
+ * 
+ * - 取物区P1-P3在主干左侧（西），从基地出发依次经过
+ * - 放置区Z1-Z5由J0向东的支线依次排列（颜色对应关系见MissionScheduler）
+ * - 基地边界线在返回时被识别为正T字路口
+ * 边长为估计值，换场地时按实测修改。
+ */
+enum {
+    NODE_BASE_ID, NODE_J0, NODE_J1, NODE_J2, NODE_J3,
+    NODE_P1, NODE_P2, NODE_P3,
+    NODE_C1, NODE_C2, NODE_C3, NODE_C4, NODE_C5,
+    NODE_Z1, NODE_Z2, NODE_Z3, NODE_Z4, NODE_Z5,
+    COURSE_NODE_COUNT
+};
+
+static_assert(COURSE_NODE_COUNT <= COURSE_MAX_NODES, "节点数超过COURSE_MAX_NODES");
+static_assert(COURSE_MAX_NODES <= 32, "visited位图只支持32个节点");
+
+static const CourseNode COURSE_NODES[COURSE_NODE_COUNT] PROGMEM = {
+    //  类别           编号  北        东        南           西          北  东  南  西   死路识别
+    { NODE_BASE,     0, { NODE_J0, N_,       N_,          N_       }, { 60,  0,  0,  0 }, T_FORWARD   }, // BASE
+    { NODE_JUNCTION, 0, { NODE_J1, NODE_C1,  NODE_BASE_ID, N_      }, { 50, 40, 60,  0 }, NO_JUNCTION }, // J0
+    { NODE_JUNCTION, 1, { NODE_J2, N_,       NODE_J0,     NODE_P1  }, { 50,  0, 50, 40 }, NO_JUNCTION }, // J1
+    { NODE_JUNCTION, 2, { NODE_J3, N_,       NODE_J1,     NODE_P2  }, { 50,  0, 50, 40 }, NO_JUNCTION }, // J2
+    { NODE_JUNCTION, 3, { N_,      N_,       NODE_J2,     NODE_P3  }, {  0,  0, 50, 40 }, NO_JUNCTION }, // J3
+    { NODE_PICKUP,   1, { N_,      NODE_J1,  N_,          N_       }, {  0, 40,  0,  0 }, NO_JUNCTION }, // P1
+    { NODE_PICKUP,   2, { N_,      NODE_J2,  N_,          N_       }, {  0, 40,  0,  0 }, NO_JUNCTION }, // P2
+    { NODE_PICKUP,   3, { N_,      NODE_J3,  N_,          N_       }, {  0, 40,  0,  0 }, NO_JUNCTION }, // P3
+    { NODE_JUNCTION, 0, { N_,      NODE_C2,  NODE_Z1,     NODE_J0  }, {  0, 30, 35, 40 }, NO_JUNCTION }, // C1
+    { NODE_JUNCTION, 0, { N_,      NODE_C3,  NODE_Z2,     NODE_C1  }, {  0, 30, 35, 30 }, NO_JUNCTION }, // C2
+    { NODE_JUNCTION, 0, { N_,      NODE_C4,  NODE_Z3,     NODE_C2  }, {  0, 30, 35, 30 }, NO_JUNCTION }, // C3
+    { NODE_JUNCTION, 0, { N_,      NODE_C5,  NODE_Z4,     NODE_C3  }, {  0, 30, 35, 30 }, NO_JUNCTION }, // C4
+    { NODE_JUNCTION, 0, { N_,      N_,       NODE_Z5,     NODE_C4  }, {  0,  0, 35, 30 }, NO_JUNCTION }, // C5
+    { NODE_DROP,     1, { NODE_C1, N_,       N_,          N_       }, { 35,  0,  0,  0 }, NO_JUNCTION }, // Z1
+    { NODE_DROP,     2, { NODE_C2, N_,       N_,          N_       }, { 35,  0,  0,  0 }, NO_JUNCTION }, // Z2
+    { NODE_DROP,     3, { NODE_C3, N_,       N_,          N_       }, { 35,  0,  0,  0 }, NO_JUNCTION }, // Z3
+    { NODE_DROP,     4, { NODE_C4, N_,       N_,          N_       }, { 35,  0,  0,  0 }, NO_JUNCTION }, // Z4
+    { NODE_DROP,     5, { NODE_C5, N_,       N_,          N_       }, { 35,  0,  0,  0 }, NO_JUNCTION }  // Z5
+};
+
+void CourseMap::loadNode(uint8_t index, CourseNode& node) {
+    memcpy_P(&node, &COURSE_NODES[index], sizeof(CourseNode));
+}
+
+uint8_t CourseMap::getNodeCount() {
+    return COURSE_NODE_COUNT;
+}
+
+uint8_t CourseMap::findNode(CourseNodeKind kind, uint8_t tag) {
+    CourseNode node;
+    for (uint8_t i = 0; i < COURSE_NODE_COUNT; i++) {
+        loadNode(i, node);
+        if (node.kind == kind && (kind == NODE_BASE || node.tag == tag)) {
+            return i;
+        }
+    }
+    return COURSE_NO_NODE;
+}
+
+JunctionType CourseMap::junctionTypeAt(uint8_t node, uint8_t heading) {
+    if (node >= COURSE_NODE_COUNT) {
+        return NO_JUNCTION;
+    }
+    
+    CourseNode info;
+    loadNode(node, info);
+    
+    bool left = info.neighbor[(heading + ROUTE_LEFT) & 3] != COURSE_NO_NODE;
+    bool straight = info.neighbor[heading & 3] != COURSE_NO_NODE;
+    bool right = info.neighbor[(heading + ROUTE_RIGHT) & 3] != COURSE_NO_NODE;
+    
+    if (!left && !straight && !right) {
+        // 死路：取决于终点处的实际标线
+        return static_cast<JunctionType>(info.detectedAs);
+    }
+    return junctionTypeFromExits(left, straight, right);
+}
+
+JunctionType CourseMap::junctionTypeFromExits(bool left, bool straight, bool right) {
+    if (left && straight && right) return CROSS;
+    if (left && straight) return T_LEFT;
+    if (straight && right) return T_RIGHT;
+    if (left && right) return T_FORWARD;
+    if (left) return LEFT_TURN;
+    if (right) return RIGHT_TURN;
+    return NO_JUNCTION;   // 直线上的中间点不会触发路口检测
+}
+
+bool CourseMap::isTurnAvailable(JunctionType detected, RouteTurn turn) {
+    switch (turn) {
+        case ROUTE_STRAIGHT:
+            return detected == T_LEFT || detected == T_RIGHT || detected == CROSS;
+        case ROUTE_LEFT:
+            return detected == T_LEFT || detected == LEFT_TURN || detected == T_FORWARD || detected == CROSS;
+        case ROUTE_RIGHT:
+            return detected == T_RIGHT || detected == RIGHT_TURN || detected == T_FORWARD || detected == CROSS;
+        case ROUTE_UTURN:
+        case ROUTE_ARRIVE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void CourseMap::shortestPaths(uint8_t from, uint8_t to, uint16_t* dist, uint8_t* prev) {
+    // Dijkstra（节点少，直接O(V²)扫描，不需要优先队列）
+    uint32_t visited = 0;
+    for (uint8_t i = 0; i < COURSE_NODE_COUNT; i++) {
+        dist[i] = COURSE_UNREACHABLE;
+        prev[i] = COURSE_NO_NODE;
+    }
+    dist[from] = 0;
+    
+    CourseNode node;
+    for (uint8_t iter = 0; iter < COURSE_NODE_COUNT; iter++) {
+        uint8_t current = COURSE_NO_NODE;
+        for (uint8_t i = 0; i < COURSE_NODE_COUNT; i++) {
+            if (!(visited & ((uint32_t)1 << i)) && dist[i] != COURSE_UNREACHABLE &&
+                (current == COURSE_NO_NODE || dist[i] < dist[current])) {
+                current = i;
+            }
+        }
+        if (current == COURSE_NO_NODE || current == to) {
+            break;
+        }
+        visited |= (uint32_t)1 << current;
+        
+        loadNode(current, node);
+        for (uint8_t dir = 0; dir < 4; dir++) {
+            uint8_t next = node.neighbor[dir];
+            if (next == COURSE_NO_NODE) {
+                continue;
+            }
+            uint16_t candidate = dist[current] + node.length[dir];
+            if (candidate < dist[next]) {
+                dist[next] = candidate;
+                prev[next] = current;
+            }
+        }
+    }
+}
+
+void CourseMap::distancesFrom(uint8_t from, uint16_t* dist) {
+    uint8_t prev[COURSE_NODE_COUNT];
+    for (uint8_t i = 0; i < COURSE_MAX_NODES; i++) {
+        dist[i] = COURSE_UNREACHABLE;
+    }
+    if (from < COURSE_NODE_COUNT) {
+        shortestPaths(from, COURSE_NO_NODE, dist, prev);
+    }
+}
+
+uint16_t CourseMap::distance(uint8_t from, uint8_t to) {
+    if (from >= COURSE_NODE_COUNT || to >= COURSE_NODE_COUNT) {
+        return COURSE_UNREACHABLE;
+    }
+    uint16_t dist[COURSE_NODE_COUNT];
+    uint8_t prev[COURSE_NODE_COUNT];
+    shortestPaths(from, to, dist, prev);
+    return dist[to];
+}
+
+bool CourseMap::planRoute(uint8_t from, uint8_t to, CourseRoute& route, uint16_t* totalLength) {
+    route.clear();
+    if (from >= COURSE_NODE_COUNT || to >= COURSE_NODE_COUNT) {
+        return false;
+    }
+    
+    uint16_t dist[COURSE_NODE_COUNT];
+    uint8_t prev[COURSE_NODE_COUNT];
+    shortestPaths(from, to, dist, prev);
+    
+    if (dist[to] == COURSE_UNREACHABLE) {
+        return false;
+    }
+    if (totalLength) {
+        *totalLength = dist[to];
+    }
+    
+    CourseNode node;
+    
+    // 回溯得到节点序列（倒序）
+    StaticVector<uint8_t, COURSE_NODE_COUNT> path;
+    for (uint8_t n = to; n != COURSE_NO_NODE; n = prev[n]) {
+        path.push_back(n);
+    }
+    
+    // 依次计算每个中间节点（及可识别的终点）的到达方向与转向
+    uint8_t arrivalHeading = 0;
+    for (int8_t i = path.size() - 1; i > 0; i--) {
+        uint8_t fromNode = path[i];
+        uint8_t atNode = path[i - 1];
+        
+        loadNode(fromNode, node);
+        for (uint8_t dir = 0; dir < 4; dir++) {
+            if (node.neighbor[dir] == atNode) {
+                arrivalHeading = dir;
+                break;
+            }
+        }
+        
+        RouteStep step;
+        step.node = atNode;
+        step.expected = junctionTypeAt(atNode, arrivalHeading);
+        step.turn = ROUTE_ARRIVE;
+        
+        if (i > 1) {
+            uint8_t nextNode = path[i - 2];
+            loadNode(atNode, node);
+            for (uint8_t dir = 0; dir < 4; dir++) {
+                if (node.neighbor[dir] == nextNode) {
+                    step.turn = (dir - arrivalHeading) & 3;
+                    break;
+                }
+            }
+        }
+        
+        // 直线上的中间点与不可识别的终点不会触发路口事件
+        if (step.expected == NO_JUNCTION) {
+            continue;
+        }
+        if (!route.push_back(step)) {
+            route.clear();
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+const char* CourseMap::nodeName(uint8_t node, char* buffer, size_t size) {
+    if (node >= COURSE_NODE_COUNT) {
+        snprintf(buffer, size, "?");
+        return buffer;
+    }
+    
+    CourseNode info;
+    loadNode(node, info);
+    switch (info.kind) {
+        case NODE_BASE:   snprintf(buffer, size, "BASE"); break;
+        case NODE_PICKUP: snprintf(buffer, size, "P%d", info.tag); break;
+        case NODE_DROP:   snprintf(buffer, size, "Z%d", info.tag); break;
+        default:
+            // 主干路口按J编号，放置区支线路口按C编号
+            if (node >= NODE_C1 && node <= NODE_C5) {
+                snprintf(buffer, size, "C%d", node - NODE_C1 + 1);
+            } else {
+                snprintf(buffer, size, "J%d", info.tag);
+            }
+            break;
+    }
+    return buffer;
+}
+
+const char* CourseMap::turnName(RouteTurn turn) {
+    switch (turn) {
+        case ROUTE_STRAIGHT: return "直行";
+        case ROUTE_RIGHT:    return "右转";
+        case ROUTE_UTURN:    return "掉头";
+        case ROUTE_LEFT:     return "左转";
+        case ROUTE_ARRIVE:   return "到达";
+        default:             return "?";
+    }
+}
@@ -0,0 +1,105 @@
+#ifndef COURSE_MAP_H
+#define COURSE_MAP_H
+
+#include <Arduino.h>
+#include "../Utils/Config.h"
+#include "../Utils/StaticVector.h"
+
+/**
+ * 赛道拓扑图与最短路径规划
+ * 
+ * 赛道按直角网格建模：每个节点最多有东南西北四个出口，沿边行驶时车头方向不变，
+ * 弯道也作为节点（只有一个转向出口）。节点表存放在Flash中（CourseMap.cpp），
+ * 更换场地时只需修改该表。
+ */
+
+#define COURSE_NO_NODE          0xFF
+#define COURSE_MAX_NODES        24
+#define COURSE_MAX_ROUTE_STEPS  16
+#define COURSE_UNREACHABLE      0xFFFF
+
+// 绝对方向（顺时针编号，便于计算相对转向）
+enum CourseHeading {
+    HEADING_NORTH = 0,
+    HEADING_EAST  = 1,
+    HEADING_SOUTH = 2,
+    HEADING_WEST  = 3
+};
+
+// 节点类别
+enum CourseNodeKind {
+    NODE_JUNCTION, // 普通路口/弯道
+    NODE_BASE,     // 基地入口
+    NODE_PICKUP,   // 取物区终点，tag为区域编号(1起)
+    NODE_DROP      // 放置区终点，tag为放置区编号(1起)，颜色与放置区的对应见MissionScheduler
+};
+
+// 路口处的转向动作（数值等于出口方向相对车头方向的顺时针差值）
+enum RouteTurn {
+    ROUTE_STRAIGHT = 0,
+    ROUTE_RIGHT    = 1,
+    ROUTE_UTURN    = 2,
+    ROUTE_LEFT     = 3,
+    ROUTE_ARRIVE   = 4   // 到达终点（终点处的标线被识别为路口）
+};
+
+// 节点定义（PROGMEM）
+struct CourseNode {
+    uint8_t kind;          // CourseNodeKind
+    uint8_t tag;           // 区域编号或颜色编码
+    uint8_t neighbor[4];   // 各方向相邻节点，COURSE_NO_NODE表示无出口
+    uint8_t length[4];     // 各方向边长（厘米）
+    uint8_t detectedAs;    // 死路节点被识别成的路口类型，NO_JUNCTION表示不会触发路口检测
+};
+
+// 路线中的一步：到达某个路口时应执行的动作
+struct RouteStep {
+    uint8_t node;          // 路口节点
+    uint8_t turn;          // RouteTurn
+    uint8_t expected;      // 按地图应检测到的路口类型（JunctionType）
+};
+
+typedef StaticVector<RouteStep, COURSE_MAX_ROUTE_STEPS> CourseRoute;
+
+class CourseMap {
+public:
+    // 节点数量
+    static uint8_t getNodeCount();
+    
+    // 按类别与编号查找节点，找不到返回COURSE_NO_NODE
+    static uint8_t findNode(CourseNodeKind kind, uint8_t tag);
+    
+    // 规划from到to的最短路线，生成沿途每个路口的转向动作
+    // 出发时车头已朝向路线第一条边（死路起点由调用方先掉头）
+    // totalLength可选，返回路线总长（厘米）
+    static bool planRoute(uint8_t from, uint8_t to, CourseRoute& route, uint16_t* totalLength = nullptr);
+    
+    // 计算from到所有节点的最短距离（厘米），dist至少COURSE_MAX_NODES个元素，不可达为COURSE_UNREACHABLE
+    static void distancesFrom(uint8_t from, uint16_t* dist);
+    
+    // from到to的最短距离，不可达返回COURSE_UNREACHABLE
+    static uint16_t distance(uint8_t from, uint8_t to);
+    
+    // 以heading方向到达节点时，按地图应检测到的路口类型
+    static JunctionType junctionTypeAt(uint8_t node, uint8_t heading);
+    
+    // 由左/直/右三个方向是否有出口得到路口类型（不含来路）
+    static JunctionType junctionTypeFromExits(bool left, bool straight, bool right);
+    
+    // 实际检测到的路口类型是否允许执行该转向
+    static bool isTurnAvailable(JunctionType detected, RouteTurn turn);
+    
+    // 节点名称（如 "J0"、"P2"、"Z3"），写入buffer
+    static const char* nodeName(uint8_t node, char* buffer, size_t size);
+    
+    // 转向动作名称
+    static const char* turnName(RouteTurn turn);
+    
+private:
+    static void loadNode(uint8_t index, CourseNode& node);
+    
+    // Dijkstra，to为COURSE_NO_NODE时计算到所有节点的距离
+    static void shortestPaths(uint8_t from, uint8_t to, uint16_t* dist, uint8_t* prev);
+};
+
+#endif // COURSE_MAP_H
@@ -1,7 +1,22 @@
 #include "LineDetector.h"
 #include "../Utils/Logger.h"
+#include "CourseMap.h"
 
-LineDetector::LineDetector() {
+LineDetector::LineDetector()
+    : m_rollingTrigger(LineFollower::TRIGGER_NONE)
+    , m_rollingFrames(0)
+    , m_leftArmRun(0)
+    , m_rightArmRun(0)
+    , m_leftArmMax(0)
+    , m_rightArmMax(0)
+    , m_crossedLine(false)
+    , m_tailFrames(0)
+    , m_tailHistory(0)
+    , m_voteFrames(0)
+    , m_voteLastMask(0)
+    , m_voteAgreeRun(0)
+{
+    memset(m_voteBlack, 0, sizeof(m_voteBlack));
     // 简化构造函数，移除状态机相关变量
 }
 
@@ -27,9 +42,7 @@ bool LineDetector::isForwardTee(const uint16_t* sensorValues) {
     }
     
     char sensorStr[40];
-    snprintf(sensorStr, sizeof(sensorStr), "[%d%d%d%d%d%d%d%d]",
-             sensorValues[0], sensorValues[1], sensorValues[2], sensorValues[3],
-             sensorValues[4], sensorValues[5], sensorValues[6], sensorValues[7]);
+    InfraredArray::formatValues(sensorValues, sensorStr, sizeof(sensorStr));
     
     Logger::debug("LineDet", "isForwardTee检查: 传感器=%s -> 结果=%s", 
                  sensorStr, allBlack ? "是" : "否");
@@ -58,9 +71,7 @@ JunctionType LineDetector::classifyStoppedJunction(const uint16_t* staticSensorV
     
     // 格式化传感器数组为字符串用于日志
     char sensorStr[40];
-    snprintf(sensorStr, sizeof(sensorStr), "[%d%d%d%d%d%d%d%d]",
-             staticSensorValues[0], staticSensorValues[1], staticSensorValues[2], staticSensorValues[3],
-             staticSensorValues[4], staticSensorValues[5], staticSensorValues[6], staticSensorValues[7]);
+    InfraredArray::formatValues(staticSensorValues, sensorStr, sizeof(sensorStr));
     
     // 记录分类开始的日志
     Logger::debug("LineDet", "静态分类: 传感器=%s, 触发类型=%d, 中心模式=%s, 全白=%s",
@@ -103,3 +114,136 @@ JunctionType LineDetector::classifyStoppedJunction(const uint16_t* staticSensorV
     return resultJunctionType;
 }
 
+// 开始行进中分类
+void LineDetector::beginRolling(LineFollower::TriggerType triggerType) {
+    m_rollingTrigger = triggerType;
+    m_rollingFrames = 0;
+    m_leftArmRun = 0;
+    m_rightArmRun = 0;
+    m_leftArmMax = 0;
+    m_rightArmMax = 0;
+    m_crossedLine = false;
+    m_tailFrames = 0;
+    m_tailHistory = 0;
+}
+
+// 累积一帧：记录两侧分支的持续长度，以及越过横线后中间是否仍有线
+void LineDetector::addRollingFrame(const uint16_t* sensorValues) {
+    bool leftArm = (sensorValues[0] == 0 && sensorValues[1] == 0);
+    bool rightArm = (sensorValues[6] == 0 && sensorValues[7] == 0);
+    bool centerBlack = (sensorValues[3] == 0 || sensorValues[4] == 0);
+    
+    if (m_rollingFrames < 255) {
+        m_rollingFrames++;
+    }
+    
+    m_leftArmRun = leftArm ? m_leftArmRun + 1 : 0;
+    m_rightArmRun = rightArm ? m_rightArmRun + 1 : 0;
+    if (m_leftArmRun > m_leftArmMax) m_leftArmMax = m_leftArmRun;
+    if (m_rightArmRun > m_rightArmMax) m_rightArmMax = m_rightArmRun;
+    
+    if (!leftArm && !rightArm && (m_leftArmMax > 0 || m_rightArmMax > 0)) {
+        m_crossedLine = true;
+    }
+    
+    // 只统计越过横线后的最近几帧
+    if (m_crossedLine && !leftArm && !rightArm) {
+        m_tailHistory = (uint8_t)((m_tailHistory << 1) | (centerBlack ? 1 : 0));
+        if (m_tailFrames < NAV_ROLLING_TAIL_FRAMES) {
+            m_tailFrames++;
+        }
+    }
+}
+
+// 根据累积特征分类
+JunctionType LineDetector::classifyRolling(float& confidence) const {
+    confidence = 0.0f;
+    if (m_rollingFrames < NAV_ROLLING_MIN_FRAMES || m_tailFrames < NAV_ROLLING_TAIL_FRAMES) {
+        Logger::debug("LineDet", "行进中分类: 帧数不足 (总%d, 越线后%d)", m_rollingFrames, m_tailFrames);
+        return NO_JUNCTION;
+    }
+    
+    // 分支：达到连续帧数视为存在；只出现一两帧时不确定
+    bool left = m_leftArmMax >= NAV_ROLLING_ARM_FRAMES;
+    bool right = m_rightArmMax >= NAV_ROLLING_ARM_FRAMES;
+    float leftConf = left ? 1.0f : 1.0f - (float)m_leftArmMax / NAV_ROLLING_ARM_FRAMES;
+    float rightConf = right ? 1.0f : 1.0f - (float)m_rightArmMax / NAV_ROLLING_ARM_FRAMES;
+    
+    // 直行：越线后中间传感器为黑的比例
+    uint8_t centerBlack = 0;
+    for (uint8_t i = 0; i < m_tailFrames; i++) {
+        centerBlack += (m_tailHistory >> i) & 1;
+    }
+    float ratio = (float)centerBlack / m_tailFrames;
+    bool straight = ratio >= 0.5f;
+    float straightConf = fabs(ratio * 2.0f - 1.0f);
+    
+    confidence = min(leftConf, min(rightConf, straightConf));
+    
+    // 触发侧必须有分支
+    if ((m_rollingTrigger == LineFollower::TRIGGER_LEFT_EDGE && !left) ||
+        (m_rollingTrigger == LineFollower::TRIGGER_RIGHT_EDGE && !right)) {
+        confidence = 0.0f;
+    }
+    
+    JunctionType type = CourseMap::junctionTypeFromExits(left, straight, right);
+    
+    Logger::debug("LineDet", "行进中分类: 左%d 右%d 直行%d/%d -> 路口类型=%d, 置信度=%.2f",
+                 m_leftArmMax, m_rightArmMax, centerBlack, m_tailFrames, type, confidence);
+    return type;
+}
+
+// 开始多帧投票
+void LineDetector::beginVote() {
+    m_voteFrames = 0;
+    memset(m_voteBlack, 0, sizeof(m_voteBlack));
+    m_voteLastMask = 0;
+    m_voteAgreeRun = 0;
+}
+
+// 累积一帧
+void LineDetector::addVoteFrame(const uint16_t* sensorValues) {
+    if (m_voteFrames == 255) {
+        return;
+    }
+    
+    uint8_t mask = 0;
+    for (int i = 0; i < 8; i++) {
+        if (sensorValues[i] == 0) {
+            mask |= (1 << i);
+            m_voteBlack[i]++;
+        }
+    }
+    
+    m_voteAgreeRun = (m_voteFrames > 0 && mask == m_voteLastMask) ? m_voteAgreeRun + 1 : 1;
+    m_voteLastMask = mask;
+    m_voteFrames++;
+}
+
+// 最近几帧是否完全一致
+bool LineDetector::isVoteStable() const {
+    return m_voteAgreeRun >= NAV_CHECK_AGREE_FRAMES;
+}
+
+// 按位多数表决
+bool LineDetector::getVotedFrame(uint16_t* sensorValues, float& confidence) const {
+    confidence = 0.0f;
+    if (m_voteFrames == 0) {
+        return false;
+    }
+    
+    uint8_t minMajority = m_voteFrames;
+    for (int i = 0; i < 8; i++) {
+        uint8_t black = m_voteBlack[i];
+        uint8_t white = m_voteFrames - black;
+        // 平票时按黑线处理：漏掉一条线比多看到一条线代价更大
+        sensorValues[i] = (black >= white) ? 0 : 1;
+        uint8_t majority = max(black, white);
+        if (majority < minMajority) {
+            minMajority = majority;
+        }
+    }
+    
+    confidence = (float)minMajority / m_voteFrames;
+    return true;
+}
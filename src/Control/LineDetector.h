@@ -43,6 +43,40 @@ public:
     // 新增：判断是否为T_FORWARD
     bool isForwardTee(const uint16_t* sensorValues);
     
+    // 行进中分类：边缘触发时开始，短距前进期间每帧调用addRollingFrame
+    void beginRolling(LineFollower::TriggerType triggerType);
+    void addRollingFrame(const uint16_t* sensorValues);
+    
+    // 根据累积的帧分类，confidence返回0-1的置信度
+    JunctionType classifyRolling(float& confidence) const;
+    
+    // 停车检测的多帧投票：停车时开始，车身稳定后每帧调用addVoteFrame
+    void beginVote();
+    void addVoteFrame(const uint16_t* sensorValues);
+    
+    // 最近NAV_CHECK_AGREE_FRAMES帧是否完全一致
+    bool isVoteStable() const;
+    
+    // 按位多数表决得到的传感器值；confidence为各位多数比例中的最小值，没有帧时返回false
+    bool getVotedFrame(uint16_t* sensorValues, float& confidence) const;
+    
+private:
+    // 行进中分类的累积特征（传感器值0为黑线）
+    LineFollower::TriggerType m_rollingTrigger;
+    uint8_t m_rollingFrames;      // 总帧数
+    uint8_t m_leftArmRun;         // 左侧分支当前连续帧数
+    uint8_t m_rightArmRun;        // 右侧分支当前连续帧数
+    uint8_t m_leftArmMax;         // 左侧分支最长连续帧数
+    uint8_t m_rightArmMax;        // 右侧分支最长连续帧数
+    bool m_crossedLine;           // 分支已离开传感器（越过横线）
+    uint8_t m_tailFrames;         // 越过横线后的帧数（最多NAV_ROLLING_TAIL_FRAMES）
+    uint8_t m_tailHistory;        // 越过横线后最近几帧中间传感器是否为黑，最低位为最新
+    
+    // 多帧投票
+    uint8_t m_voteFrames;         // 已采样帧数
+    uint8_t m_voteBlack[8];       // 各传感器为黑的帧数
+    uint8_t m_voteLastMask;       // 上一帧（位i为1表示传感器i为黑）
+    uint8_t m_voteAgreeRun;       // 与上一帧相同的连续帧数
 };
 
 #endif // LINE_DETECTOR_H 
\ No newline at end of file
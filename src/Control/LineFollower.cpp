@@ -8,6 +8,7 @@ LineFollower::LineFollower(SensorManager& sensorManager)
     , m_Kd(0.0)
     , m_lastError(0)
     , m_integral(0)
+    , m_lastErrorChange(0)
     // 移除丢线处理参数，由NavigationController接管
     // , m_lineLastDetectedTime(0)
     // , m_maxLineLostTime(2000)
@@ -31,6 +32,7 @@ void LineFollower::setPIDParams(float Kp, float Ki, float Kd) {
     // 重置PID状态，防止突变
     m_integral = 0;
     m_lastError = 0;
+    m_lastErrorChange = 0;
     Logger::debug("LineFollower", "已设置PID参数: Kp=%.2f, Ki=%.2f, Kd=%.2f", m_Kp, m_Ki, m_Kd);
 }
 
@@ -52,6 +54,7 @@ void LineFollower::setBaseSpeed(int speed) {
 void LineFollower::reset() {
     m_lastError = 0;
     m_integral = 0;
+    m_lastErrorChange = 0;
     // m_lineLastDetectedTime = 0;  // 移除，由NavigationController接管
     m_lastTurnAmount = 0.0;
 }
@@ -83,6 +86,7 @@ LineFollower::TriggerType LineFollower::update() {
     m_integral = constrain(m_integral, -100, 100);  // 防止积分饱和
     int errorChange = error - m_lastError;
     m_lastError = error;
+    m_lastErrorChange = errorChange;
     
     // PID计算转向量
     float turnAmount = (m_Kp * error + m_Ki * m_integral + m_Kd * errorChange) / 100.0;
@@ -25,6 +25,7 @@ private:
     float m_Kd;           // 微分系数
     int m_lastError;      // 上一次误差
     int m_integral;       // 积分项
+    int m_lastErrorChange; // 上一次误差变化量（微分项）
     
     // 线丢失处理参数 - 这些将由NavigationController接管
     // unsigned long m_lineLastDetectedTime;  // 上次检测到线的时间
@@ -67,6 +68,11 @@ public:
     // 获取上次计算的转向量
     float getLastTurnAmount() const { return m_lastTurnAmount; }
     
+    // 获取上次计算的PID各项（误差、积分、微分），用于遥测
+    int getLastError() const { return m_lastError; }
+    int getIntegral() const { return m_integral; }
+    int getLastErrorChange() const { return m_lastErrorChange; }
+    
     // 获取丢线最大时间 - 将被NavigationController接管
     // unsigned long getMaxLineLostTime() const { return m_maxLineLostTime; }
 };
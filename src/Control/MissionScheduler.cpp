@@ -0,0 +1,424 @@
+#include "MissionScheduler.h"
+#include "../Utils/Logger.h"
+#include <avr/pgmspace.h>
+
+// 默认颜色 -> 放置区编号（颜色编码即放置区编号，与原先按颜色计数路口一致）
+static const uint8_t DEFAULT_DROP_ZONE[COLOR_COUNT] PROGMEM = {
+    0, // COLOR_UNKNOWN
+    1, // COLOR_WHITE
+    2, // COLOR_BLACK
+    3, // COLOR_RED
+    4, // COLOR_BLUE
+    5  // COLOR_YELLOW
+};
+
+// 默认取物区状态：全部未知，现场检测
+// 赛前已知物块位置/颜色时在此修改，例如 { 2, PICKUP_HAS_BLOCK, COLOR_RED }
+struct PickupPreset {
+    uint8_t zone;
+    uint8_t status;
+    uint8_t color;
+};
+
+static const PickupPreset DEFAULT_PICKUPS[] PROGMEM = {
+    { 1, PICKUP_UNKNOWN, COLOR_UNKNOWN },
+    { 2, PICKUP_UNKNOWN, COLOR_UNKNOWN },
+    { 3, PICKUP_UNKNOWN, COLOR_UNKNOWN }
+};
+
+#define DEFAULT_PICKUP_COUNT (sizeof(DEFAULT_PICKUPS) / sizeof(DEFAULT_PICKUPS[0]))
+
+#define MISSION_COST_UNREACHABLE 0xFFFFFFFFUL
+
+// 累加一段距离，任何一段不可达则结果不可达
+static uint32_t addCost(uint32_t cost, uint16_t distance) {
+    if (cost == MISSION_COST_UNREACHABLE || distance == COURSE_UNREACHABLE) {
+        return MISSION_COST_UNREACHABLE;
+    }
+    return cost + distance;
+}
+
+static const char* pickupStatusToString(uint8_t status) {
+    switch (status) {
+        case PICKUP_UNKNOWN:   return "未知";
+        case PICKUP_HAS_BLOCK: return "有物块";
+        case PICKUP_EMPTY:     return "空";
+        case PICKUP_DONE:      return "已取走";
+        default:               return "?";
+    }
+}
+
+MissionScheduler::MissionScheduler()
+    : m_blockCount(MISSION_BLOCK_COUNT)
+    , m_placedCount(0)
+    , m_pickupCount(0)
+    , m_targetZone(0)
+    , m_startTime(0)
+    , m_lastPlaceTime(0)
+{
+    reset();
+}
+
+void MissionScheduler::reset() {
+    m_blockCount = MISSION_BLOCK_COUNT;
+    m_placedCount = 0;
+    m_targetZone = 0;
+    m_startTime = 0;
+    m_lastPlaceTime = 0;
+    
+    for (uint8_t c = 0; c < COLOR_COUNT; c++) {
+        m_dropZone[c] = pgm_read_byte(&DEFAULT_DROP_ZONE[c]);
+    }
+    
+    // 取物区数量以赛道图为准
+    m_pickupCount = 0;
+    while (m_pickupCount < MISSION_MAX_PICKUPS &&
+           CourseMap::findNode(NODE_PICKUP, m_pickupCount + 1) != COURSE_NO_NODE) {
+        m_pickupCount++;
+    }
+    
+    for (uint8_t z = 0; z <= MISSION_MAX_PICKUPS; z++) {
+        m_pickups[z].status = PICKUP_UNKNOWN;
+        m_pickups[z].color = COLOR_UNKNOWN;
+    }
+    
+    PickupPreset preset;
+    for (uint8_t i = 0; i < DEFAULT_PICKUP_COUNT; i++) {
+        memcpy_P(&preset, &DEFAULT_PICKUPS[i], sizeof(PickupPreset));
+        if (preset.zone >= 1 && preset.zone <= m_pickupCount) {
+            m_pickups[preset.zone].status = preset.status;
+            m_pickups[preset.zone].color = preset.color;
+        }
+    }
+}
+
+void MissionScheduler::startMission() {
+    m_startTime = millis();
+    m_lastPlaceTime = 0;
+    m_placedCount = 0;
+    selectNextPickup(CourseMap::findNode(NODE_BASE, 0));
+}
+
+bool MissionScheduler::isCandidate(uint8_t zone) const {
+    uint8_t status = m_pickups[zone].status;
+    return status == PICKUP_UNKNOWN || status == PICKUP_HAS_BLOCK;
+}
+
+uint8_t MissionScheduler::selectNextPickup(uint8_t fromNode, uint8_t minZone) {
+    m_targetZone = 0;
+    if (m_placedCount >= m_blockCount || fromNode == COURSE_NO_NODE) {
+        return 0;
+    }
+    
+    uint8_t pickupNode[MISSION_MAX_PICKUPS + 1];
+    bool anyCandidate = false;
+    for (uint8_t z = 1; z <= m_pickupCount; z++) {
+        pickupNode[z] = CourseMap::findNode(NODE_PICKUP, z);
+        anyCandidate |= (z >= minZone && isCandidate(z));
+    }
+    if (!anyCandidate) {
+        return 0;
+    }
+    
+    // 代价按uint32累计：不可达为MISSION_COST_UNREACHABLE，且不再参与累加
+    uint16_t dist[COURSE_MAX_NODES];
+    uint32_t startCost[MISSION_MAX_PICKUPS + 1];
+    uint32_t legCost[MISSION_MAX_PICKUPS + 1];
+    uint32_t transCost[MISSION_MAX_PICKUPS + 1][MISSION_MAX_PICKUPS + 1];
+    uint32_t endCost[MISSION_MAX_PICKUPS + 1];
+    uint8_t samples[MISSION_MAX_PICKUPS + 1];
+    
+    // 当前位置 -> 各取物区（未确认的区域加惩罚，minZone之前的区域不能作为第一个目标）
+    CourseMap::distancesFrom(fromNode, dist);
+    for (uint8_t z = 1; z <= m_pickupCount; z++) {
+        startCost[z] = (z < minZone) ? MISSION_COST_UNREACHABLE : addCost(0, dist[pickupNode[z]]);
+        if (startCost[z] != MISSION_COST_UNREACHABLE && m_pickups[z].status == PICKUP_UNKNOWN) {
+            startCost[z] += MISSION_UNKNOWN_PENALTY;
+        }
+        legCost[z] = 0;
+        endCost[z] = 0;
+        samples[z] = 0;
+        for (uint8_t b = 1; b <= m_pickupCount; b++) {
+            transCost[z][b] = 0;
+        }
+    }
+    
+    // 以每个放置区为起点算一次距离；颜色未知的物块取所有颜色的平均值
+    uint8_t baseNode = CourseMap::findNode(NODE_BASE, 0);
+    for (uint8_t c = COLOR_WHITE; c < COLOR_COUNT; c++) {
+        uint8_t dropNode = CourseMap::findNode(NODE_DROP, m_dropZone[c]);
+        if (dropNode == COURSE_NO_NODE) {
+            continue;
+        }
+        CourseMap::distancesFrom(dropNode, dist);
+        
+        for (uint8_t a = 1; a <= m_pickupCount; a++) {
+            uint8_t color = m_pickups[a].color;
+            if ((color != COLOR_UNKNOWN && color != c) || dist[pickupNode[a]] == COURSE_UNREACHABLE) {
+                continue;
+            }
+            // 赛道图为无向图，放置区->取物区的距离即取物区->放置区的距离
+            legCost[a] = addCost(legCost[a], dist[pickupNode[a]]);
+            if (baseNode != COURSE_NO_NODE) {
+                endCost[a] = addCost(endCost[a], dist[baseNode]);
+            }
+            for (uint8_t b = 1; b <= m_pickupCount; b++) {
+                transCost[a][b] = addCost(transCost[a][b], dist[pickupNode[b]]);
+            }
+            samples[a]++;
+        }
+    }
+    
+    for (uint8_t a = 1; a <= m_pickupCount; a++) {
+        if (samples[a] == 0) {
+            legCost[a] = MISSION_COST_UNREACHABLE;
+            continue;
+        }
+        legCost[a] /= samples[a];
+        if (endCost[a] != MISSION_COST_UNREACHABLE) {
+            endCost[a] /= samples[a];
+        }
+        for (uint8_t b = 1; b <= m_pickupCount; b++) {
+            if (transCost[a][b] == MISSION_COST_UNREACHABLE) {
+                continue;
+            }
+            transCost[a][b] /= samples[a];
+            if (m_pickups[b].status == PICKUP_UNKNOWN) {
+                transCost[a][b] += MISSION_UNKNOWN_PENALTY;
+            }
+        }
+    }
+    
+    uint8_t remaining = m_blockCount - m_placedCount;
+    uint32_t bestCost = 0xFFFFFFFFUL;
+    uint8_t bestFirst = 0;
+    searchOrder(0, remaining, 0, 0, 0, startCost, legCost, transCost, endCost, 0, bestCost, bestFirst);
+    
+    m_targetZone = bestFirst;
+    if (m_targetZone != 0) {
+        Logger::info("Mission", "下一个取物区: %d（剩余%d块，预计行程%lu cm）",
+                   m_targetZone, remaining, (unsigned long)bestCost);
+    }
+    return m_targetZone;
+}
+
+void MissionScheduler::searchOrder(uint8_t depth, uint8_t remaining, uint8_t last, uint16_t usedMask, uint32_t cost,
+                                   const uint32_t* startCost, const uint32_t* legCost,
+                                   const uint32_t (*transCost)[MISSION_MAX_PICKUPS + 1], const uint32_t* endCost,
+                                   uint8_t first, uint32_t& bestCost, uint8_t& bestFirst) const {
+    if (cost >= bestCost) {
+        return;
+    }
+    
+    bool extended = false;
+    if (remaining > 0) {
+        for (uint8_t z = 1; z <= m_pickupCount; z++) {
+            if (!isCandidate(z) || (usedMask & (1U << z))) {
+                continue;
+            }
+            uint32_t approach = (depth == 0) ? startCost[z] : transCost[last][z];
+            if (approach == MISSION_COST_UNREACHABLE || legCost[z] == MISSION_COST_UNREACHABLE) {
+                continue;
+            }
+            extended = true;
+            searchOrder(depth + 1, remaining - 1, z, usedMask | (1U << z), cost + approach + legCost[z],
+                        startCost, legCost, transCost, endCost,
+                        (depth == 0) ? z : first, bestCost, bestFirst);
+        }
+    }
+    
+    // 取够数量或没有更多区域：加上返回基地的距离（回不到基地的顺序不可用）
+    if (!extended && depth > 0 && endCost[last] != MISSION_COST_UNREACHABLE) {
+        uint32_t total = cost + endCost[last];
+        if (total < bestCost) {
+            bestCost = total;
+            bestFirst = first;
+        }
+    }
+}
+
+bool MissionScheduler::shouldScanZone(uint8_t zone) const {
+    if (zone < 1 || zone > m_pickupCount) {
+        // 赛道图外的区域：没有目标时照常检测
+        return m_targetZone == 0;
+    }
+    // 没有目标时只检测仍可能有物块的区域，已确认为空或已取走的不再检测
+    return (m_targetZone == 0) ? isCandidate(zone) : zone == m_targetZone;
+}
+
+void MissionScheduler::onZoneScanned(uint8_t zone, bool found) {
+    if (zone < 1 || zone > m_pickupCount) {
+        return;
+    }
+    
+    if (found) {
+        m_pickups[zone].status = PICKUP_HAS_BLOCK;
+        return;
+    }
+    
+    m_pickups[zone].status = PICKUP_EMPTY;
+    Logger::info("Mission", "取物区%d无物块", zone);
+    // 搜索只沿主线向前，此前跳过的区域留到下一趟再去
+    selectNextPickup(CourseMap::findNode(NODE_PICKUP, zone), zone + 1);
+}
+
+bool MissionScheduler::hasTargetAhead(uint8_t zone) const {
+    if (zone < 1 || zone > m_pickupCount) {
+        return true;
+    }
+    return m_targetZone > zone;
+}
+
+void MissionScheduler::onBlockGrabbed(uint8_t zone, ColorCode color) {
+    if (zone < 1 || zone > m_pickupCount) {
+        return;
+    }
+    m_pickups[zone].status = PICKUP_DONE;
+    m_pickups[zone].color = color;
+}
+
+void MissionScheduler::onBlockPlaced(uint8_t dropNode) {
+    m_placedCount++;
+    m_lastPlaceTime = millis();
+    
+    Logger::info("Mission", "已完成%d/%d块，用时%lu ms，吞吐量%.2f 块/分钟",
+               m_placedCount, m_blockCount, m_lastPlaceTime - m_startTime, getThroughput());
+    
+    if (!isMissionComplete()) {
+        selectNextPickup(dropNode);
+    }
+}
+
+bool MissionScheduler::isMissionComplete() const {
+    if (m_placedCount >= m_blockCount) {
+        return true;
+    }
+    for (uint8_t z = 1; z <= m_pickupCount; z++) {
+        if (isCandidate(z)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint8_t MissionScheduler::getDropZone(ColorCode color) const {
+    return (color < COLOR_COUNT) ? m_dropZone[color] : 0;
+}
+
+float MissionScheduler::getThroughput() const {
+    if (m_placedCount == 0 || m_lastPlaceTime <= m_startTime) {
+        return 0.0f;
+    }
+    return m_placedCount * 60000.0f / (m_lastPlaceTime - m_startTime);
+}
+
+void MissionScheduler::printStatus() const {
+    Logger::info("Mission", "目标物块数: %d，已完成: %d，当前目标取物区: %d",
+               m_blockCount, m_placedCount, m_targetZone);
+    for (uint8_t z = 1; z <= m_pickupCount; z++) {
+        Logger::info("Mission", "  取物区%d: %s，颜色%d",
+                   z, pickupStatusToString(m_pickups[z].status), m_pickups[z].color);
+    }
+    for (uint8_t c = COLOR_WHITE; c < COLOR_COUNT; c++) {
+        Logger::info("Mission", "  颜色%d -> 放置区%d", c, m_dropZone[c]);
+    }
+    if (m_placedCount > 0) {
+        Logger::info("Mission", "吞吐量: %.2f 块/分钟", getThroughput());
+    }
+}
+
+bool MissionScheduler::isProgressCommand(const char* command) {
+    if (strncasecmp(command, "MISSION", 7) != 0 || command[7] != ' ') {
+        return false;
+    }
+    const char* action = command + 7;
+    while (*action == ' ') {
+        action++;
+    }
+    if (strncasecmp(action, "RESET", 5) == 0) {
+        action += 5;
+    } else if (strncasecmp(action, "BLOCKS", 6) == 0) {
+        action += 6;
+    } else {
+        return false;
+    }
+    return *action == '\0' || *action == ' ';
+}
+
+bool MissionScheduler::handleCommand(const char* command) {
+    // 命令格式:
+    //   MISSION [SHOW]                                 打印配置与进度
+    //   MISSION BLOCKS <数量>                          设置需要搬运的物块数
+    //   MISSION ZONE <颜色1-5> <放置区>                修改颜色对应的放置区
+    //   MISSION PICKUP <区域> <HAS|EMPTY|UNKNOWN> [颜色]  预设取物区状态
+    //   MISSION RESET                                  恢复默认配置
+    if (strncasecmp(command, "MISSION", 7) != 0 || (command[7] != ' ' && command[7] != '\0')) {
+        return false;
+    }
+    
+    char buffer[48];
+    strncpy(buffer, command, sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = '\0';
+    
+    const uint8_t MAX_TOKENS = 5;
+    char* tokens[MAX_TOKENS];
+    uint8_t count = 0;
+    char* savePtr = nullptr;
+    for (char* token = strtok_r(buffer, " \t\r\n", &savePtr);
+         token != nullptr && count < MAX_TOKENS;
+         token = strtok_r(nullptr, " \t\r\n", &savePtr)) {
+        tokens[count++] = token;
+    }
+    
+    if (count < 2 || strcasecmp(tokens[1], "SHOW") == 0) {
+        printStatus();
+        return true;
+    }
+    
+    const char* action = tokens[1];
+    if (strcasecmp(action, "RESET") == 0) {
+        reset();
+        Logger::info("Mission", "任务配置已恢复默认");
+    } else if (strcasecmp(action, "BLOCKS") == 0 && count >= 3) {
+        int blocks = atoi(tokens[2]);
+        if (blocks < 1 || blocks > m_pickupCount) {
+            Logger::warning("Mission", "物块数应为1-%d", m_pickupCount);
+            return true;
+        }
+        m_blockCount = blocks;
+        Logger::info("Mission", "目标物块数: %d", m_blockCount);
+    } else if (strcasecmp(action, "ZONE") == 0 && count >= 4) {
+        int color = atoi(tokens[2]);
+        int zone = atoi(tokens[3]);
+        if (color < COLOR_WHITE || color >= COLOR_COUNT ||
+            CourseMap::findNode(NODE_DROP, zone) == COURSE_NO_NODE) {
+            Logger::warning("Mission", "无效的颜色或放置区: %d %d", color, zone);
+            return true;
+        }
+        m_dropZone[color] = zone;
+        Logger::info("Mission", "颜色%d -> 放置区%d", color, zone);
+    } else if (strcasecmp(action, "PICKUP") == 0 && count >= 4) {
+        int zone = atoi(tokens[2]);
+        if (zone < 1 || zone > m_pickupCount) {
+            Logger::warning("Mission", "无效的取物区: %d", zone);
+            return true;
+        }
+        if (strcasecmp(tokens[3], "HAS") == 0) {
+            m_pickups[zone].status = PICKUP_HAS_BLOCK;
+        } else if (strcasecmp(tokens[3], "EMPTY") == 0) {
+            m_pickups[zone].status = PICKUP_EMPTY;
+        } else if (strcasecmp(tokens[3], "UNKNOWN") == 0) {
+            m_pickups[zone].status = PICKUP_UNKNOWN;
+        } else {
+            Logger::warning("Mission", "未知的取物区状态: %s", tokens[3]);
+            return true;
+        }
+        int color = (count >= 5) ? atoi(tokens[4]) : COLOR_UNKNOWN;
+        m_pickups[zone].color = (color > COLOR_UNKNOWN && color < COLOR_COUNT) ? color : COLOR_UNKNOWN;
+        Logger::info("Mission", "取物区%d: %s，颜色%d",
+                   zone, pickupStatusToString(m_pickups[zone].status), m_pickups[zone].color);
+    } else {
+        Logger::warning("Mission", "未知的MISSION命令: %s", command);
+    }
+    return true;
+}
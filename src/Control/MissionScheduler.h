@@ -0,0 +1,100 @@
+#ifndef MISSION_SCHEDULER_H
+#define MISSION_SCHEDULER_H
+
+#include <Arduino.h>
+#include "../Utils/Config.h"
+#include "CourseMap.h"
+
+// 取物区状态
+enum PickupStatus {
+    PICKUP_UNKNOWN,     // 未知，需要检测
+    PICKUP_HAS_BLOCK,   // 已知有物块（预设或已检测到）
+    PICKUP_EMPTY,       // 已检测，无物块
+    PICKUP_DONE         // 物块已取走
+};
+
+/**
+ * 多物块任务调度
+ * 
+ * - 需要搬运的物块数可配置
+ * - 各取物区的状态（未知/有物块/空）及已知物块颜色可以预设，也会在搜索中更新
+ * - 颜色对应的放置区由表格配置（默认颜色编码即放置区编号）
+ * - 根据赛道图计算距离，选出使剩余总行程最短的取物顺序
+ * - 统计吞吐量（块/分钟）
+ */
+class MissionScheduler {
+public:
+    MissionScheduler();
+    
+    // 从Flash载入默认配置并清空任务进度
+    void reset();
+    
+    // 开始计时（离开基地时调用）
+    void startMission();
+    
+    // 从fromNode出发选择下一个取物区，返回区域编号，没有可去的区域返回0
+    // minZone限定第一个目标的最小编号（搜索途中只能继续向前），之后的顺序不受限制
+    uint8_t selectNextPickup(uint8_t fromNode, uint8_t minZone = 1);
+    
+    // 搜索途中经过某取物区时是否需要检测（没有目标时检测所有未排除的区域）
+    bool shouldScanZone(uint8_t zone) const;
+    
+    // 检测结果；无物块时从该区域之后的区域中重新选择目标
+    void onZoneScanned(uint8_t zone, bool found);
+    
+    // 在zone处检测无物块后，前方是否还有要去的区域；赛道图外的区域按原方式继续搜索
+    bool hasTargetAhead(uint8_t zone) const;
+    
+    // 在某区域抓到物块并识别出颜色
+    void onBlockGrabbed(uint8_t zone, ColorCode color);
+    
+    // 物块已放入放置区；dropNode为当前所在节点，用于选择下一个目标
+    void onBlockPlaced(uint8_t dropNode);
+    
+    // 是否已完成（达到目标数量或没有可去的区域）
+    bool isMissionComplete() const;
+    
+    // 颜色对应的放置区编号
+    uint8_t getDropZone(ColorCode color) const;
+    
+    uint8_t getTargetZone() const { return m_targetZone; }
+    uint8_t getPlacedCount() const { return m_placedCount; }
+    uint8_t getBlockCount() const { return m_blockCount; }
+    
+    // 吞吐量（块/分钟），任务结束后按结束时间计算
+    float getThroughput() const;
+    
+    // 打印配置与进度
+    void printStatus() const;
+    
+    // 处理MISSION命令，不是MISSION命令时返回false
+    bool handleCommand(const char* command);
+    
+    // 是否为会清空或改变任务进度的命令（MISSION RESET / MISSION BLOCKS），任务运行中不应执行
+    static bool isProgressCommand(const char* command);
+    
+private:
+    struct PickupInfo {
+        uint8_t status;     // PickupStatus
+        uint8_t color;      // 已知的物块颜色，COLOR_UNKNOWN表示未知
+    };
+    
+    uint8_t m_blockCount;
+    uint8_t m_placedCount;
+    uint8_t m_pickupCount;                         // 赛道图中的取物区数量
+    uint8_t m_targetZone;                          // 当前目标取物区，0表示没有
+    uint8_t m_dropZone[COLOR_COUNT];               // 颜色 -> 放置区编号
+    PickupInfo m_pickups[MISSION_MAX_PICKUPS + 1]; // 按区域编号索引，0号不用
+    unsigned long m_startTime;
+    unsigned long m_lastPlaceTime;
+    
+    bool isCandidate(uint8_t zone) const;
+    
+    // 分支限界搜索剩余取物顺序的最小代价
+    void searchOrder(uint8_t depth, uint8_t remaining, uint8_t last, uint16_t usedMask, uint32_t cost,
+                     const uint32_t* startCost, const uint32_t* legCost,
+                     const uint32_t (*transCost)[MISSION_MAX_PICKUPS + 1], const uint32_t* endCost,
+                     uint8_t first, uint32_t& bestCost, uint8_t& bestFirst) const;
+};
+
+#endif // MISSION_SCHEDULER_H
@@ -1,11 +1,5 @@
 #include "NavigationController.h"
-
-// 传感器数组格式化辅助函数
-static void formatSensorArray(const uint16_t values[8], char* buffer, size_t bufferSize) {
-    snprintf(buffer, bufferSize, "[%d%d%d%d%d%d%d%d]",
-             values[0], values[1], values[2], values[3],
-             values[4], values[5], values[6], values[7]);
-}
+#include "../Utils/TraceRecorder.h"
 
 // 构造函数
 NavigationController::NavigationController(SensorManager& sm, MotionController& mc, LineFollower& lf)
@@ -31,6 +25,7 @@ NavigationController::NavigationController(SensorManager& sm, MotionController&
     , m_verificationStartTime(0)
     , m_obstacleAvoidanceEnabled(true) // 默认启用避障
     , m_obstacleAvoidanceReverse(false) // 初始化反转标志为 false
+    , m_expectedJunction(NO_JUNCTION)
 {
     // 构造函数初始化完成
     Logger::info("NavCtrl", "Obstacle Avoidance parameters initialized: Threshold=%.1fcm, Speed=%d, Durations(R/F/L)=%lu/%lu/%lu ms",
@@ -44,31 +39,24 @@ NavigationController::NavigationController(SensorManager& sm, MotionController&
 void NavigationController::applyPIDControl(float turnAmount, int baseSpeed) {
     // 根据转向量的大小选择不同的控制方式
     int calculatedTurnSpeed = 0;
-    const char* actionStr = "";
     
     if (abs(turnAmount) < 0.2) {
         // 小转向量，直接前进
-        actionStr = "Forward";
         m_motionController.moveForward(baseSpeed);
         calculatedTurnSpeed = baseSpeed;
     } else if (turnAmount > 0) {
         // 线偏右，需要右转修正
-        actionStr = "TurnRight";
         calculatedTurnSpeed = map(abs(turnAmount * 100), 20, 80, baseSpeed/2, baseSpeed);
         // 确保转向速度在合理范围内
         calculatedTurnSpeed = constrain(calculatedTurnSpeed, baseSpeed/2, baseSpeed);
         m_motionController.turnRight(calculatedTurnSpeed);
     } else {
         // 线偏左，需要左转修正
-        actionStr = "TurnLeft";
         calculatedTurnSpeed = map(abs(turnAmount * 100), 20, 80, baseSpeed/2, baseSpeed);
         // 确保转向速度在合理范围内
         calculatedTurnSpeed = constrain(calculatedTurnSpeed, baseSpeed/2, baseSpeed);
         m_motionController.turnLeft(calculatedTurnSpeed);
     }
-    
-    //Logger::debug("NavCtrl", "PID应用: 转向量=%f -> 动作=%s, 速度=%d", 
-    //             turnAmount, actionStr, calculatedTurnSpeed);
 }
 
 // 检查障碍物
@@ -114,10 +102,21 @@ void NavigationController::init() {
     
     Logger::info("NavCtrl", "State -> FOLLOWING_LINE (Initialized)");
     Logger::info("NavCtrl", "NavigationController初始化完成");
+    TRACE_EVENT(TRACE_EVENT_NAV_INIT);
 }
 
-// 核心状态更新函数
+// 核心状态更新函数：每次调用对应轨迹中的一帧
 void NavigationController::update() {
+#if ENABLE_TRACE
+    TraceRecorder::beginFrame();
+    updateState();
+    TraceRecorder::endFrame((uint8_t)m_currentState, (uint8_t)m_detectedJunctionType);
+#else
+    updateState();
+#endif
+}
+
+void NavigationController::updateState() {
     // 根据当前状态执行不同的逻辑
     switch (m_currentState) {
         case NAV_FOLLOWING_LINE: {
@@ -244,12 +243,13 @@ void NavigationController::update() {
             // 检查是否为T_FORWARD（全黑模式）
             if (m_lineDetector.isForwardTee(sensorValues)) {
                 char sensorStr[40];
-                formatSensorArray(sensorValues, sensorStr, sizeof(sensorStr));
+                InfraredArray::formatValues(sensorValues, sensorStr, sizeof(sensorStr));
                 Logger::info("NavCtrl", "检测到T_FORWARD! 传感器: %s", sensorStr);
                 m_motionController.emergencyStop();
                 Logger::info("NavCtrl", "State -> AT_JUNCTION (Type: T_FORWARD)");
                 m_detectedJunctionType = T_FORWARD;
                 m_currentState = NAV_AT_JUNCTION;
+                m_expectedJunction = NO_JUNCTION;
                 m_motionController.moveForward();
                 delay(NAV_CHECK_FORWARD_DURATION);
                 return;
@@ -259,12 +259,18 @@ void NavigationController::update() {
             if (trigger == LineFollower::TRIGGER_LEFT_EDGE || 
                 trigger == LineFollower::TRIGGER_RIGHT_EDGE) {
                 char sensorStr[40];
-                formatSensorArray(sensorValues, sensorStr, sizeof(sensorStr));
+                InfraredArray::formatValues(sensorValues, sensorStr, sizeof(sensorStr));
                 Logger::info("NavCtrl", "检测到边缘触发! 类型: %d, 传感器: %s", 
                            trigger, sensorStr);
                 
                 m_triggerType = trigger;
                 
+#if NAV_ROLLING_CLASSIFY
+                // 短距前进期间累积红外帧
+                m_lineDetector.beginRolling(trigger);
+                m_lineDetector.addRollingFrame(sensorValues);
+#endif
+                
                 // 开始短距前进
                 Logger::info("NavCtrl", "State -> MOVING_TO_STOP (Trigger: %d)", m_triggerType);
                 m_motionController.moveForward(NAV_CHECK_FORWARD_SPEED);
@@ -285,11 +291,43 @@ void NavigationController::update() {
         }
         
         case NAV_MOVING_TO_STOP: {
+#if NAV_ROLLING_CLASSIFY
+            uint16_t rollingValues[8];
+            if (m_sensorManager.getInfraredSensorValues(rollingValues)) {
+                m_lineDetector.addRollingFrame(rollingValues);
+            }
+#endif
+            
             // 检查短距前进是否完成
             if (millis() - m_actionStartTime >= NAV_CHECK_FORWARD_DURATION) {
+                if (isTriggerConsistent(m_triggerType, m_expectedJunction)) {
+                    // 已知路口：不停车检测，直接按预期类型交给状态机
+                    Logger::info("NavCtrl", "State -> AT_JUNCTION (Type: %d, 预期路口)", m_expectedJunction);
+                    m_detectedJunctionType = m_expectedJunction;
+                    m_expectedJunction = NO_JUNCTION;
+                    m_currentState = NAV_AT_JUNCTION;
+                    break;
+                }
+                
+#if NAV_ROLLING_CLASSIFY
+                // 行进中分类置信度足够时不停车
+                float confidence;
+                JunctionType rollingType = m_lineDetector.classifyRolling(confidence);
+                if (rollingType != NO_JUNCTION && confidence >= NAV_ROLLING_MIN_CONFIDENCE) {
+                    Logger::info("NavCtrl", "State -> AT_JUNCTION (Type: %d, 行进中分类, 置信度%.2f)", 
+                               rollingType, confidence);
+                    m_detectedJunctionType = rollingType;
+                    m_expectedJunction = NO_JUNCTION;
+                    m_currentState = NAV_AT_JUNCTION;
+                    break;
+                }
+                Logger::info("NavCtrl", "行进中分类置信度不足 (%.2f)，停车检测", confidence);
+#endif
+                
                 // 短距前进完成，停车
                 m_motionController.emergencyStop();
                 m_actionStartTime = millis(); // 记录停止时间，用于稳定延迟
+                m_lineDetector.beginVote();
                 Logger::info("NavCtrl", "State -> STOPPED_FOR_CHECK");
                 m_currentState = NAV_STOPPED_FOR_CHECK;
                 //Logger::debug("NavCtrl", "停车检查: 等待 %.1f 秒稳定", NAV_CHECK_STABILIZE_DELAY / 1000.0);
@@ -299,15 +337,33 @@ void NavigationController::update() {
         }
         
         case NAV_STOPPED_FOR_CHECK: {
-            // 检查稳定时间是否到
-            if (millis() - m_actionStartTime >= NAV_CHECK_STABILIZE_DELAY) {
-                // 稳定时间到，获取静态传感器值
-                uint16_t sensorValues[8];
-                m_sensorManager.getInfraredSensorValues(sensorValues);
+            // 停车后前NAV_CHECK_MIN_SETTLE ms车身仍在晃动，这段时间的帧不参与投票
+            uint16_t sensorValues[8];
+            unsigned long settleTime = millis() - m_actionStartTime;
+            if (settleTime >= NAV_CHECK_MIN_SETTLE && m_sensorManager.getInfraredSensorValues(sensorValues)) {
+                m_lineDetector.addVoteFrame(sensorValues);
+            }
+            
+            // 按位多数表决得到静态传感器值；连续几帧一致且置信度足够时提前结束，
+            // 否则继续采样，最长等待NAV_CHECK_STABILIZE_DELAY后按当前结果处理
+            float voteConfidence;
+            bool voted = m_lineDetector.getVotedFrame(sensorValues, voteConfidence);
+            bool accepted = voted && m_lineDetector.isVoteStable() &&
+                            voteConfidence >= NAV_CHECK_MIN_CONFIDENCE;
+            if (accepted || settleTime >= NAV_CHECK_STABILIZE_DELAY) {
+                if (!voted) {
+                    m_sensorManager.getInfraredSensorValues(sensorValues);
+                }
                 
                 char sensorStr[40];
-                formatSensorArray(sensorValues, sensorStr, sizeof(sensorStr));
-                //Logger::debug("NavCtrl", "停车检查: 读取静态传感器值: %s", sensorStr);
+                InfraredArray::formatValues(sensorValues, sensorStr, sizeof(sensorStr));
+                if (accepted) {
+                    Logger::info("NavCtrl", "停车检查: 投票结果 %s, 置信度%.2f, 用时%lu ms", 
+                               sensorStr, voteConfidence, settleTime);
+                } else {
+                    Logger::warning("NavCtrl", "停车检查: 采样超时，投票结果 %s, 置信度%.2f", 
+                                  sensorStr, voteConfidence);
+                }
                 
                 // 分类判断路口类型
                 m_detectedJunctionType = m_lineDetector.classifyStoppedJunction(sensorValues, m_triggerType);
@@ -343,6 +399,7 @@ void NavigationController::update() {
                     // 不需要验证，直接进入路口状态
                     Logger::info("NavCtrl", "State -> AT_JUNCTION (Type: %d)", m_detectedJunctionType);
                     m_currentState = NAV_AT_JUNCTION;
+                    m_expectedJunction = NO_JUNCTION;
                     Logger::info("NavCtrl", "静态检查完成，路口类型: %d", m_detectedJunctionType);
                 }
             }
@@ -363,7 +420,7 @@ void NavigationController::update() {
                 m_sensorManager.getInfraredSensorValues(sensorValues);
                 
                 char sensorStr[40];
-                formatSensorArray(sensorValues, sensorStr, sizeof(sensorStr));
+                InfraredArray::formatValues(sensorValues, sensorStr, sizeof(sensorStr));
                 //Logger::debug("NavCtrl", "微调后检查: 读取静态传感器值: %s", sensorStr);
                 
                 // 检查是否检测到线（不再是全白）
@@ -392,6 +449,7 @@ void NavigationController::update() {
                 // 进入路口状态
                 Logger::info("NavCtrl", "State -> AT_JUNCTION (Type: %d, 验证后)", m_detectedJunctionType);
                 m_currentState = NAV_AT_JUNCTION;
+                m_expectedJunction = NO_JUNCTION;
             }
             break;
         }
@@ -448,7 +506,7 @@ void NavigationController::update() {
                 if (sensorValues[3] == 0 || sensorValues[4] == 0) {
                     m_motionController.emergencyStop();
                     char sensorStr[40];
-                    formatSensorArray(sensorValues, sensorStr, sizeof(sensorStr));
+                    InfraredArray::formatValues(sensorValues, sensorStr, sizeof(sensorStr));
                     Logger::info("NavCtrl", "在左平移时找到线! 传感器: %s. State -> NAV_FOLLOWING_LINE", sensorStr);
                     delay(500); // 短暂延时稳定
                     // 重置巡线相关状态
@@ -518,7 +576,7 @@ void NavigationController::update() {
                 if (sensorValues[3] == 0 || sensorValues[4] == 0) {
                     m_motionController.emergencyStop();
                     char sensorStr[40];
-                    formatSensorArray(sensorValues, sensorStr, sizeof(sensorStr));
+                    InfraredArray::formatValues(sensorValues, sensorStr, sizeof(sensorStr));
                     Logger::info("NavCtrl", "在右平移时找到线 (反向)! 传感器: %s. State -> NAV_FOLLOWING_LINE", sensorStr);
                     delay(500); // 短暂延时稳定
                     // 重置巡线相关状态
@@ -574,6 +632,7 @@ void NavigationController::resumeFollowing() {
     //Logger::debug("NavCtrl", "State -> FOLLOWING_LINE (Resumed)");
     m_currentState = NAV_FOLLOWING_LINE;
     //Logger::debug("NavCtrl", "恢复巡线");
+    TRACE_EVENT(TRACE_EVENT_NAV_RESUME);
 }
 
 // 强制停止导航
@@ -582,6 +641,7 @@ void NavigationController::stop() {
     Logger::info("NavCtrl", "State -> STOPPED");
     m_currentState = NAV_STOPPED;
     Logger::info("NavCtrl", "导航停止");
+    TRACE_EVENT(TRACE_EVENT_NAV_STOP);
 }
 
 // 设置避障启用/禁用
@@ -589,6 +649,7 @@ void NavigationController::setObstacleAvoidanceEnabled(bool enabled) {
     if (m_obstacleAvoidanceEnabled != enabled) {
         m_obstacleAvoidanceEnabled = enabled;
         Logger::info("NavCtrl", "Obstacle avoidance %s", enabled ? "ENABLED" : "DISABLED");
+        TRACE_EVENT(TRACE_EVENT_NAV_AVOID, m_obstacleAvoidanceEnabled, m_obstacleAvoidanceReverse);
     }
 }
 
@@ -597,11 +658,36 @@ void NavigationController::setObstacleAvoidanceReverse(bool reverse) {
     if (m_obstacleAvoidanceReverse != reverse) {
         m_obstacleAvoidanceReverse = reverse;
         Logger::info("NavCtrl", "Obstacle Avoidance Reverse set to: %s", m_obstacleAvoidanceReverse ? "true" : "false");
+        TRACE_EVENT(TRACE_EVENT_NAV_AVOID, m_obstacleAvoidanceEnabled, m_obstacleAvoidanceReverse);
     }
 }
 
 // 设置基础速度
 void NavigationController::setBaseSpeed(int speed) {
     m_lineFollower.setBaseSpeed(speed);
+    TRACE_EVENT(TRACE_EVENT_NAV_SPEED, (uint8_t)constrain(speed, 0, 255));
     //Logger::debug("NavCtrl", "已设置基础速度: %d", speed);
-}
\ No newline at end of file
+}
+
+// 设置下一个路口的预期类型
+void NavigationController::setExpectedJunction(JunctionType expected) {
+    m_expectedJunction = expected;
+    TRACE_EVENT(TRACE_EVENT_NAV_EXPECT, (uint8_t)expected);
+}
+
+// 边缘触发方向与预期路口是否一致（预期未知时返回false）
+bool NavigationController::isTriggerConsistent(LineFollower::TriggerType trigger, JunctionType expected) const {
+    switch (expected) {
+        case T_LEFT:
+        case LEFT_TURN:
+            return trigger == LineFollower::TRIGGER_LEFT_EDGE;
+        case T_RIGHT:
+        case RIGHT_TURN:
+            return trigger == LineFollower::TRIGGER_RIGHT_EDGE;
+        case T_FORWARD:
+        case CROSS:
+            return trigger == LineFollower::TRIGGER_LEFT_EDGE || trigger == LineFollower::TRIGGER_RIGHT_EDGE;
+        default:
+            return false;
+    }
+}
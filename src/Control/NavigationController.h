@@ -75,11 +75,20 @@ private:
     bool m_obstacleAvoidanceEnabled;
     // 新增：避障方向反转标志
     bool m_obstacleAvoidanceReverse; 
+    
+    // 下一个路口的预期类型（来自路径回放），NO_JUNCTION表示未知
+    JunctionType m_expectedJunction;
+    
+    // 边缘触发方向与预期路口是否一致
+    bool isTriggerConsistent(LineFollower::TriggerType trigger, JunctionType expected) const;
 
     // PID控制封装方法
     void applyPIDControl(float turnAmount, int baseSpeed);
 
     bool checkForObstacle();
+    
+    // 按当前状态执行一次导航逻辑（update()在其外层记录轨迹帧）
+    void updateState();
 
 public:
     // 构造函数
@@ -97,6 +106,9 @@ public:
     // 获取检测到的路口类型
     JunctionType getDetectedJunctionType() const;
     
+    // 获取巡线控制器（只读，用于遥测）
+    const LineFollower& getLineFollower() const { return m_lineFollower; }
+    
     // 恢复巡线状态
     void resumeFollowing();
     
@@ -112,6 +124,10 @@ public:
     // 设置基础速度
     void setBaseSpeed(int speed);
     
+    // 设置下一个路口的预期类型：边缘触发方向一致时跳过停车检测，
+    // 直接按预期类型报告路口。到达路口后自动清除
+    void setExpectedJunction(JunctionType expected);
+    
     // 常量
  
 };
@@ -0,0 +1,112 @@
+#include "RouteRecorder.h"
+#include "../Utils/Logger.h"
+
+RouteRecorder::RouteRecorder()
+    : m_replaying(false)
+    , m_replayJunction(NO_JUNCTION)
+    , m_replayTurn(ROUTE_STRAIGHT)
+{
+}
+
+void RouteRecorder::clear() {
+    m_records.clear();
+    m_replaying = false;
+}
+
+void RouteRecorder::record(JunctionType junction, RouteTurn turn) {
+    if (m_replaying) {
+        return;
+    }
+    
+    RouteRecord item;
+    if (m_records.isFull()) {
+        // 丢弃最早的记录
+        m_records.pop(item);
+    }
+    
+    item.junction = junction;
+    item.turn = turn;
+    m_records.push(item);
+}
+
+bool RouteRecorder::amendLastTurn(RouteTurn turn) {
+    RouteRecord item;
+    if (m_replaying || !m_records.popNewest(item)) {
+        return false;
+    }
+    item.turn = turn;
+    m_records.push(item);
+    return true;
+}
+
+bool RouteRecorder::startReplay() {
+    m_replaying = true;
+    loadNextReplayStep();
+    
+    if (m_replaying) {
+        Logger::info("RouteRecorder", "开始逆向回放，共%d个路口", m_records.size());
+    }
+    return m_replaying;
+}
+
+void RouteRecorder::stopReplay() {
+    m_records.clear();
+    m_replaying = false;
+}
+
+bool RouteRecorder::getReplayStep(JunctionType& expected, RouteTurn& turn) const {
+    if (!m_replaying) {
+        return false;
+    }
+    expected = m_replayJunction;
+    turn = m_replayTurn;
+    return true;
+}
+
+void RouteRecorder::advanceReplay() {
+    if (m_replaying) {
+        loadNextReplayStep();
+    }
+}
+
+void RouteRecorder::loadNextReplayStep() {
+    RouteRecord item;
+    
+    // 保留最早的一条（进入搜索区域的路口）
+    if (m_records.size() < 2 || !m_records.popNewest(item) ||
+        !invert(static_cast<JunctionType>(item.junction), static_cast<RouteTurn>(item.turn),
+                m_replayJunction, m_replayTurn)) {
+        stopReplay();
+    }
+}
+
+bool RouteRecorder::invert(JunctionType junction, RouteTurn turn,
+                           JunctionType& reverseJunction, RouteTurn& reverseTurn) {
+    // 以去程到达方向为北(0)：左=西(3)，直=北(0)，右=东(1)，来路=南(2)
+    bool exits[4] = { false, false, true, false };
+    switch (junction) {
+        case T_LEFT:     exits[3] = exits[0] = true; break;
+        case T_RIGHT:    exits[0] = exits[1] = true; break;
+        case T_FORWARD:  exits[3] = exits[1] = true; break;
+        case CROSS:      exits[3] = exits[0] = exits[1] = true; break;
+        case LEFT_TURN:  exits[3] = true; break;
+        case RIGHT_TURN: exits[1] = true; break;
+        default:
+            return false;
+    }
+    
+    // 去程转向的数值即离开路口的绝对方向
+    uint8_t leaving = turn;
+    if (turn == ROUTE_UTURN || turn > ROUTE_LEFT || !exits[leaving]) {
+        return false;
+    }
+    
+    // 返程从离开方向驶回，车头朝向相反
+    uint8_t heading = (leaving + 2) & 3;
+    reverseJunction = CourseMap::junctionTypeFromExits(exits[(heading + ROUTE_LEFT) & 3],
+                                                       exits[heading],
+                                                       exits[(heading + ROUTE_RIGHT) & 3]);
+    // 返程的目标是去程的来路（南）
+    reverseTurn = static_cast<RouteTurn>((HEADING_SOUTH - heading) & 3);
+    return true;
+}
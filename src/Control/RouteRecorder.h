@@ -0,0 +1,66 @@
+#ifndef ROUTE_RECORDER_H
+#define ROUTE_RECORDER_H
+
+#include <Arduino.h>
+#include "../Utils/Config.h"
+#include "../Utils/RingBuffer.h"
+#include "CourseMap.h"
+
+/**
+ * 路径记录与逆向回放
+ * 
+ * 搜索物块时按顺序记录经过的每个路口类型及所做的转向，
+ * 返回时从最近的路口开始倒序给出逆向行驶时应检测到的路口类型和转向。
+ * 缓冲区满时丢弃最早的记录（回放只需要离当前位置最近的路口）。
+ */
+class RouteRecorder {
+public:
+    RouteRecorder();
+    
+    // 清空记录并退出回放
+    void clear();
+    
+    // 记录一个路口及在该路口的转向
+    void record(JunctionType junction, RouteTurn turn);
+    
+    // 修改最近一条记录的转向（例如左转检测后又转回主线）
+    bool amendLastTurn(RouteTurn turn);
+    
+    // 已记录的路口数
+    size_t size() const { return m_records.size(); }
+    
+    // 开始回放：最早的一条记录是进入搜索区域的路口，回到那里后的走向由目的地决定，不回放
+    bool startReplay();
+    
+    // 结束回放（剩余记录丢弃）
+    void stopReplay();
+    
+    bool isReplaying() const { return m_replaying; }
+    
+    // 获取回放中下一个路口的预期类型和转向
+    bool getReplayStep(JunctionType& expected, RouteTurn& turn) const;
+    
+    // 下一个路口已处理，前进到下一条记录
+    void advanceReplay();
+    
+    // 计算逆向经过路口时应检测到的类型和转向，掉头或无法逆推的记录返回false
+    static bool invert(JunctionType junction, RouteTurn turn,
+                       JunctionType& reverseJunction, RouteTurn& reverseTurn);
+    
+private:
+    struct RouteRecord {
+        uint8_t junction;   // JunctionType
+        uint8_t turn;       // RouteTurn
+    };
+    
+    RingBuffer<RouteRecord, ROUTE_RECORD_CAPACITY> m_records;
+    
+    bool m_replaying;
+    JunctionType m_replayJunction;
+    RouteTurn m_replayTurn;
+    
+    // 取出最近的记录并逆推为下一回放步骤
+    void loadNextReplayStep();
+};
+
+#endif // ROUTE_RECORDER_H
@@ -1,5 +1,6 @@
 #include "SimpleStateMachine.h"
 #include <avr/pgmspace.h>  // 添加PROGMEM支持
+#include "../Utils/TraceRecorder.h"
 
 // 调试宏定义，启用更详细的状态机日志
 #define DEBUG_STATE_MACHINE 1
@@ -36,23 +37,53 @@ SimpleStateMachine::SimpleStateMachine(SensorManager& sm, MotionController& mc,
     , m_blockCounter(0) // 初始化物块计数器
     , m_detectedColorCode(COLOR_UNKNOWN)
     , m_actionStartTime(0)
+    , m_armStep(0)
+    , m_commandParser(Serial2)
+    , m_receivedColor(COLOR_UNKNOWN)
+    , m_colorWaitStart(0)
+    , m_colorIdentifier(sm)
+    , m_routeStep(0)
+    , m_telemetry(Serial2, sm, nc)
+    , m_stateEnterTime(0)
 {
+    memset(m_stateStats, 0, sizeof(m_stateStats));
     // 初始化位域结构体的所有标志位
     m_flags.m_isActionComplete = false;
     m_flags.m_isTurning = false;
+    m_flags.m_isArmPrePositioned = false;
 }
 
 /**
  * 初始化函数
  */
 void SimpleStateMachine::init() {
-    // 设置初始状态
-    m_currentState = INITIALIZED;
+#if ENABLE_TRACE
+    // 轨迹从初始化开始记录，回放时才能重建导航控制器的状态
+    TraceRecorder::begin(&TRACE_SERIAL);
+#endif
+    // 运行中重置（RESET命令或重置信号）经状态表切换，执行当前状态的退出操作，
+    // 停止颜色采样、路线回放等；统计数据跨重置保留，可用STATS RESET清空
+    if (m_currentState != INITIALIZED) {
+        transitionTo(INITIALIZED);
+    } else if (m_stateStats[INITIALIZED].entryCount == 0) {
+        // 上电后第一次初始化：从此刻开始计入INITIALIZED的驻留时间
+        m_stateStats[INITIALIZED].entryCount = 1;
+        m_stateEnterTime = millis();
+    }
+    m_actionStartTime = 0;
+    m_armStep = 0;
+    m_flags.m_isActionComplete = false;
+    m_flags.m_isArmPrePositioned = false;
     m_zoneCounter = 0;
     m_colorCounter = 1;
     m_blockCounter = 0; // 重置物块计数器
     m_detectedColorCode = COLOR_UNKNOWN;
     m_flags.m_isTurning = false;
+    m_route.clear();
+    m_routeStep = 0;
+    m_routeRecorder.clear();
+    m_navigationController.setExpectedJunction(NO_JUNCTION);
+    m_scheduler.reset();
     
     // 初始化精确转向控制器
     m_accurateTurn.init();
@@ -64,22 +95,83 @@ void SimpleStateMachine::init() {
 }
 
 /**
- * 主循环更新函数 - 使用if-else逻辑而非switch-case
+ * 状态表：每个状态的进入/更新/退出处理函数及允许的目标状态
+ * 存放在Flash中，update()按当前状态直接索引，无需逐个比较
+ */
+#define STATE_BIT(state) ((uint16_t)1 << (state))
+// 任何状态都允许转入错误状态，也允许重置回初始状态（RESET命令或重置信号，见init()）
+#define ALLOW(mask) ((uint16_t)((mask) | STATE_BIT(ERROR_STATE) | STATE_BIT(INITIALIZED)))
+
+const SimpleStateMachine::StateHandlers SimpleStateMachine::STATE_TABLE[SYSTEM_STATE_COUNT] PROGMEM = {
+    // INITIALIZED
+    { nullptr, &SimpleStateMachine::tickInitialized, &SimpleStateMachine::exitInitialized,
+      ALLOW(STATE_BIT(OBJECT_FIND)) },
+    // OBJECT_FIND
+    { &SimpleStateMachine::enterObjectFind, &SimpleStateMachine::tickObjectFind, nullptr,
+      ALLOW(STATE_BIT(ULTRASONIC_DETECT) | STATE_BIT(CONTINUE_SEARCH)) },
+    // ULTRASONIC_DETECT
+    { &SimpleStateMachine::enterUltrasonicDetect, &SimpleStateMachine::tickUltrasonicDetect, nullptr,
+      ALLOW(STATE_BIT(OBJECT_GRAB) | STATE_BIT(CONTINUE_SEARCH) | STATE_BIT(RETURN_BASE)) },
+    // OBJECT_GRAB
+    { &SimpleStateMachine::enterObjectGrab, &SimpleStateMachine::tickObjectGrab, &SimpleStateMachine::exitObjectGrab,
+      ALLOW(STATE_BIT(OBJECT_PLACING)) },
+    // OBJECT_PLACING
+    { &SimpleStateMachine::enterObjectPlacing, &SimpleStateMachine::tickObjectPlacing, &SimpleStateMachine::exitObjectPlacing,
+      ALLOW(STATE_BIT(COUNT_INTERSECTION) | STATE_BIT(OBJECT_RELEASE)) },
+    // COUNT_INTERSECTION
+    { nullptr, &SimpleStateMachine::tickCountIntersection, nullptr,
+      ALLOW(STATE_BIT(OBJECT_RELEASE)) },
+    // OBJECT_RELEASE
+    { nullptr, &SimpleStateMachine::tickObjectRelease, &SimpleStateMachine::exitResetActionTimer,
+      ALLOW(STATE_BIT(ERGODIC_JUDGE)) },
+    // ERGODIC_JUDGE
+    { &SimpleStateMachine::enterErgodicJudge, &SimpleStateMachine::tickErgodicJudge, nullptr,
+      ALLOW(STATE_BIT(BACK_OBJECT_FIND) | STATE_BIT(RETURN_BASE)) },
+    // BACK_OBJECT_FIND
+    { nullptr, &SimpleStateMachine::tickBackObjectFind, nullptr,
+      ALLOW(STATE_BIT(OBJECT_FIND)) },
+    // RETURN_BASE
+    { nullptr, &SimpleStateMachine::tickReturnBase, nullptr,
+      ALLOW(STATE_BIT(BASE_ARRIVE)) },
+    // BASE_ARRIVE
+    { nullptr, &SimpleStateMachine::tickBaseArrive, nullptr,
+      ALLOW(STATE_BIT(END)) },
+    // END
+    { &SimpleStateMachine::enterEnd, &SimpleStateMachine::tickEnd, nullptr,
+      ALLOW(0) },
+    // ERROR_STATE
+    { nullptr, &SimpleStateMachine::tickError, nullptr,
+      ALLOW(0) },
+    // CONTINUE_SEARCH
+    { &SimpleStateMachine::enterContinueSearch, &SimpleStateMachine::tickContinueSearch, nullptr,
+      ALLOW(STATE_BIT(ULTRASONIC_DETECT)) }
+};
+
+/**
+ * 从Flash读取状态表项
+ */
+void SimpleStateMachine::loadStateHandlers(SystemState state, StateHandlers& handlers) {
+    memcpy_P(&handlers, &STATE_TABLE[state], sizeof(StateHandlers));
+}
+
+/**
+ * 主循环更新函数 - 按状态表分发
  */
 void SimpleStateMachine::update() {
-    // Modify entry log to use F() and print state
-    // Logger::info("SimpleStateMachine", F("Update entered. State: %d - Logger+F test"), m_currentState);
-    // Remove Serial test line
-    // Serial.println("SimpleStateMachine Update - Serial test");
+    // 处理Serial2收到的颜色与命令（非阻塞）
+    pollSerialCommands();
+    
+    // 输出遥测（按间隔，不阻塞）
+    m_telemetry.update(m_currentState);
+    
+    // 推进机械臂轨迹插补
+    m_roboticArm.update();
 
-    // 处理转向状态
+    // 处理转向状态：转向期间所有状态都暂停更新
     if (m_flags.m_isTurning) {
         m_accurateTurn.update();
         
         if (m_accurateTurn.isTurnComplete()) {
-#if USE_MINIMAL_LOGGING == 0
-            // saLogger::info("SimpleStateMachine", F("转向完成，继续状态机逻辑"));
-#endif
             m_flags.m_isTurning = false;
             m_accurateTurn.reset(); // Reset the AccurateTurn state to IDLE
             m_navigationController.resumeFollowing();
@@ -91,21 +183,305 @@ void SimpleStateMachine::update() {
     // 更新传感器数据
     m_sensorManager.updateAll();
     
-    // 使用if-else处理不同状态
-    if (m_currentState == INITIALIZED) {
-        // 等待触发信号
-        float distance;
-        bool success = false;
-        
-        // 测量新的距离
-        unsigned long duration = m_sensorManager.measurePulseDuration();
-        if (duration > 0 && duration < ULTRASONIC_PULSE_TIMEOUT) {
-            distance = m_sensorManager.getDistanceCmFromDuration(duration);
-            success = true;
+    if (m_currentState >= SYSTEM_STATE_COUNT) {
+        Logger::error("SimpleStateMachine", "未知系统状态：%d", m_currentState);
+        transitionTo(ERROR_STATE);
+        return;
+    }
+    
+    StateHandlers handlers;
+    loadStateHandlers(m_currentState, handlers);
+    (this->*handlers.tick)();
+}
+
+/**
+ * 更新导航并处理导航错误
+ * @return 到达路口时返回true，junction为检测到的路口类型
+ */
+bool SimpleStateMachine::pollJunction(JunctionType& junction) {
+    m_navigationController.update();
+    
+    NavigationState navState = m_navigationController.getCurrentNavigationState();
+    
+    if (navState == NAV_AT_JUNCTION) {
+        junction = m_navigationController.getDetectedJunctionType();
+        return true;
+    }
+    if (navState == NAV_ERROR) {
+        Logger::error("SimpleStateMachine", "导航错误，进入ERROR状态");
+        transitionTo(ERROR_STATE);
+    }
+    return false;
+}
+
+/**
+ * 规划一段路线
+ * @return 规划成功返回true；失败时清空路线，由各状态按路口计数导航
+ */
+bool SimpleStateMachine::planLeg(uint8_t from, uint8_t to) {
+    m_routeStep = 0;
+    
+    uint16_t length = 0;
+    if (from == COURSE_NO_NODE || to == COURSE_NO_NODE ||
+        !CourseMap::planRoute(from, to, m_route, &length)) {
+        m_route.clear();
+        Logger::warning("SimpleStateMachine", "无法规划路线，使用路口计数导航");
+        return false;
+    }
+    
+#if USE_MINIMAL_LOGGING == 0
+    char fromName[8];
+    char toName[8];
+    Logger::info("SimpleStateMachine", "规划路线 %s -> %s，%d个路口，全长%d cm",
+               CourseMap::nodeName(from, fromName, sizeof(fromName)),
+               CourseMap::nodeName(to, toName, sizeof(toName)),
+               m_route.size(), length);
+#endif
+    return true;
+}
+
+/**
+ * 在路口处执行路线的下一步
+ * 检测到的路口不支持计划的动作时放弃路线，本路口及之后交由计数逻辑处理
+ */
+SimpleStateMachine::RouteProgress SimpleStateMachine::followRoute(JunctionType junction) {
+    if (m_routeStep >= m_route.size()) {
+        return ROUTE_INACTIVE;
+    }
+    
+    const RouteStep& step = m_route[m_routeStep];
+    RouteTurn turn = static_cast<RouteTurn>(step.turn);
+    char nodeName[8];
+    CourseMap::nodeName(step.node, nodeName, sizeof(nodeName));
+    
+    if (!CourseMap::isTurnAvailable(junction, turn)) {
+        Logger::warning("SimpleStateMachine", "路线偏离：%s处应为%s，检测到%s，改用路口计数导航",
+                      nodeName, this->junctionTypeToString(static_cast<JunctionType>(step.expected)),
+                      this->junctionTypeToString(junction));
+        m_route.clear();
+        m_routeStep = 0;
+        return ROUTE_INACTIVE;
+    }
+    
+#if USE_MINIMAL_LOGGING == 0
+    Logger::info("SimpleStateMachine", "路线 %d/%d：%s %s", 
+               m_routeStep + 1, m_route.size(), nodeName, CourseMap::turnName(turn));
+#endif
+    
+    executeRouteTurn(turn);
+    
+    m_routeStep++;
+    return (m_routeStep >= m_route.size()) ? ROUTE_COMPLETE : ROUTE_IN_PROGRESS;
+}
+
+/**
+ * 执行路口处的转向动作
+ */
+void SimpleStateMachine::executeRouteTurn(RouteTurn turn) {
+    switch (turn) {
+        case ROUTE_LEFT:
+            m_accurateTurn.startTurnLeft();
+            m_flags.m_isTurning = true;
+            break;
+        case ROUTE_RIGHT:
+            m_accurateTurn.startTurnRight();
+            m_flags.m_isTurning = true;
+            break;
+        case ROUTE_UTURN:
+            m_accurateTurn.startUTurn();
+            m_flags.m_isTurning = true;
+            break;
+        case ROUTE_ARRIVE:
+            // 到达终点后的动作由当前状态决定
+            break;
+        default:
+            m_navigationController.resumeFollowing();
+            break;
+    }
+}
+
+/**
+ * 回放模式下处理路口
+ * 检测到的路口与记录不符时结束回放；有规划路线时由路线决定转向，
+ * 两者转向不同说明从这里开始离开来时的路，同样结束回放
+ * @return 已按回放执行转向时返回true
+ */
+bool SimpleStateMachine::followReplay(JunctionType junction) {
+    JunctionType expected;
+    RouteTurn turn;
+    if (!m_routeRecorder.getReplayStep(expected, turn)) {
+        return false;
+    }
+    
+    if (junction != expected) {
+        Logger::warning("SimpleStateMachine", "回放路口不符：应为%s，检测到%s，结束回放",
+                      this->junctionTypeToString(expected), this->junctionTypeToString(junction));
+        m_routeRecorder.stopReplay();
+        updateJunctionHint();
+        return false;
+    }
+    
+    m_routeRecorder.advanceReplay();
+    
+#if USE_COURSE_PLANNER
+    if (m_routeStep < m_route.size()) {
+        if (m_route[m_routeStep].turn != turn) {
+#if USE_MINIMAL_LOGGING == 0
+            Logger::info("SimpleStateMachine", "规划路线在此离开来时的路，结束回放");
+#endif
+            m_routeRecorder.stopReplay();
         }
-        
-        if (success) {
-            if (distance < 30.0f && distance > 0) {
+        updateJunctionHint();
+        return false;
+    }
+#endif
+    
+#if USE_MINIMAL_LOGGING == 0
+    Logger::info("SimpleStateMachine", "回放：%s处%s", 
+               this->junctionTypeToString(junction), CourseMap::turnName(turn));
+#endif
+    executeRouteTurn(turn);
+    updateJunctionHint();
+    return true;
+}
+
+/**
+ * 把下一个回放路口告知导航控制器
+ */
+void SimpleStateMachine::updateJunctionHint() {
+    JunctionType expected;
+    RouteTurn turn;
+    if (m_routeRecorder.getReplayStep(expected, turn)) {
+        m_navigationController.setExpectedJunction(expected);
+    } else {
+        m_navigationController.setExpectedJunction(NO_JUNCTION);
+    }
+}
+
+/**
+ * 搜索途中经过非目标取物区时直接通过
+ * 只在左T路口跳过（左转弯处无法直行）
+ */
+bool SimpleStateMachine::skipPickupZone(JunctionType junction) {
+    if (junction != T_LEFT || m_scheduler.shouldScanZone(m_zoneCounter + 1)) {
+        return false;
+    }
+    
+    m_zoneCounter++;
+#if USE_MINIMAL_LOGGING == 0
+    Logger::info("SimpleStateMachine", "跳过取物区%d，目标为取物区%d", 
+               m_zoneCounter, m_scheduler.getTargetZone());
+#endif
+    m_navigationController.resumeFollowing();
+    m_routeRecorder.record(junction, ROUTE_STRAIGHT);
+    return true;
+}
+
+// ==================== 状态进入/退出处理 ====================
+
+void SimpleStateMachine::enterObjectFind() {
+    // 重置区域计数器
+    m_zoneCounter = 0;
+    // 从进入搜索区域的路口开始重新记录路径
+    m_routeRecorder.clear();
+    // 在此状态启用避障
+    m_navigationController.setObstacleAvoidanceEnabled(true);
+    // 开始巡线
+    m_navigationController.resumeFollowing();
+}
+
+void SimpleStateMachine::enterContinueSearch() {
+    // 继续搜索状态 - 不重置区域计数器
+    // 保持zoneCounter值，继续巡线
+    m_navigationController.resumeFollowing();
+}
+
+void SimpleStateMachine::enterUltrasonicDetect() {
+    // 准备进行超声波检测
+    m_navigationController.setObstacleAvoidanceEnabled(false);
+    m_actionStartTime = 0; // 确保计时器重置
+}
+
+void SimpleStateMachine::enterObjectPlacing() {
+    // 重置颜色计数器
+    m_navigationController.setObstacleAvoidanceEnabled(true);
+    m_colorCounter = 1;
+    
+#if USE_COURSE_PLANNER
+    // 从当前取物区规划到对应颜色的放置区
+    planLeg(CourseMap::findNode(NODE_PICKUP, m_zoneCounter),
+            CourseMap::findNode(NODE_DROP, m_scheduler.getDropZone(m_detectedColorCode)));
+#endif
+
+#if USE_ROUTE_REPLAY
+    // 掉头后沿搜索时的路径逆向返回主线
+    m_routeRecorder.startReplay();
+    updateJunctionHint();
+#endif
+}
+
+void SimpleStateMachine::enterErgodicJudge() {
+#if USE_COURSE_PLANNER
+    // 返回基地的路线固定；回到取物区继续搜索仍按路口计数
+    if (m_scheduler.isMissionComplete()) {
+        planLeg(CourseMap::findNode(NODE_DROP, m_scheduler.getDropZone(m_detectedColorCode)),
+                CourseMap::findNode(NODE_BASE, 0));
+    } else {
+        m_route.clear();
+        m_routeStep = 0;
+    }
+#endif
+}
+
+void SimpleStateMachine::enterEnd() {
+    // 停止所有动作
+    m_motionController.emergencyStop();
+    m_scheduler.printStatus();
+}
+
+void SimpleStateMachine::exitInitialized() {
+    // 离开基地，开始任务计时并选择第一个取物区
+    m_scheduler.startMission();
+}
+
+void SimpleStateMachine::exitResetActionTimer() {
+    // 重置计时器
+    m_actionStartTime = 0;
+}
+
+void SimpleStateMachine::enterObjectGrab() {
+    // 抓取后需要识别颜色，接近物块时就开始后台采样
+    m_sensorManager.setColorSampling(true);
+}
+
+void SimpleStateMachine::exitObjectGrab() {
+    m_actionStartTime = 0;
+    m_sensorManager.setColorSampling(false);
+}
+
+void SimpleStateMachine::exitObjectPlacing() {
+    m_actionStartTime = 0;
+    // 离开主线后回放不再适用
+    m_routeRecorder.stopReplay();
+    updateJunctionHint();
+}
+
+// ==================== 状态更新处理 ====================
+
+void SimpleStateMachine::tickInitialized() {
+    // 等待触发信号
+    float distance;
+    bool success = false;
+    
+    // 测量新的距离
+    unsigned long duration = m_sensorManager.measurePulseDuration();
+    if (duration > 0 && duration < ULTRASONIC_PULSE_TIMEOUT) {
+        distance = m_sensorManager.getDistanceCmFromDuration(duration);
+        success = true;
+    }
+    
+    if (success) {
+        if (distance < 30.0f && distance > 0) {
 #if USE_MINIMAL_LOGGING == 0
             Logger::info("SimpleStateMachine", "检测到启动触发，距离: %.2f cm", distance);
 #endif
@@ -113,614 +489,635 @@ void SimpleStateMachine::update() {
             delay(500);
             transitionTo(OBJECT_FIND);
         }
-        } else {
-            Logger::debug("SimpleStateMachine", "无法测量有效距离");
-        }
-
+    } else {
+        Logger::debug("SimpleStateMachine", "无法测量有效距离");
+    }
+}
 
+void SimpleStateMachine::tickObjectFind() {
+    // 寻找物块状态
+    m_zoneCounter = 0;
+    m_navigationController.setObstacleAvoidanceReverse(false);
+    
+    JunctionType junction;
+    if (!pollJunction(junction)) {
+        return;
     }
-    else if (m_currentState == OBJECT_FIND) {
-        // 寻找物块状态
-        m_zoneCounter = 0;
-        m_navigationController.setObstacleAvoidanceReverse(false);
-        if (!m_flags.m_isTurning) {
-            m_navigationController.update();
-            
-            NavigationState navState = m_navigationController.getCurrentNavigationState();
-            
-            if (navState == NAV_AT_JUNCTION) {
-                JunctionType junction = m_navigationController.getDetectedJunctionType();
-                
-#if USE_MINIMAL_LOGGING == 0
-                // Modify this log: Remove F() macro
-                // Logger::info("SimpleStateMachine", "OBJECT_FIND - Junction: %s (No F() test)", this->junctionTypeToString(junction));
-                // Original line commented out:
-                // Logger::info("SimpleStateMachine", F("OBJECT_FIND状态 - 检测到路口: %s"), 
-                //            this->junctionTypeToString(junction));
-#endif
-                
-                if (junction == T_LEFT || junction == LEFT_TURN) {
+    
+    if (skipPickupZone(junction)) {
+        // 保留已跳过的区域计数
+        transitionTo(CONTINUE_SEARCH);
+    }
+    else if (junction == T_LEFT || junction == LEFT_TURN) {
 #if USE_MINIMAL_LOGGING == 0
-                    Logger::info("SimpleStateMachine", F("左T形路口或左转弯，直接进入超声波检测"));
+        Logger::info("SimpleStateMachine", F("左T形路口或左转弯，直接进入超声波检测"));
 #endif
-                    // 不需要左转，直接进入超声波检测状态
-                    transitionTo(ULTRASONIC_DETECT);
-                }
-                else if (junction == T_RIGHT) {
-                    m_navigationController.resumeFollowing();
-                }
-                else if (junction == RIGHT_TURN ) {
+        // 先按左转记录，未发现物块转回主线时再修正
+        m_routeRecorder.record(junction, ROUTE_LEFT);
+        // 不需要左转，直接进入超声波检测状态
+        transitionTo(ULTRASONIC_DETECT);
+    }
+    else if (junction == RIGHT_TURN) {
 #if USE_MINIMAL_LOGGING == 0
-                    Logger::info("SimpleStateMachine", F("执行精确右转"));
+        Logger::info("SimpleStateMachine", F("执行精确右转"));
 #endif
-                    m_accurateTurn.startTurnRight();
-                    m_flags.m_isTurning = true;
-                    m_navigationController.resumeFollowing();
-                }
-                else {
-                    m_navigationController.resumeFollowing();
-                }
-            }
-            else if (navState == NAV_ERROR) {
-                Logger::error("SimpleStateMachine", F("导航错误，进入ERROR状态"));
-                transitionTo(ERROR_STATE);
-            }
-        }
+        m_accurateTurn.startTurnRight();
+        m_flags.m_isTurning = true;
+        m_navigationController.resumeFollowing();
+        m_routeRecorder.record(junction, ROUTE_RIGHT);
     }
-    else if (m_currentState == ULTRASONIC_DETECT) {
-        // 超声波检测状态
-        if (m_flags.m_isTurning) {
-            return;
-        }
+    else {
+        // T_RIGHT及其他路口直行
+        m_navigationController.resumeFollowing();
+        m_routeRecorder.record(junction, ROUTE_STRAIGHT);
+    }
+}
+
+void SimpleStateMachine::tickUltrasonicDetect() {
+    // 超声波检测状态
+    if (m_actionStartTime == 0) {
+#if USE_MINIMAL_LOGGING == 0
+        Logger::info("SimpleStateMachine", F("超声波检测状态，执行精确左转"));
+#endif
+        m_accurateTurn.startTurnLeft();
+        m_flags.m_isTurning = true;
         
-        if (m_actionStartTime == 0) {
+        m_zoneCounter++;
+        m_actionStartTime = millis();
+        return;
+    }
+    
+    float distance = OBJECT_DETECTION_THRESHOLD;
+    
+    // 测量新的距离
+    unsigned long duration = m_sensorManager.measurePulseDuration();
+    if (duration > 0 && duration < ULTRASONIC_PULSE_TIMEOUT) {
+        distance = m_sensorManager.getDistanceCmFromDuration(duration);
+    }
+    
+    if (distance < OBJECT_DETECTION_THRESHOLD) {
+#if USE_MINIMAL_LOGGING == 0
+        Logger::info("SimpleStateMachine", "检测到物块，距离: %f cm", distance);
+#endif
+        m_scheduler.onZoneScanned(m_zoneCounter, true);
+        m_actionStartTime = 0;
+        transitionTo(OBJECT_GRAB);
+    } 
+    else if (millis() - m_actionStartTime > 1000) {
 #if USE_MINIMAL_LOGGING == 0
-            Logger::info("SimpleStateMachine", F("超声波检测状态，执行精确左转"));
+        Logger::info("SimpleStateMachine", "未检测到物块，执行右转并继续循线");
+#endif
+        m_actionStartTime = 0;
+        
+        // 转回主线，该路口实际为直行通过
+        m_routeRecorder.amendLastTurn(ROUTE_STRAIGHT);
+        m_scheduler.onZoneScanned(m_zoneCounter, false);
+        
+        // 前方没有可去的区域（剩余区域都已排除，或只剩此前跳过的区域）：
+        // 再左转朝向基地方向，返回基地，不再向前驶入死路
+        if (m_scheduler.isMissionComplete() || !m_scheduler.hasTargetAhead(m_zoneCounter)) {
+            if (!m_scheduler.isMissionComplete()) {
+                Logger::warning("SimpleStateMachine", "前方没有可取的物块，跳过的取物区未检测");
+            }
+#if USE_MINIMAL_LOGGING < 2
+            Logger::info("SimpleStateMachine", "没有可取的物块，已放置%d个，返回基地", m_blockCounter);
 #endif
             m_accurateTurn.startTurnLeft();
             m_flags.m_isTurning = true;
-            
-            m_zoneCounter++;
-            m_actionStartTime = millis();
-#if USE_MINIMAL_LOGGING == 0
-            // Logger::info("SimpleStateMachine", "进入超声波检测状态，执行左转，区域计数: %d", m_zoneCounter);
+#if USE_COURSE_PLANNER
+            // 取物区所在路口的编号与取物区相同；车头已朝向基地方向
+            planLeg(CourseMap::findNode(NODE_JUNCTION, m_zoneCounter), CourseMap::findNode(NODE_BASE, 0));
 #endif
+            transitionTo(RETURN_BASE);
             return;
         }
-        //m_navigationController.resumeFollowing();
-        float distance;
-        bool success = false;
         
-        // 测量新的距离
-        unsigned long duration = m_sensorManager.measurePulseDuration();
-        if (duration > 0 && duration < ULTRASONIC_PULSE_TIMEOUT) {
-            distance = m_sensorManager.getDistanceCmFromDuration(duration);
-            success = true;
-        }
-
+        // 执行右转
+        m_accurateTurn.startTurnRight();
+        m_flags.m_isTurning = true;
         
-        if (distance < OBJECT_DETECTION_THRESHOLD) {
+        // 转到CONTINUE_SEARCH状态，继续循线前进直到遇到左转或左T路口
+        // 这样不会重置zoneCounter
+        transitionTo(CONTINUE_SEARCH);
+    }
+}
+
+void SimpleStateMachine::tickContinueSearch() {
+    // 继续搜索状态 - 右转后继续循线寻找物块
+    // 此状态逻辑类似OBJECT_FIND，但不会重置zoneCounter
+    JunctionType junction;
+    if (!pollJunction(junction)) {
+        return;
+    }
+    
 #if USE_MINIMAL_LOGGING == 0
-            Logger::info("SimpleStateMachine", "检测到物块，距离: %f cm", distance);
+    Logger::info("SimpleStateMachine", F("CONTINUE_SEARCH状态 - 检测到路口: %s"), 
+               this->junctionTypeToString(junction));
 #endif
-            m_actionStartTime = 0;
-            transitionTo(OBJECT_GRAB);
-        } 
-        else if (millis() - m_actionStartTime > 1000) {
+    
+    if (skipPickupZone(junction)) {
+        return;
+    }
+    
+    if (junction == T_LEFT || junction == LEFT_TURN) {
 #if USE_MINIMAL_LOGGING == 0
-            Logger::info("SimpleStateMachine", "未检测到物块，执行右转并继续循线");
+        Logger::info("SimpleStateMachine", F("左T形路口或左转弯，进入超声波检测"));
 #endif
-            m_actionStartTime = 0;
-            
-            // 执行右转
-            m_accurateTurn.startTurnRight();
-            m_flags.m_isTurning = true;
-            
-            // 转到CONTINUE_SEARCH状态，继续循线前进直到遇到左转或左T路口
-            // 这样不会重置zoneCounter
-            transitionTo(CONTINUE_SEARCH);
-        }
+        // 遇到左转或左T路口，再次进入超声波检测
+        m_routeRecorder.record(junction, ROUTE_LEFT);
+        transitionTo(ULTRASONIC_DETECT);
     }
-    else if (m_currentState == CONTINUE_SEARCH) {
-        // 继续搜索状态 - 右转后继续循线寻找物块
-        // 此状态逻辑类似OBJECT_FIND，但不会重置zoneCounter
+    else {
+        m_navigationController.resumeFollowing();
+        m_routeRecorder.record(junction, ROUTE_STRAIGHT);
+    }
+}
+
+void SimpleStateMachine::tickObjectGrab() {
+    // 抓取物块状态
+    // 在此状态禁用避障
+    m_navigationController.setObstacleAvoidanceEnabled(false);
+    // 设置临时基础速度
+    m_navigationController.setBaseSpeed(40);
+    if (m_actionStartTime == 0) {
+        m_actionStartTime = millis();
+        m_flags.m_isActionComplete = false;
+        m_flags.m_isArmPrePositioned = false;
+        m_receivedColor = COLOR_UNKNOWN;
+        m_armStep = 0;
+    }
+    
+    if (m_armStep == 0) {
+        // 步骤0：循迹接近物块，直到满足抓取距离
+        float distance = m_roboticArm.getObjectDistance();
+        
+#if ARM_PIPELINED_GRAB
+        // 流水线抓取：进入触发距离后提前把机械臂放到预抓取姿态，
+        // 小车停下时夹爪已就位
+        if (!m_flags.m_isArmPrePositioned &&
+            distance >= ARM_PREGRASP_SAFE_DISTANCE &&
+            distance <= ARM_PREGRASP_TRIGGER_DISTANCE) {
+            m_roboticArm.moveToPreGrasp();
+            m_flags.m_isArmPrePositioned = true;
+#if USE_MINIMAL_LOGGING < 2
+            Logger::info("SimpleStateMachine", "距离 %d cm，开始预抓取", (int)distance);
+#endif
+        }
         
-        if (m_flags.m_isTurning) {
+        // 安全距离：预抓取尚未到位时不允许继续靠近物块，停车等待机械臂
+        if (m_flags.m_isArmPrePositioned && m_roboticArm.isMoving() &&
+            distance < ARM_PREGRASP_SAFE_DISTANCE) {
+            m_motionController.emergencyStop();
             return;
         }
+#endif
         
         m_navigationController.update();
         
         NavigationState navState = m_navigationController.getCurrentNavigationState();
         
-        if (navState == NAV_AT_JUNCTION) {
-            JunctionType junction = m_navigationController.getDetectedJunctionType();
-            
-#if USE_MINIMAL_LOGGING == 0
-            Logger::info("SimpleStateMachine", F("CONTINUE_SEARCH状态 - 检测到路口: %s"), 
-                       this->junctionTypeToString(junction));
-#endif
-            
-            if (junction == T_LEFT || junction == LEFT_TURN) {
-#if USE_MINIMAL_LOGGING == 0
-                Logger::info("SimpleStateMachine", F("左T形路口或左转弯，进入超声波检测"));
-#endif
-                // 遇到左转或左T路口，再次进入超声波检测
-                transitionTo(ULTRASONIC_DETECT);
-            }
-            else {
-                m_navigationController.resumeFollowing();
-            }
-        }
-        else if (navState == NAV_ERROR) {
-            Logger::error("SimpleStateMachine", F("导航错误，进入ERROR状态"));
+        if (navState == NAV_ERROR) {
+            Logger::error("SimpleStateMachine", F("导航控制器处于错误状态！"));
+            m_motionController.emergencyStop();
             transitionTo(ERROR_STATE);
-        }
-    }
-    else if (m_currentState == OBJECT_GRAB) {
-        // 抓取物块状态
-        if (m_flags.m_isTurning) {
             return;
         }
-
-        // 在此状态禁用避障
-        m_navigationController.setObstacleAvoidanceEnabled(false);
-        // 设置临时基础速度
-        m_navigationController.setBaseSpeed(40);
-        if (m_actionStartTime == 0) {
-            m_actionStartTime = millis();
-            m_flags.m_isActionComplete = false;
-            
-            static bool isFollowingLine = true;
-            
-            if (isFollowingLine) {
-                m_sensorManager.updateAll();
-                m_navigationController.update();
-                
-                NavigationState navState = m_navigationController.getCurrentNavigationState();
-                
-                if (navState == NAV_ERROR) {
-                    Logger::error("SimpleStateMachine", F("导航控制器处于错误状态！"));
-                    m_motionController.emergencyStop();
-                    transitionTo(ERROR_STATE);
-                    return;
-                }
-                
-                if (m_roboticArm.checkGrabCondition()) {
-                    m_motionController.emergencyStop();
-                    isFollowingLine = false;
+        
+        if (RoboticArm::isGrabDistance(distance)) {
+            m_motionController.emergencyStop();
+            m_armStep = 1;
 #if USE_MINIMAL_LOGGING < 2
-                    Logger::info("SimpleStateMachine", F("检测到物体，停止循迹，开始抓取"));
+            Logger::info("SimpleStateMachine", F("检测到物体，停止循迹，开始抓取"));
 #endif
-                } else {
-                    m_actionStartTime = 0;
-                    return;
-                }
+        }
+    }
+    else if (!m_flags.m_isActionComplete && !m_roboticArm.isScriptRunning() &&
+             !m_roboticArm.isMoving()) {
+        if (m_armStep == 1) {
+            // 抓取动作序列由ArmScripts中的GRAB脚本定义，结束时夹紧物块停在物料盒上方；
+            // 已预抓取时跳过第0帧（下降并张开夹爪）
+            m_roboticArm.playScript(ARM_SCRIPT_GRAB, m_flags.m_isArmPrePositioned ? 1 : 0);
+            m_flags.m_isArmPrePositioned = false;
+            m_armStep = 2;
+        } else if (m_armStep == 2) {
+#if COLOR_ID_ONBOARD
+            if (m_sensorManager.isSensorInitialized(SensorType::COLOR)) {
+#if USE_MINIMAL_LOGGING < 2
+                Logger::info("SimpleStateMachine", "抓取序列完成，夹紧状态下识别物块颜色");
+#endif
+                m_colorIdentifier.start();
+                m_armStep = 3;
+            } else {
+                Logger::warning("SimpleStateMachine", "颜色传感器未初始化，等待/color页面输入");
+                m_colorWaitStart = millis();
+                m_armStep = 4;
             }
-            
-            if (!isFollowingLine) {
-                // 执行机械臂操作（完整版）
-                m_roboticArm.adjustArm(2150, 450, 0);
-                if (millis() - m_actionStartTime < 2000) {
-                    m_sensorManager.updateAll();
-                    return;
-                }
-                
-                m_roboticArm.adjustArm(2150, 450, 900);
-                if (millis() - m_actionStartTime < 2000) {
-                    m_sensorManager.updateAll();
-                    return;
-                }
-                
-                m_roboticArm.adjustArm(1500, 1600, 900);
-                if (millis() - m_actionStartTime < 2000) {
-                    m_sensorManager.updateAll();
-                    return;
-                }
-                
-                m_roboticArm.adjustArm(1500, 1600, 0);
-                if (millis() - m_actionStartTime < 2000) {
-                    m_sensorManager.updateAll();
-                    return;
-                }
-                delay(1000);
+#else
 #if USE_MINIMAL_LOGGING < 2
-                Logger::info("SimpleStateMachine", F("抓取序列完成"));
-#endif
-                //Serial2.println("抓取序列完成");
-                //Serial2.println("等待颜色输入");
-                
-                // 调用新的函数读取颜色代码
-                m_detectedColorCode = readColorCodeFromSerial2();
-                
-                // 根据读取结果进行日志记录或处理
-                if (m_detectedColorCode == COLOR_UNKNOWN) {
-                    //Logger::warning("StateMachine", "未能从 Serial2 读取有效的颜色代码或超时。");
-                    // 这里可以添加错误处理逻辑，例如重试或进入错误状态
-                    // transitionTo(ERROR_STATE);
-                    m_detectedColorCode = COLOR_RED;
+            Logger::info("SimpleStateMachine", "抓取序列完成，等待颜色输入");
+#endif
+            m_colorWaitStart = millis();
+            m_armStep = 4;
+#endif
+        } else if (m_armStep == 3) {
+            // 传感器识别；期间收到的手动颜色优先
+            if (m_receivedColor != COLOR_UNKNOWN) {
+                m_detectedColorCode = m_receivedColor;
+                m_receivedColor = COLOR_UNKNOWN;
+                m_flags.m_isActionComplete = true;
+            } else if (m_colorIdentifier.update()) {
+                if (m_colorIdentifier.isIdentified()) {
+                    m_detectedColorCode = m_colorIdentifier.getColor();
+                    m_flags.m_isActionComplete = true;
                 } else {
-                    //Logger::info("StateMachine", "从 Serial2 读取到颜色代码: %d", m_detectedColorCode);
+                    Logger::warning("SimpleStateMachine", "颜色识别失败，等待/color页面输入");
+                    m_colorWaitStart = millis();
+                    m_armStep = 4;
+                }
+            }
+        } else {
+            // 颜色由pollSerialCommands()非阻塞接收，
+            // 超时则按识别时得票最多的颜色处理，没有有效读数时默认为红色
+            if (m_receivedColor != COLOR_UNKNOWN) {
+                m_detectedColorCode = m_receivedColor;
+                m_receivedColor = COLOR_UNKNOWN;
+                m_flags.m_isActionComplete = true;
+            } else if (millis() - m_colorWaitStart >= COLOR_WAIT_TIMEOUT) {
+                ColorCode fallback = COLOR_ID_ONBOARD ? m_colorIdentifier.getMajorityColor() : COLOR_UNKNOWN;
+                if (fallback == COLOR_UNKNOWN) {
+                    fallback = COLOR_RED;
                 }
-                
+                Logger::warning("SimpleStateMachine", "等待颜色代码超时 (%lu ms)，按颜色%d处理",
+                                (unsigned long)COLOR_WAIT_TIMEOUT, fallback);
+                m_detectedColorCode = fallback;
                 m_flags.m_isActionComplete = true;
-                isFollowingLine = true;
             }
         }
-        
-        if (m_flags.m_isActionComplete) {
+    }
+    
+    if (m_flags.m_isActionComplete) {
+        // 颜色确定后才松开夹爪（STOW脚本），等物块落入物料盒再掉头
+        if (m_armStep != 5) {
+            m_roboticArm.playScript(ARM_SCRIPT_STOW);
+            m_armStep = 5;
+            return;
+        }
+        if (m_roboticArm.isScriptRunning() || m_roboticArm.isMoving()) {
+            return;
+        }
+        m_scheduler.onBlockGrabbed(m_zoneCounter, m_detectedColorCode);
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", F("准备掉头并转换到放置状态"));
-            Logger::info("SimpleStateMachine", F("执行精确U型转弯"));
+        Logger::info("SimpleStateMachine", F("准备掉头并转换到放置状态"));
+        Logger::info("SimpleStateMachine", F("执行精确U型转弯"));
 #endif
-            Serial.println("准备掉头并转换到放置状态");
-            m_accurateTurn.startUTurn();
-            m_flags.m_isTurning = true;
-            
-            m_actionStartTime = 0; 
-            m_flags.m_isActionComplete = false;
-            
-            //Serial.println("\n0\n");
-            
-            transitionTo(OBJECT_PLACING);
-        }
+        Serial.println("准备掉头并转换到放置状态");
+        m_accurateTurn.startUTurn();
+        m_flags.m_isTurning = true;
         
-        if (millis() - m_actionStartTime > GRAB_TIMEOUT * 3 && !m_flags.m_isActionComplete) {
-             Logger::error("SimpleStateMachine", F("抓取操作超时！"));
-             m_actionStartTime = 0;
-             transitionTo(ERROR_STATE);
-        }
-    }
-    else if (m_currentState == OBJECT_PLACING) {
-        // 放置物体状态
-        // Check if currently turning first
-        if (m_flags.m_isTurning) {
-            return; // Wait for turn to complete
-            //Serial.println("\n ----- 1 ----- \n");
-        }
-        // Serial.println("\n ----- 2 ----- \n");
-        m_navigationController.update();
+        m_actionStartTime = 0; 
+        m_flags.m_isActionComplete = false;
         
-        NavigationState navState = m_navigationController.getCurrentNavigationState();
-        m_navigationController.setObstacleAvoidanceReverse(true);
-        if (navState == NAV_AT_JUNCTION) {
-            JunctionType junction = m_navigationController.getDetectedJunctionType();
-            
-#if USE_MINIMAL_LOGGING < 2
-            //Logger::info("SimpleStateMachine", "OBJECT_PLACING状态 - 检测到路口: %s", 
-            //           this->junctionTypeToString(junction));
-#endif
-            
-            if (junction == RIGHT_TURN || junction == T_FORWARD) {
-                // Replace MotionController turn with AccurateTurn
-                m_accurateTurn.startTurnRight();
-                m_flags.m_isTurning = true;
-                // Remove resumeFollowing, handled after turn completes
-            }
-            else if (junction == T_RIGHT) {
-                m_navigationController.resumeFollowing(); // Continue straight
-            }
-            else if (junction == LEFT_TURN) {
-                // Replace MotionController turn with AccurateTurn
-                m_accurateTurn.startTurnLeft();
-                m_flags.m_isTurning = true;
-                // Remove resumeFollowing, handled after turn completes
-            }
-            else if (junction == T_LEFT) {
-                // Replace MotionController turn with AccurateTurn
-                m_accurateTurn.startTurnLeft();
-                m_flags.m_isTurning = true;
-                m_colorCounter = 1; // Reset counter before counting
-                transitionTo(COUNT_INTERSECTION);
-            }
-            else {
-                m_navigationController.resumeFollowing();
-            }
-        }
-        else if (navState == NAV_ERROR) {
-            Logger::error("SimpleStateMachine", "导航错误，进入ERROR状态");
-            transitionTo(ERROR_STATE);
-        }
+        //Serial.println("\n0\n");
+        
+        transitionTo(OBJECT_PLACING);
+        return;
+    }
+    
+    if (millis() - m_actionStartTime > GRAB_TIMEOUT * 3 && !m_flags.m_isActionComplete) {
+         Logger::error("SimpleStateMachine", F("抓取操作超时！"));
+         m_actionStartTime = 0;
+         transitionTo(ERROR_STATE);
+    }
+}
+
+void SimpleStateMachine::tickObjectPlacing() {
+    // 放置物体状态
+    m_navigationController.setObstacleAvoidanceReverse(true);
+    
+    JunctionType junction;
+    if (!pollJunction(junction)) {
+        return;
+    }
+    
+#if USE_ROUTE_REPLAY
+    // 回放不包括进入搜索区域的路口，不会走到放置区支线
+    if (followReplay(junction)) {
+        return;
     }
-    else if (m_currentState == COUNT_INTERSECTION) {
-        // 路口计数状态
-        // Check if currently turning first
-        if (m_flags.m_isTurning) {
-            return; // Wait for turn to complete
-        }
-        m_navigationController.setBaseSpeed(40);
-        m_navigationController.update();
-        
-        NavigationState navState = m_navigationController.getCurrentNavigationState();
-        
-        if (navState == NAV_AT_JUNCTION) {
-            JunctionType junction = m_navigationController.getDetectedJunctionType();
-            
-            if (junction == T_RIGHT || junction == RIGHT_TURN) {
-                if (m_colorCounter == m_detectedColorCode) {
-#if USE_MINIMAL_LOGGING < 2
-                    Logger::info("SimpleStateMachine", "达到目标区域，执行精确右转");
-#endif
-                    // Replace MotionController turn with AccurateTurn
-                    m_accurateTurn.startTurnRight();
-                    m_flags.m_isTurning = true;
-                    transitionTo(OBJECT_RELEASE);
-                } else {
-                    m_colorCounter++;
-#if USE_MINIMAL_LOGGING < 2
-                    Logger::info("SimpleStateMachine", "颜色计数: %d/%d", m_colorCounter, m_detectedColorCode);
 #endif
-                    m_navigationController.resumeFollowing();
-                }
-            } else {
-                m_navigationController.resumeFollowing();
-            }
-        }
-        else if (navState == NAV_ERROR) {
-            Logger::error("SimpleStateMachine", "导航错误，进入ERROR状态");
-            transitionTo(ERROR_STATE);
+    
+#if USE_COURSE_PLANNER
+    RouteProgress progress = followRoute(junction);
+    if (progress == ROUTE_COMPLETE) {
+        transitionTo(OBJECT_RELEASE);
+        return;
+    }
+    if (progress == ROUTE_IN_PROGRESS) {
+        // 左转进入放置区支线后降速（与计数逻辑相同）
+        if (junction == T_LEFT && m_route[m_routeStep - 1].turn == ROUTE_LEFT) {
+            m_colorCounter = 1;
+            transitionTo(COUNT_INTERSECTION);
         }
+        return;
     }
-    else if (m_currentState == OBJECT_RELEASE) {
-        // 释放物体状态
-        if (m_actionStartTime == 0) {
-            m_actionStartTime = millis();
-            m_flags.m_isActionComplete = false;
-#if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", "进入物体释放状态，循迹前进1.5秒后停车");
 #endif
-            
-            m_navigationController.resumeFollowing();
-        }
-        
-        if (!m_flags.m_isActionComplete && (millis() - m_actionStartTime < 1500)) {
-            m_navigationController.update();
-            return;
+    
+    if (junction == RIGHT_TURN || junction == T_FORWARD) {
+        m_accurateTurn.startTurnRight();
+        m_flags.m_isTurning = true;
+    }
+    else if (junction == LEFT_TURN) {
+        m_accurateTurn.startTurnLeft();
+        m_flags.m_isTurning = true;
+    }
+    else if (junction == T_LEFT) {
+        m_accurateTurn.startTurnLeft();
+        m_flags.m_isTurning = true;
+        m_colorCounter = 1; // Reset counter before counting
+        transitionTo(COUNT_INTERSECTION);
+    }
+    else {
+        // T_RIGHT及其他路口直行
+        m_navigationController.resumeFollowing();
+    }
+}
+
+void SimpleStateMachine::tickCountIntersection() {
+    // 路口计数状态
+    m_navigationController.setBaseSpeed(40);
+    
+    JunctionType junction;
+    if (!pollJunction(junction)) {
+        return;
+    }
+    
+#if USE_COURSE_PLANNER
+    RouteProgress progress = followRoute(junction);
+    if (progress == ROUTE_COMPLETE) {
+        transitionTo(OBJECT_RELEASE);
+        return;
+    }
+    if (progress == ROUTE_IN_PROGRESS) {
+        // 同步计数，路线中途失效时计数逻辑可以接着走
+        if (junction == T_RIGHT || junction == RIGHT_TURN) {
+            m_colorCounter++;
         }
-        
-        if (!m_flags.m_isActionComplete) {
-            m_motionController.emergencyStop();
+        return;
+    }
+#endif
+    
+    if (junction == T_RIGHT || junction == RIGHT_TURN) {
+        if (m_colorCounter == m_scheduler.getDropZone(m_detectedColorCode)) {
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", "停车执行放置操作");
-            Logger::info("SimpleStateMachine", "抓紧物体");
+            Logger::info("SimpleStateMachine", "达到目标区域，执行精确右转");
 #endif
-            m_roboticArm.adjustArm(1500, 1600, 900);
-            if (millis() - m_actionStartTime < 2000) {
-                m_sensorManager.updateAll();
-                return;
-            }
-            
+            m_accurateTurn.startTurnRight();
+            m_flags.m_isTurning = true;
+            transitionTo(OBJECT_RELEASE);
+        } else {
+            m_colorCounter++;
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", "放下物体");
+            Logger::info("SimpleStateMachine", "放置区计数: %d/%d", 
+                       m_colorCounter, m_scheduler.getDropZone(m_detectedColorCode));
 #endif
-            m_roboticArm.adjustArm(2150, 450, 900);
-            if (millis() - m_actionStartTime < 2000) {
-                m_sensorManager.updateAll();
-                return;
-            }
-            
+            m_navigationController.resumeFollowing();
+        }
+    } else {
+        m_navigationController.resumeFollowing();
+    }
+}
+
+void SimpleStateMachine::tickObjectRelease() {
+    // 释放物体状态
+    if (m_actionStartTime == 0) {
+        m_actionStartTime = millis();
+        m_flags.m_isActionComplete = false;
+        m_armStep = 0;
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", "完全松开夹爪");
+        Logger::info("SimpleStateMachine", "进入物体释放状态，循迹前进1.5秒后停车");
 #endif
-            m_roboticArm.adjustArm(2150, 450, -50);
-            if (millis() - m_actionStartTime < 2000) {
-                m_sensorManager.updateAll();
-                return;
-            }
+        
+        m_navigationController.resumeFollowing();
+    }
+    
+    if (!m_flags.m_isActionComplete && (millis() - m_actionStartTime < 1500)) {
+        m_navigationController.update();
+        return;
+    }
+    
+    if (!m_flags.m_isActionComplete && m_armStep == 0) {
+        m_motionController.emergencyStop();
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", "复位机械臂");
+        Logger::info("SimpleStateMachine", "停车执行放置操作");
 #endif
-            m_roboticArm.reset();
-            if (millis() - m_actionStartTime < 2000) {
-                m_sensorManager.updateAll();
-                return;
-            }
-            
+        m_armStep = 1;
+    }
+    
+    if (!m_flags.m_isActionComplete && !m_roboticArm.isScriptRunning()) {
+        if (m_armStep == 1) {
+            // 释放动作序列由ArmScripts中的RELEASE脚本定义
+            m_roboticArm.playScript(ARM_SCRIPT_RELEASE);
+            m_armStep = 2;
+        } else {
             m_flags.m_isActionComplete = true;
             m_blockCounter++; // 物块计数器加1
+            m_scheduler.onBlockPlaced(CourseMap::findNode(NODE_DROP, m_scheduler.getDropZone(m_detectedColorCode)));
 #if USE_MINIMAL_LOGGING < 2
             Logger::info("SimpleStateMachine", "物体放置完成，物块计数: %d", m_blockCounter);
 #endif
         }
-        
-        if (m_flags.m_isActionComplete) {
+    }
+    
+    if (m_flags.m_isActionComplete) {
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", "开始掉头");
+        Logger::info("SimpleStateMachine", "开始掉头");
 #endif
-            m_accurateTurn.startUTurn();
-            m_flags.m_isTurning = true;
-            
-            m_actionStartTime = 0;
-            m_flags.m_isActionComplete = false;
-            
+        m_accurateTurn.startUTurn();
+        m_flags.m_isTurning = true;
+        
+        m_actionStartTime = 0;
+        m_flags.m_isActionComplete = false;
+        
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", "掉头中，完成后进入遍历判断状态");
+        Logger::info("SimpleStateMachine", "掉头中，完成后进入遍历判断状态");
 #endif
-            transitionTo(ERGODIC_JUDGE);
-        }
+        transitionTo(ERGODIC_JUDGE);
     }
-    else if (m_currentState == ERGODIC_JUDGE) {
-        // 遍历判断状态
-        // Check if currently turning first
-        if (m_flags.m_isTurning) {
-            return; // Wait for turn to complete
-        }
+}
 
-        m_navigationController.update();
-        
-        NavigationState navState = m_navigationController.getCurrentNavigationState();
+void SimpleStateMachine::tickErgodicJudge() {
+    // 遍历判断状态
+    JunctionType junction;
+    if (!pollJunction(junction)) {
+        return;
+    }
+    
+#if USE_COURSE_PLANNER
+    if (followRoute(junction) != ROUTE_INACTIVE) {
+#if USE_MINIMAL_LOGGING < 2
+        Logger::info("SimpleStateMachine", "已放置%d个物块，按规划路线返回基地", m_blockCounter);
+#endif
+        transitionTo(RETURN_BASE);
+        return;
+    }
+#endif
+    
+    if (junction == T_FORWARD || junction == LEFT_TURN || junction == RIGHT_TURN) {
+        m_accurateTurn.startTurnLeft();
+        m_flags.m_isTurning = true;
         
-        if (navState == NAV_AT_JUNCTION) {
-            JunctionType junction = m_navigationController.getDetectedJunctionType();
-            
-            if (junction == T_FORWARD || junction == LEFT_TURN || junction == RIGHT_TURN) {
-                // Replace MotionController turn with AccurateTurn
-                m_accurateTurn.startTurnLeft();
-                m_flags.m_isTurning = true;
-                
-                // Subsequent logic remains the same, executed after turn completes
-                if (m_blockCounter < 2) {
+        // 转向完成后进入下一状态
+        if (!m_scheduler.isMissionComplete()) {
 #if USE_MINIMAL_LOGGING < 2
-                    Logger::info("SimpleStateMachine", F("已放置物块数: %d，继续寻找物块"), m_blockCounter);
+            Logger::info("SimpleStateMachine", F("已放置物块数: %d，继续寻找物块"), m_blockCounter);
 #endif
-                    transitionTo(BACK_OBJECT_FIND);
-                } else {
+            transitionTo(BACK_OBJECT_FIND);
+        } else {
 #if USE_MINIMAL_LOGGING < 2
-                    Logger::info("SimpleStateMachine", F("已放置%d个物块，返回基地"), m_blockCounter);
+            Logger::info("SimpleStateMachine", F("已放置%d个物块，返回基地"), m_blockCounter);
 #endif
-                    transitionTo(RETURN_BASE);
-                }
-            } else {
-                m_navigationController.resumeFollowing();
-            }
-        }
-        else if (navState == NAV_ERROR) {
-            Logger::error("SimpleStateMachine", F("导航错误，进入ERROR状态"));
-            transitionTo(ERROR_STATE);
+            transitionTo(RETURN_BASE);
         }
+    } else {
+        m_navigationController.resumeFollowing();
     }
-    else if (m_currentState == BACK_OBJECT_FIND) {
-        // 返回寻找物块状态
-        // Check if currently turning first
-        if (m_flags.m_isTurning) {
-            return; // Wait for turn to complete
-        }
+}
 
-        m_navigationController.update();
-        
-        NavigationState navState = m_navigationController.getCurrentNavigationState();
-        
-        if (navState == NAV_AT_JUNCTION) {
-            JunctionType junction = m_navigationController.getDetectedJunctionType();
-            
+void SimpleStateMachine::tickBackObjectFind() {
+    // 返回寻找物块状态
+    JunctionType junction;
+    if (!pollJunction(junction)) {
+        return;
+    }
+    
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", "BACK_OBJECT_FIND状态 - 检测到路口: %s", 
-                       this->junctionTypeToString(junction));
+    Logger::info("SimpleStateMachine", "BACK_OBJECT_FIND状态 - 检测到路口: %s", 
+               this->junctionTypeToString(junction));
 #endif
-            
-            if (junction == T_FORWARD || junction == LEFT_TURN || junction == RIGHT_TURN) {
+    
+    if (junction == T_FORWARD || junction == LEFT_TURN || junction == RIGHT_TURN) {
 #if USE_MINIMAL_LOGGING < 2
-                Logger::info("SimpleStateMachine", "检测到T字路口，执行精确右转进入OBJECT_FIND状态");
+        Logger::info("SimpleStateMachine", "检测到T字路口，执行精确右转进入OBJECT_FIND状态");
 #endif
-                // Replace MotionController turn with AccurateTurn
-                m_accurateTurn.startTurnRight();
-                m_flags.m_isTurning = true;
-                transitionTo(OBJECT_FIND);
-            } else {
-                m_navigationController.resumeFollowing();
-            }
-        }
-        else if (navState == NAV_ERROR) {
-            Logger::error("SimpleStateMachine", F("导航错误，进入ERROR状态"));
-            transitionTo(ERROR_STATE);
-        }
+        m_accurateTurn.startTurnRight();
+        m_flags.m_isTurning = true;
+        transitionTo(OBJECT_FIND);
+    } else {
+        m_navigationController.resumeFollowing();
     }
-    else if (m_currentState == RETURN_BASE) {
-        // 返回基地状态
-        // Check if currently turning first
-        if (m_flags.m_isTurning) {
-            return; // Wait for turn to complete
-        }
+}
 
-        m_navigationController.update();
-        
-        NavigationState navState = m_navigationController.getCurrentNavigationState();
-        
-        if (navState == NAV_AT_JUNCTION) {
-            JunctionType junction = m_navigationController.getDetectedJunctionType();
-            
-#if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", F("RETURN_BASE状态 - 检测到路口: %s"), 
-                       this->junctionTypeToString(junction));
-#endif
-            
-            if (junction == T_FORWARD || junction == LEFT_TURN || junction == RIGHT_TURN) {
-                // Replace MotionController turn with AccurateTurn
-                m_accurateTurn.startTurnLeft();
-                m_flags.m_isTurning = true;
-                
-                // Subsequent logic remains the same, executed after turn completes
-                if (m_actionStartTime == 0) {
-                    m_actionStartTime = millis();
-                } else {
-                    transitionTo(BASE_ARRIVE);
-                }
-            } else {
-                m_navigationController.resumeFollowing();
-            }
-        }
-        else if (navState == NAV_ERROR) {
-            Logger::error("SimpleStateMachine", F("导航错误，进入ERROR状态"));
-            transitionTo(ERROR_STATE);
-        }
+void SimpleStateMachine::tickReturnBase() {
+    // 返回基地状态
+    JunctionType junction;
+    if (!pollJunction(junction)) {
+        return;
     }
-    else if (m_currentState == BASE_ARRIVE) {
-        // 到达基地状态
-        if (m_actionStartTime == 0) {
-            m_actionStartTime = millis();
-            m_motionController.moveForward(FOLLOW_SPEED);
+    
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", F("到达基地边缘，继续前进一段时间"));
+    Logger::info("SimpleStateMachine", F("RETURN_BASE状态 - 检测到路口: %s"), 
+               this->junctionTypeToString(junction));
 #endif
+    
+#if USE_COURSE_PLANNER
+    RouteProgress progress = followRoute(junction);
+    if (progress == ROUTE_COMPLETE) {
+        // 基地边界线：与计数逻辑相同，左转后进入到达基地状态
+        m_accurateTurn.startTurnLeft();
+        m_flags.m_isTurning = true;
+        transitionTo(BASE_ARRIVE);
+        return;
+    }
+    if (progress == ROUTE_IN_PROGRESS) {
+        // 记录转向时间，路线中途失效时计数逻辑可以接着走
+        if (m_flags.m_isTurning && m_actionStartTime == 0) {
+            m_actionStartTime = millis();
         }
+        return;
+    }
+#endif
+    
+    if (junction == T_FORWARD || junction == LEFT_TURN || junction == RIGHT_TURN) {
+        m_accurateTurn.startTurnLeft();
+        m_flags.m_isTurning = true;
         
-        m_sensorManager.updateAll();
-        
-        uint16_t irValues[8];
-        m_sensorManager.getInfraredSensorValues(irValues);
-        
-        bool isAllBlack = true;
-        for (int i = 0; i < 8; i++) {
-            if (irValues[i] < LINE_THRESHOLD) {
-                isAllBlack = false;
-                break;
-            }
+        // 第一次遇到路口只记录时间，第二次才进入到达基地状态
+        if (m_actionStartTime == 0) {
+            m_actionStartTime = millis();
+        } else {
+            transitionTo(BASE_ARRIVE);
         }
-        
-        if ((millis() - m_actionStartTime > 1000) || isAllBlack) {
-            m_motionController.emergencyStop();
+    } else {
+        m_navigationController.resumeFollowing();
+    }
+}
+
+void SimpleStateMachine::tickBaseArrive() {
+    // 到达基地状态
+    if (m_actionStartTime == 0) {
+        m_actionStartTime = millis();
+        m_motionController.moveForward(FOLLOW_SPEED);
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", F("到达基地，任务完成"));
+        Logger::info("SimpleStateMachine", F("到达基地边缘，继续前进一段时间"));
 #endif
-            transitionTo(END);
-        }
     }
-    else if (m_currentState == END) {
-        // 结束状态
-        m_motionController.emergencyStop();
+    
+    m_sensorManager.updateAll();
+    
+    uint16_t irValues[8];
+    m_sensorManager.getInfraredSensorValues(irValues);
+    
+    bool isAllBlack = true;
+    for (int i = 0; i < 8; i++) {
+        if (irValues[i] < LINE_THRESHOLD) {
+            isAllBlack = false;
+            break;
+        }
     }
-    else if (m_currentState == ERROR_STATE) {
-        // 错误状态
+    
+    if ((millis() - m_actionStartTime > 1000) || isAllBlack) {
         m_motionController.emergencyStop();
-        
-        float distance;
-        bool success = false;
-        
-        // 测量新的距离
-        unsigned long duration = m_sensorManager.measurePulseDuration();
-        if (duration > 0 && duration < ULTRASONIC_PULSE_TIMEOUT) {
-            distance = m_sensorManager.getDistanceCmFromDuration(duration);
-            success = true;
-        }
-        static float lastDistance = distance;
-        
-        if (abs(distance - lastDistance) > 20.0f) {
 #if USE_MINIMAL_LOGGING < 2
-            Logger::info("SimpleStateMachine", F("检测到重置信号，重新初始化"));
+        Logger::info("SimpleStateMachine", F("到达基地，任务完成"));
 #endif
-            init();
-            m_navigationController.init();
-            transitionTo(INITIALIZED);
-        }
-        
-        lastDistance = distance;
+        transitionTo(END);
     }
-    else {
-        Logger::error("SimpleStateMachine", F("未知系统状态：%d"), m_currentState);
-        transitionTo(ERROR_STATE);
+}
+
+void SimpleStateMachine::tickEnd() {
+    // 结束状态
+    m_motionController.emergencyStop();
+}
+
+void SimpleStateMachine::tickError() {
+    // 错误状态
+    m_motionController.emergencyStop();
+    
+    float distance;
+    bool success = false;
+    
+    // 测量新的距离
+    unsigned long duration = m_sensorManager.measurePulseDuration();
+    if (duration > 0 && duration < ULTRASONIC_PULSE_TIMEOUT) {
+        distance = m_sensorManager.getDistanceCmFromDuration(duration);
+        success = true;
     }
+    static float lastDistance = distance;
+    
+    if (abs(distance - lastDistance) > 20.0f) {
+#if USE_MINIMAL_LOGGING < 2
+        Logger::info("SimpleStateMachine", F("检测到重置信号，重新初始化"));
+#endif
+        // init()经transitionTo()切换回INITIALIZED
+        init();
+        m_navigationController.init();
+    }
+    
+    lastDistance = distance;
 }
 
+// ==================== 状态转换与统计 ====================
+
 /**
  * 状态转换函数
  */
@@ -729,6 +1126,18 @@ void SimpleStateMachine::transitionTo(SystemState newState) {
         return;
     }
     
+    StateHandlers handlers;
+    loadStateHandlers(m_currentState, handlers);
+    
+    // 检查状态表中是否允许该转换
+    if (newState >= SYSTEM_STATE_COUNT || !(handlers.allowedTransitions & STATE_BIT(newState))) {
+        Logger::error("SimpleStateMachine", "非法状态切换: %s -> %d，进入ERROR状态",
+                      systemStateToString(m_currentState), newState);
+        newState = ERROR_STATE;
+        if (m_currentState == ERROR_STATE) {
+            return;
+        }
+    }
     
 #if USE_MINIMAL_LOGGING < 2
     Logger::info("SimpleStateMachine", "状态切换: %s -> %s", 
@@ -737,46 +1146,70 @@ void SimpleStateMachine::transitionTo(SystemState newState) {
 #endif
     // 恢复基础速度
     m_navigationController.setBaseSpeed(FOLLOW_SPEED);
+    
     // 执行状态退出操作
-    if (m_currentState == OBJECT_GRAB || 
-        m_currentState == OBJECT_PLACING || 
-        m_currentState == OBJECT_RELEASE) {
-        // 重置计时器
-        m_actionStartTime = 0;
+    if (handlers.exit) {
+        (this->*handlers.exit)();
     }
     
     // 更新状态
-    m_currentState = newState;
+    recordStateChange(newState);
     
     // 执行状态进入操作
-    if (newState == OBJECT_FIND) {
-        // 重置区域计数器
-        if (m_currentState != ERGODIC_JUDGE) { // 如果不是从遍历判断进入，才重置
-            m_zoneCounter = 0;
-        }
-        // 在此状态禁用避障
-        m_navigationController.setObstacleAvoidanceEnabled(true);
-        // 开始巡线
-        m_navigationController.resumeFollowing();
-    }
-    else if (newState == CONTINUE_SEARCH) {
-        // 继续搜索状态 - 不重置区域计数器
-        // 保持zoneCounter值，继续巡线
-        m_navigationController.resumeFollowing();
+    loadStateHandlers(newState, handlers);
+    if (handlers.enter) {
+        (this->*handlers.enter)();
     }
-    else if (newState == ULTRASONIC_DETECT) {
-        // 准备进行超声波检测
-        m_navigationController.setObstacleAvoidanceEnabled(false);
-        m_actionStartTime = 0; // 确保计时器重置
+}
+
+/**
+ * 切换当前状态并更新驻留统计
+ */
+void SimpleStateMachine::recordStateChange(SystemState newState) {
+    unsigned long now = millis();
+    m_stateStats[m_currentState].totalTime += now - m_stateEnterTime;
+    m_stateStats[newState].entryCount++;
+    m_stateEnterTime = now;
+    TRACE_EVENT(TRACE_EVENT_SYSTEM_STATE, (uint8_t)m_currentState, (uint8_t)newState);
+    m_currentState = newState;
+}
+
+/**
+ * 获取某状态的统计数据（含当前状态尚未结算的时间）
+ */
+SimpleStateMachine::StateStats SimpleStateMachine::getStateStats(SystemState state) const {
+    StateStats stats = {0, 0};
+    if (state >= SYSTEM_STATE_COUNT) {
+        return stats;
     }
-    else if (newState == OBJECT_PLACING) {
-        // 重置颜色计数器
-        m_navigationController.setObstacleAvoidanceEnabled(true);
-        m_colorCounter = 1;
+    stats = m_stateStats[state];
+    if (state == m_currentState) {
+        stats.totalTime += millis() - m_stateEnterTime;
     }
-    else if (newState == END) {
-        // 停止所有动作
-        m_motionController.emergencyStop();
+    return stats;
+}
+
+/**
+ * 清空状态统计
+ */
+void SimpleStateMachine::resetStateStats() {
+    memset(m_stateStats, 0, sizeof(m_stateStats));
+    m_stateStats[m_currentState].entryCount = 1;
+    m_stateEnterTime = millis();
+}
+
+/**
+ * 输出各状态的进入次数与累计时间
+ */
+void SimpleStateMachine::printStateStats() {
+    Logger::info("SimpleStateMachine", "状态统计 (进入次数 / 累计时间ms):");
+    for (uint8_t i = 0; i < SYSTEM_STATE_COUNT; i++) {
+        StateStats stats = getStateStats(static_cast<SystemState>(i));
+        if (stats.entryCount == 0) {
+            continue;
+        }
+        Logger::info("SimpleStateMachine", "  %-18s %4u %8lu", systemStateToString(static_cast<SystemState>(i)),
+                     stats.entryCount, stats.totalTime);
     }
 }
 
@@ -796,11 +1229,12 @@ void SimpleStateMachine::logStateTransition(SystemState oldState, SystemState ne
  */
 const char* SimpleStateMachine::systemStateToString(SystemState state) {
     switch (state) {
-    
+        case INITIALIZED: return "INITIALIZED";
         case OBJECT_FIND: return "OBJECT_FIND";
         case ULTRASONIC_DETECT: return "ULTRASONIC_DETECT";
         case CONTINUE_SEARCH: return "CONTINUE_SEARCH";
         case OBJECT_GRAB: return "OBJECT_GRAB";
+        case OBJECT_RELEASE: return "OBJECT_RELEASE";
         case OBJECT_PLACING: return "OBJECT_PLACING";
         case COUNT_INTERSECTION: return "COUNT_INTERSECTION";
         case ERGODIC_JUDGE: return "ERGODIC_JUDGE";
@@ -841,20 +1275,76 @@ const char* SimpleStateMachine::junctionTypeToString(JunctionType type) const {
 
 /**
  * 处理上位机命令
+ * @return 命令已识别并执行时返回true
  */
-void SimpleStateMachine::handleCommand(const char* command) {
-    // 处理上位机发来的命令，例如启动、停止、重置等
-    if (strcmp(command, "START") == 0 && m_currentState == INITIALIZED) {
+bool SimpleStateMachine::handleCommand(const char* command) {
+    // 机械臂调试命令（ARM ...）交给机械臂处理；任务状态正在控制机械臂时只允许查看和停止
+    if (RoboticArm::isMotionCommand(command) &&
+        m_currentState != INITIALIZED && m_currentState != END && m_currentState != ERROR_STATE) {
+        Logger::warning("CMD", "任务运行中，忽略命令: %s", command);
+        return false;
+    }
+    if (m_roboticArm.handleCommand(command)) {
+        return true;
+    }
+    
+    // 任务配置命令（MISSION ...）；RESET/BLOCKS会清空或改变任务进度，只在任务开始前或结束后允许
+    if (MissionScheduler::isProgressCommand(command) &&
+        m_currentState != INITIALIZED && m_currentState != END) {
+        Logger::warning("CMD", "任务运行中，忽略命令: %s", command);
+        return false;
+    }
+    if (m_scheduler.handleCommand(command)) {
+        return true;
+    }
+    
+    // 颜色校准命令（CAL ...），采样会阻塞主循环约0.2秒，只在任务开始前允许
+    if (strncasecmp(command, "CAL", 3) == 0 && (command[3] == ' ' || command[3] == '\0')) {
+        if (m_currentState != INITIALIZED) {
+            Logger::warning("CMD", "任务运行中，忽略校准命令");
+            return false;
+        }
+        return m_sensorManager.handleCommand(command);
+    }
+    
+    // 处理上位机发来的命令，例如启动、停止、重置等（不区分大小写，支持单字母简写）
+    if (strcasecmp(command, "START") == 0 || strcasecmp(command, "S") == 0) {
+        if (m_currentState != INITIALIZED) {
+            Logger::warning("CMD", "任务已在运行，忽略启动命令");
+            return false;
+        }
         transitionTo(OBJECT_FIND);
+        Logger::info("CMD", "任务已启动");
     }
-    else if (strcmp(command, "STOP") == 0) {
+    else if (strcasecmp(command, "STOP") == 0 || strcasecmp(command, "Q") == 0) {
         m_motionController.emergencyStop();
         m_navigationController.stop();
+        Logger::info("CMD", "系统已停止");
     }
-    else if (strcmp(command, "RESET") == 0) {
+    else if (strcasecmp(command, "RESET") == 0 || strcasecmp(command, "R") == 0) {
         init();
         m_navigationController.init();
+        Logger::info("CMD", "系统已重置");
+    }
+    else if (strcasecmp(command, "PING") == 0) {
+        // 延时测量：只回复确认，不做任何动作
+    }
+    else if (strcasecmp(command, "STATS") == 0) {
+        printStateStats();
+    }
+    else if (strcasecmp(command, "STATS RESET") == 0) {
+        resetStateStats();
+        Logger::info("CMD", "状态统计已清空");
     }
+    else if (strcasecmp(command, "TEL ON") == 0 || strcasecmp(command, "TEL OFF") == 0) {
+        m_telemetry.setEnabled(strcasecmp(command, "TEL ON") == 0);
+        Logger::info("CMD", "遥测已%s", m_telemetry.isEnabled() ? "开启" : "关闭");
+    }
+    else {
+        Logger::warning("CMD", "未知命令: %s", command);
+        return false;
+    }
+    return true;
 }
 
 /**
@@ -871,6 +1361,13 @@ int SimpleStateMachine::getJunctionCounter() const {
     return m_zoneCounter;
 }
 
+/**
+ * 获取任务调度器
+ */
+const MissionScheduler& SimpleStateMachine::getScheduler() const {
+    return m_scheduler;
+}
+
 /**
  * 获取检测到的颜色
  */
@@ -878,62 +1375,22 @@ ColorCode SimpleStateMachine::getDetectedColor() const {
     return m_detectedColorCode;
 }
 
-// 新增的函数实现
-ColorCode SimpleStateMachine::readColorCodeFromSerial2(unsigned long timeoutMillis) {
-    //Logger::debug("StateMachine", "readColorCodeFromSerial2: 开始尝试读取颜色代码...");
-    String colorStr = "";
-    unsigned long startTime = millis();
-    bool receivedData = false;
-    ColorCode detectedColor = COLOR_UNKNOWN; // 默认值
-
-    while (millis() - startTime < timeoutMillis) {
-        if (Serial2.available() > 0) {
-            receivedData = true;
-            char c = Serial2.read();
-            // Logger::debug("StateMachine", "Read char: %c (ASCII: %d)", isprint(c) ? c : '.', c);
-
-            if (c == '\n' || c == '\r') {
-                if (colorStr.length() > 0) {
-                    // Logger::debug("StateMachine", "readColorCodeFromSerial2: 收到结束符，字符串为: '%s'", colorStr.c_str());
-                    break; // 收到结束符且字符串非空，结束读取
-                } else {
-                    // 忽略开头的或连续的换行/回车符
-                    continue;
-                }
-            }
-            // 只添加数字字符到字符串，防止接收到其他调试信息干扰
-            if (isdigit(c)) {
-                 colorStr += c;
-            }
-             else {
-                 // Logger::warning("StateMachine", "readColorCodeFromSerial2: 收到非数字字符 '%c' (ASCII: %d)，已忽略。", isprint(c) ? c : '.', c);
-             }
-
-        } 
-        // 不需要delay，让循环尽快检查 Serial2
-    }
-
-    if (colorStr.length() > 0) {
-        // Logger::debug("StateMachine", "readColorCodeFromSerial2: 读取完成，最终字符串: '%s'", colorStr.c_str());
-        int colorValue = colorStr.toInt();
-        // Logger::debug("StateMachine", "readColorCodeFromSerial2: 转换为整数: %d", colorValue);
-
-        if (colorValue >= 1 && colorValue <= 5) {
-            detectedColor = static_cast<ColorCode>(colorValue);
-            Logger::info("StateMachine", "readColorCodeFromSerial2: 解析到有效颜色代码: %d", detectedColor);
+/**
+ * 读取Serial2上已到达的数据并分发解析结果
+ */
+void SimpleStateMachine::pollSerialCommands() {
+    SerialEventType event;
+    while ((event = m_commandParser.poll()) != SERIAL_EVENT_NONE) {
+        // 带序号的命令执行后立即回复ACK/NAK，ESP32据此停止重发并统计往返延时
+        if (event == SERIAL_EVENT_COLOR) {
+            // 锁存颜色，由OBJECT_GRAB状态在需要时取用
+            m_receivedColor = m_commandParser.getColor();
+            m_commandParser.acknowledge(true);
+        } else if (event == SERIAL_EVENT_COMMAND) {
+            bool handled = handleCommand(m_commandParser.getCommand());
+            m_commandParser.acknowledge(handled, "rejected");
         } else {
-            Logger::warning("StateMachine", "readColorCodeFromSerial2: 收到无效或超出范围的颜色代码值: %d (来自字符串 '%s')", colorValue, colorStr.c_str());
-            detectedColor = COLOR_UNKNOWN;
+            m_commandParser.acknowledge(false, "invalid");
         }
-    } else if (receivedData) {
-        // Logger::debug("StateMachine", "readColorCodeFromSerial2: 只收到了换行/回车或非数字字符，未读取到有效颜色代码。");
-        detectedColor = COLOR_UNKNOWN;
-    } else {
-        // 超时
-        Logger::warning("StateMachine", "readColorCodeFromSerial2: 读取颜色代码超时 (%lu ms)，未收到有效数据。", timeoutMillis);
-        detectedColor = COLOR_UNKNOWN;
     }
-
-    // Logger::debug("StateMachine", "readColorCodeFromSerial2: 函数返回: %d", detectedColor);
-    return detectedColor;
-} 
\ No newline at end of file
+}
@@ -7,8 +7,14 @@
 #include "../Arm/RoboticArm.h"
 #include "../Control/NavigationController.h"
 #include "../Control/AccurateTurn.h"
+#include "../Control/CourseMap.h"
+#include "../Control/RouteRecorder.h"
+#include "../Control/MissionScheduler.h"
+#include "../Control/TelemetryReporter.h"
+#include "../Control/ColorIdentifier.h"
 #include "../Utils/Logger.h"
 #include "../Utils/Config.h"
+#include "../Utils/SerialCommandParser.h"
 
 // 前向声明
 class SensorManager;
@@ -18,7 +24,7 @@ class NavigationController;
 class AccurateTurn;
 
 /**
- * 简化版状态机，使用if-else逻辑替代switch-case
+ * 简化版状态机，由Flash中的状态表分发
  * 负责控制小车在不同任务阶段的行为
  * 与NavigationController协作，在路口处做出决策
  */
@@ -46,11 +52,25 @@ public:
     // 获取检测到的颜色
     ColorCode getDetectedColor() const;
     
-    // 处理上位机命令
-    void handleCommand(const char* command);
+    // 获取任务调度器
+    const MissionScheduler& getScheduler() const;
+    
+    // 处理上位机命令，命令已识别并执行时返回true
+    bool handleCommand(const char* command);
+    
+    // 单个状态的驻留统计
+    struct StateStats {
+        uint16_t entryCount;     // 进入次数
+        unsigned long totalTime; // 累计停留时间（毫秒）
+    };
+    
+    // 获取某状态的统计（当前状态包含尚未结算的时间）
+    StateStats getStateStats(SystemState state) const;
+    
+    // 清空/输出状态统计
+    void resetStateStats();
+    void printStateStats();
     
-    // 新增函数：从Serial2读取颜色代码
-    ColorCode readColorCodeFromSerial2(unsigned long timeoutMillis = 20000);
 private:
     // 组件引用
     SensorManager& m_sensorManager;
@@ -67,14 +87,105 @@ private:
     uint8_t m_blockCounter; // 物块计数器
     ColorCode m_detectedColorCode;
     unsigned long m_actionStartTime;
+    uint8_t m_armStep;      // 抓取/释放动作序列的当前步骤
+    
+    // Serial2命令/颜色解析
+    SerialCommandParser m_commandParser;
+    ColorCode m_receivedColor;       // 最近收到但尚未使用的颜色
+    unsigned long m_colorWaitStart;  // 开始等待颜色的时间
+    ColorIdentifier m_colorIdentifier; // 抓取后用颜色传感器识别物块
+    
+    // 规划路线（为空或已走完时按路口计数导航）
+    CourseRoute m_route;
+    uint8_t m_routeStep;             // 下一个待执行的路线步骤
+    
+    // 搜索路径记录，抓取后逆向回放
+    RouteRecorder m_routeRecorder;
+    
+    // 多物块任务调度
+    MissionScheduler m_scheduler;
+    
+    // 实时遥测（Serial2）
+    TelemetryReporter m_telemetry;
     
     // 使用位域节省内存
     struct {
         uint8_t m_isActionComplete : 1;
         uint8_t m_isTurning : 1;
+        uint8_t m_isArmPrePositioned : 1; // 接近物块时机械臂已开始预抓取
     } m_flags;
     
+    // 状态表项：进入/更新/退出处理函数（可为空，更新函数除外）及允许转入的状态位图
+    typedef void (SimpleStateMachine::*StateHandler)();
+    struct StateHandlers {
+        StateHandler enter;
+        StateHandler tick;
+        StateHandler exit;
+        uint16_t allowedTransitions;
+    };
+    static const StateHandlers STATE_TABLE[SYSTEM_STATE_COUNT];
+    
+    StateStats m_stateStats[SYSTEM_STATE_COUNT];
+    unsigned long m_stateEnterTime;  // 进入当前状态的时间
+    
+    static void loadStateHandlers(SystemState state, StateHandlers& handlers);
+    void recordStateChange(SystemState newState);
+    
+    // 各状态处理函数
+    void enterObjectFind();
+    void enterContinueSearch();
+    void enterUltrasonicDetect();
+    void enterObjectPlacing();
+    void enterErgodicJudge();
+    void enterObjectGrab();
+    void enterEnd();
+    void exitInitialized();
+    void exitResetActionTimer();
+    void exitObjectPlacing();
+    void exitObjectGrab();
+    
+    void tickInitialized();
+    void tickObjectFind();
+    void tickUltrasonicDetect();
+    void tickContinueSearch();
+    void tickObjectGrab();
+    void tickObjectPlacing();
+    void tickCountIntersection();
+    void tickObjectRelease();
+    void tickErgodicJudge();
+    void tickBackObjectFind();
+    void tickReturnBase();
+    void tickBaseArrive();
+    void tickEnd();
+    void tickError();
+    
+    // 更新导航，到达路口时返回true
+    bool pollJunction(JunctionType& junction);
+    
+    // 搜索途中经过非目标取物区时直接通过，已跳过时返回true
+    bool skipPickupZone(JunctionType junction);
+    
+    // 路线跟随结果
+    enum RouteProgress {
+        ROUTE_INACTIVE,     // 没有可用路线（或已偏离），由调用方按计数逻辑处理
+        ROUTE_IN_PROGRESS,  // 已执行本路口的动作
+        ROUTE_COMPLETE      // 已执行最后一步
+    };
+    
+    // 规划from到to的路线，失败时清空路线
+    bool planLeg(uint8_t from, uint8_t to);
+    // 在路口处执行路线的下一步
+    RouteProgress followRoute(JunctionType junction);
+    // 执行路口处的转向动作
+    void executeRouteTurn(RouteTurn turn);
+    
+    // 回放模式下处理路口，已按回放执行动作时返回true
+    bool followReplay(JunctionType junction);
+    // 把下一个回放路口告知导航控制器（无回放时清除）
+    void updateJunctionHint();
+    
     // 辅助函数
+    void pollSerialCommands();
     void executeStateTransition(SystemState newState);
     void logStateTransition(SystemState oldState, SystemState newState);
     const char* systemStateToString(SystemState state);
@@ -0,0 +1,72 @@
+#include "TelemetryReporter.h"
+#include "../Utils/FixedString.h"
+
+TelemetryReporter::TelemetryReporter(Stream& stream, SensorManager& sm, NavigationController& nc)
+    : m_stream(stream)
+    , m_sensorManager(sm)
+    , m_navigationController(nc)
+    , m_enabled(ENABLE_TELEMETRY)
+    , m_lastReportTime(0)
+    , m_loopCount(0)
+    , m_skipped(0)
+{
+}
+
+void TelemetryReporter::setEnabled(bool enabled) {
+    m_enabled = enabled;
+    m_loopCount = 0;
+    m_lastReportTime = millis();
+}
+
+void TelemetryReporter::update(SystemState state) {
+    if (!m_enabled) {
+        return;
+    }
+    m_loopCount++;
+    
+    unsigned long now = millis();
+    if (now - m_lastReportTime < TELEMETRY_INTERVAL_MS) {
+        return;
+    }
+    report(state, now);
+}
+
+void TelemetryReporter::report(SystemState state, unsigned long now) {
+    unsigned long elapsed = now - m_lastReportTime;
+    uint16_t loopHz = (uint16_t)((unsigned long)m_loopCount * 1000UL / elapsed);
+    m_lastReportTime = now;
+    m_loopCount = 0;
+    
+    // 红外掩码：传感器值为0表示检测到黑线
+    uint16_t values[8];
+    uint8_t irMask = 0;
+    m_sensorManager.getInfraredSensorValues(values);
+    for (uint8_t i = 0; i < 8; i++) {
+        if (values[i] == 0) {
+            irMask |= (1 << i);
+        }
+    }
+    
+    // AVR的printf不支持浮点，距离和转向量换算为整数
+    // 各字段限幅到4位数，保证整行不超过TELEMETRY_LINE_MAX
+    const LineFollower& follower = m_navigationController.getLineFollower();
+    int distanceMm = (int)constrain(m_sensorManager.getLastDistanceCm() * 10.0f, 0.0f, 9999.0f);
+    int turn = (int)(follower.getLastTurnAmount() * 1000.0f);
+    int error = constrain(follower.getLastError(), -9999, 9999);
+    int errorChange = constrain(follower.getLastErrorChange(), -9999, 9999);
+    if (loopHz > 9999) {
+        loopHz = 9999;
+    }
+    
+    FixedString<TELEMETRY_LINE_MAX> line;
+    line.appendf("$TEL:%lu,%u,%u,%u,%d,%d,%d,%d,%d,%u\n",
+                 now, (unsigned)state, (unsigned)m_navigationController.getCurrentNavigationState(),
+                 (unsigned)irMask, distanceMm, error, follower.getIntegral(),
+                 errorChange, turn, (unsigned)loopHz);
+    
+    if (line.truncated() || m_stream.availableForWrite() < (int)line.length()) {
+        m_skipped++;
+        return;
+    }
+    m_stream.write((const uint8_t*)line.c_str(), line.length());
+}
@@ -0,0 +1,44 @@
+#ifndef TELEMETRY_REPORTER_H
+#define TELEMETRY_REPORTER_H
+
+#include <Arduino.h>
+#include "../Utils/Config.h"
+#include "../Sensor/SensorManager.h"
+#include "NavigationController.h"
+
+/**
+ * 实时遥测
+ * 
+ * 每 TELEMETRY_INTERVAL_MS 向ESP32输出一行紧凑的遥测数据（整数CSV），
+ * ESP32解析后推送到遥测页面，代替调参时查看滚动日志：
+ *   $TEL:时间ms,系统状态,导航状态,红外掩码,距离mm,误差,积分,微分,转向量x1000,循环频率Hz
+ * 红外掩码第i位对应第i个传感器（0为最左），置1表示检测到黑线。
+ * 串口发送缓冲区放不下整行时跳过本次输出，不阻塞控制循环。
+ */
+class TelemetryReporter {
+public:
+    TelemetryReporter(Stream& stream, SensorManager& sm, NavigationController& nc);
+    
+    // 每次主循环调用一次：统计循环频率，到时间时输出一行
+    void update(SystemState state);
+    
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return m_enabled; }
+    
+    // 因发送缓冲区不足而跳过的行数
+    uint16_t getSkippedCount() const { return m_skipped; }
+    
+private:
+    Stream& m_stream;
+    SensorManager& m_sensorManager;
+    NavigationController& m_navigationController;
+    
+    bool m_enabled;
+    unsigned long m_lastReportTime;
+    uint16_t m_loopCount;       // 上次输出以来的主循环次数
+    uint16_t m_skipped;
+    
+    void report(SystemState state, unsigned long now);
+};
+
+#endif // TELEMETRY_REPORTER_H
@@ -1,5 +1,6 @@
 #include "MotionController.h"
 #include "../Utils/Logger.h"
+#include "../Utils/TraceRecorder.h"
 
 MotionController::MotionController() : speedFactor(DEFAULT_SPEED) {
     // 设置默认的电机补偿系数
@@ -29,6 +30,8 @@ void MotionController::setMotorState(MotorDriver &motor, float ratio, int motorI
 }
 
 void MotionController::mecanumDrive(float vx, float vy, float omega) {
+    TRACE_MOTOR(vx, vy, omega, speedFactor);
+    
     // 运动学模型计算
     float fl = -vx - vy - omega;
     float fr = -vx + vy - omega;
@@ -124,6 +127,7 @@ void MotionController::uTurn(int speed) {
 }
 
 void MotionController::emergencyStop() {
+    TRACE_MOTOR(0, 0, 0, 0);
     motorFL.stopMotor();
     motorFR.stopMotor();
     motorRL.stopMotor();
@@ -0,0 +1,216 @@
+#include "ColorCalibration.h"
+#include <EEPROM.h>
+
+#define COLOR_CAL_MAGIC   0xC0CA
+#define COLOR_CAL_MIN_STD 2.0f   // 协方差对角线下限（标准差），与 tools/color_lut.py 的 MIN_STD 一致
+
+struct ColorCalibrationHeader {
+    uint16_t magic;
+    uint8_t version;
+    uint16_t length;
+} __attribute__((packed));
+
+// CRC-16/CCITT-FALSE
+static uint16_t crc16Update(uint16_t crc, const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static void eepromRead(int address, uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        data[i] = EEPROM.read(address + i);
+    }
+}
+
+static void eepromWrite(int address, const uint8_t* data, size_t length) {
+    // update() 只写入变化的字节，减少擦写次数
+    for (size_t i = 0; i < length; i++) {
+        EEPROM.update(address + i, data[i]);
+    }
+}
+
+bool ColorCalibrationStore::load(ColorCalibrationData& data) {
+    ColorCalibrationHeader header;
+    eepromRead(COLOR_CAL_EEPROM_ADDR, (uint8_t*)&header, sizeof(header));
+    if (header.magic != COLOR_CAL_MAGIC || header.version != COLOR_CAL_VERSION ||
+        header.length != sizeof(ColorCalibrationData)) {
+        return false;
+    }
+
+    ColorCalibrationData loaded;
+    int address = COLOR_CAL_EEPROM_ADDR + sizeof(header);
+    eepromRead(address, (uint8_t*)&loaded, sizeof(loaded));
+    uint16_t stored;
+    eepromRead(address + sizeof(loaded), (uint8_t*)&stored, sizeof(stored));
+
+    uint16_t crc = crc16Update(0xFFFF, (const uint8_t*)&header, sizeof(header));
+    crc = crc16Update(crc, (const uint8_t*)&loaded, sizeof(loaded));
+    if (crc != stored) {
+        return false;
+    }
+    data = loaded;
+    return true;
+}
+
+bool ColorCalibrationStore::save(const ColorCalibrationData& data) {
+    ColorCalibrationHeader header = { COLOR_CAL_MAGIC, COLOR_CAL_VERSION, sizeof(ColorCalibrationData) };
+    uint16_t crc = crc16Update(0xFFFF, (const uint8_t*)&header, sizeof(header));
+    crc = crc16Update(crc, (const uint8_t*)&data, sizeof(data));
+
+    // 先写数据和CRC，最后写头，写入中途断电时不会留下头部有效的半条记录
+    int address = COLOR_CAL_EEPROM_ADDR + sizeof(header);
+    ColorCalibrationHeader invalid = header;
+    invalid.magic = 0xFFFF;
+    eepromWrite(COLOR_CAL_EEPROM_ADDR, (const uint8_t*)&invalid, sizeof(invalid));
+    eepromWrite(address, (const uint8_t*)&data, sizeof(data));
+    eepromWrite(address + sizeof(data), (const uint8_t*)&crc, sizeof(crc));
+    eepromWrite(COLOR_CAL_EEPROM_ADDR, (const uint8_t*)&header, sizeof(header));
+
+    // 回读校验
+    ColorCalibrationData check;
+    return load(check) && memcmp(&check, &data, sizeof(data)) == 0;
+}
+
+void ColorCalibrationStore::erase() {
+    uint16_t magic = 0xFFFF;
+    eepromWrite(COLOR_CAL_EEPROM_ADDR, (const uint8_t*)&magic, sizeof(magic));
+}
+
+int16_t colorHueDelta(uint8_t a, uint8_t b) {
+    int16_t delta = (int16_t)a - (int16_t)b;
+    if (delta >= 120) {
+        delta -= 240;
+    } else if (delta < -120) {
+        delta += 240;
+    }
+    return delta;
+}
+
+static uint8_t wrapHue(int16_t h) {
+    while (h < 0) {
+        h += 240;
+    }
+    while (h >= 240) {
+        h -= 240;
+    }
+    return (uint8_t)h;
+}
+
+ColorSampleAccumulator::ColorSampleAccumulator() {
+    reset();
+}
+
+void ColorSampleAccumulator::reset() {
+    m_count = 0;
+    m_refH = 0;
+    m_minDh = m_maxDh = 0;
+    m_minS = m_minL = 255;
+    m_maxS = m_maxL = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        m_sum[i] = 0;
+    }
+    for (uint8_t i = 0; i < 6; i++) {
+        m_sumSq[i] = 0;
+    }
+}
+
+void ColorSampleAccumulator::add(uint8_t h, uint8_t s, uint8_t l) {
+    if (m_count == 0) {
+        m_refH = h;
+    }
+    if (m_count == 255) {
+        return;
+    }
+    m_count++;
+
+    int16_t dh = colorHueDelta(h, m_refH);
+    if (dh < m_minDh) m_minDh = dh;
+    if (dh > m_maxDh) m_maxDh = dh;
+    if (s < m_minS) m_minS = s;
+    if (s > m_maxS) m_maxS = s;
+    if (l < m_minL) m_minL = l;
+    if (l > m_maxL) m_maxL = l;
+
+    float x[3] = { (float)dh, (float)s, (float)l };
+    uint8_t k = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        m_sum[i] += x[i];
+        for (uint8_t j = i; j < 3; j++) {
+            m_sumSq[k++] += x[i] * x[j];
+        }
+    }
+}
+
+bool ColorSampleAccumulator::toThreshold(ColorThreshold& threshold) const {
+    if (m_count < 3) {
+        return false;
+    }
+    threshold.minH = wrapHue(m_refH + m_minDh);
+    threshold.maxH = wrapHue(m_refH + m_maxDh);
+    threshold.minS = m_minS;
+    threshold.maxS = m_maxS;
+    threshold.minL = m_minL;
+    threshold.maxL = m_maxL;
+    return true;
+}
+
+bool ColorSampleAccumulator::toModel(ColorModel& model, bool useHue) const {
+    if (m_count < 3) {
+        return false;
+    }
+    float n = m_count;
+    float mean[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        mean[i] = m_sum[i] / n;
+    }
+
+    // 样本协方差（上三角），对角线加上下限
+    float c[6];
+    uint8_t k = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        for (uint8_t j = i; j < 3; j++) {
+            c[k] = (m_sumSq[k] - n * mean[i] * mean[j]) / (n - 1);
+            if (i == j) {
+                c[k] += COLOR_CAL_MIN_STD * COLOR_CAL_MIN_STD;
+            }
+            k++;
+        }
+    }
+    const float hh = c[0], hs = c[1], hl = c[2], ss = c[3], sl = c[4], ll = c[5];
+
+    if (useHue) {
+        float a = ss * ll - sl * sl;
+        float b = hl * sl - hs * ll;
+        float d = hs * sl - hl * ss;
+        float det = hh * a + hs * b + hl * d;
+        if (det <= 0) {
+            return false;
+        }
+        model.invCov[0] = a / det;
+        model.invCov[1] = b / det;
+        model.invCov[2] = d / det;
+        model.invCov[3] = (hh * ll - hl * hl) / det;
+        model.invCov[4] = (hs * hl - hh * sl) / det;
+        model.invCov[5] = (hh * ss - hs * hs) / det;
+    } else {
+        float det = ss * ll - sl * sl;
+        if (det <= 0) {
+            return false;
+        }
+        model.invCov[0] = model.invCov[1] = model.invCov[2] = 0;
+        model.invCov[3] = ll / det;
+        model.invCov[4] = -sl / det;
+        model.invCov[5] = ss / det;
+    }
+
+    model.valid = 1;
+    model.mean[0] = useHue ? wrapHue(m_refH + (int16_t)lroundf(mean[0])) : 0;
+    model.mean[1] = (uint8_t)lroundf(mean[1]);
+    model.mean[2] = (uint8_t)lroundf(mean[2]);
+    return true;
+}
@@ -0,0 +1,73 @@
+#ifndef COLOR_CALIBRATION_H
+#define COLOR_CALIBRATION_H
+
+#include <Arduino.h>
+#include "../Utils/Config.h"
+
+// HSL阈值范围（COLOR_USE_CLASSIFIER为0时使用），minH > maxH 表示跨0
+struct ColorThreshold {
+    uint8_t minH, maxH;  // 色相范围
+    uint8_t minS, maxS;  // 饱和度范围
+    uint8_t minL, maxL;  // 亮度范围
+};
+
+// 一种颜色的分类模型：HSL中心与协方差逆矩阵
+// invCov 依次为 HH, HS, HL, SS, SL, LL；不使用色相的颜色（黑、白）H相关项为0
+struct ColorModel {
+    uint8_t valid;
+    uint8_t mean[3];
+    float invCov[6];
+};
+
+// 全部校准数据，下标为ColorCode
+struct ColorCalibrationData {
+    ColorThreshold thresholds[COLOR_COUNT];
+    ColorModel models[COLOR_COUNT];
+};
+
+/**
+ * 颜色校准记录的EEPROM存储
+ *
+ * 记录位于 COLOR_CAL_EEPROM_ADDR，格式: 魔数(2) 版本(1) 长度(2) 数据 CRC16(2)。
+ * 版本或长度不符（结构体变化后）、CRC错误时视为没有记录，由调用者使用默认值。
+ */
+class ColorCalibrationStore {
+public:
+    static bool load(ColorCalibrationData& data);
+    static bool save(const ColorCalibrationData& data);
+    // 清除记录（只改写魔数）
+    static void erase();
+};
+
+/**
+ * 单一颜色的采样累计
+ *
+ * 色相相对第一个样本按 0-240 循环累计，红色跨0无需特殊处理。
+ * 结束后生成阈值范围和分类模型（均值与协方差逆矩阵），
+ * 与 tools/color_lut.py 由样本计算模型的方法一致。
+ */
+class ColorSampleAccumulator {
+public:
+    ColorSampleAccumulator();
+
+    void reset();
+    void add(uint8_t h, uint8_t s, uint8_t l);
+    uint8_t getCount() const { return m_count; }
+
+    // 样本不足3个时返回false
+    bool toThreshold(ColorThreshold& threshold) const;
+    bool toModel(ColorModel& model, bool useHue) const;
+
+private:
+    uint8_t m_count;
+    uint8_t m_refH;
+    int16_t m_minDh, m_maxDh;
+    uint8_t m_minS, m_maxS, m_minL, m_maxL;
+    float m_sum[3];      // dH, S, L
+    float m_sumSq[6];    // HH, HS, HL, SS, SL, LL
+};
+
+// 色相差，循环到 [-120, 120)
+int16_t colorHueDelta(uint8_t a, uint8_t b);
+
+#endif // COLOR_CALIBRATION_H
@@ -0,0 +1,425 @@
+// 由 tools/color_lut.py 生成，请勿手动修改
+// 校准数据: tools/color_calibration.json
+// 马氏距离最近中心，超过 3.0 个标准差置信度开始降低，超过 5.0 个标准差为未知
+//
+// 颜色      中心 H/S/L            标准差 H/S/L
+// RED      232.0 170.0 130.0      6.0  35.0  25.0
+// YELLOW    10.0 195.0 132.0      3.0  22.0  26.0
+// BLUE     160.0 170.0 130.0     10.0  35.0  25.0
+// BLACK        - 120.0  40.0        -  60.0  20.0
+// WHITE        -  15.0 210.0        -   8.0  15.0
+//
+// 只能被 ColorSensor.cpp 包含
+
+#ifndef COLOR_LUT_H
+#define COLOR_LUT_H
+
+#include <avr/pgmspace.h>
+#include "ColorCalibration.h"
+
+#define COLOR_LUT_H_BINS 48
+#define COLOR_LUT_S_BINS 8
+#define COLOR_LUT_L_BINS 16
+#define COLOR_LUT_HSL_MAX 240
+#define COLOR_LUT_CONFIDENCE_MAX 31
+
+// 生成查找表所用的模型（下标为颜色代码），是EEPROM校准记录的默认值
+// 有效, 中心 H/S/L, 协方差逆矩阵 HH/HS/HL/SS/SL/LL
+static const ColorModel COLOR_DEFAULT_MODELS[6] PROGMEM = {
+    { 0, { 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    { 1, { 0, 15, 210 }, { 0.0f, 0.0f, 0.0f, 0.015625f, 0.0f, 0.00444444f } }, // WHITE
+    { 1, { 0, 120, 40 }, { 0.0f, 0.0f, 0.0f, 0.000277778f, 0.0f, 0.0025f } }, // BLACK
+    { 1, { 232, 170, 130 }, { 0.0277778f, 0.0f, 0.0f, 0.000816327f, 0.0f, 0.0016f } }, // RED
+    { 1, { 160, 170, 130 }, { 0.01f, 0.0f, 0.0f, 0.000816327f, 0.0f, 0.0016f } }, // BLUE
+    { 1, { 10, 195, 132 }, { 0.111111f, 0.0f, 0.0f, 0.00206612f, 0.0f, 0.00147929f } }, // YELLOW
+};
+
+// 下标 (H格 * S格数 + S格) * L格数 + L格；每字节低3位为颜色代码，高5位为置信度
+static const uint8_t COLOR_LUT[6144] PROGMEM = {
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x1A, 0x39, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x72, 0x83, 0x8B, 0x7B, 0x43, 0x79, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xB3, 0xE3, 0xE3, 0xD3, 0xBB, 0x93, 0x63, 0x23, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x83, 0xF3, 0xFB, 0xFB, 0xFB, 0xF3, 0xD3, 0xA3, 0x63, 0x1B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xC3, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xF3, 0xC3, 0x8B, 0x43,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xAA, 0xD3, 0xEB, 0xEB, 0xEB, 0xE3, 0xE3, 0xE3, 0xBB, 0x83, 0x43,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x92, 0xBB, 0xCB, 0xCB, 0xC3, 0xC3, 0xBB, 0xB3, 0x8B, 0x63, 0x2B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xA2, 0xB3, 0xC3, 0xC3, 0xC3, 0xC3, 0xBB, 0xA3, 0x7B, 0x4B, 0x1B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x9A, 0x3B, 0x53, 0x43, 0x39, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x6A, 0xA3, 0xAB, 0x9B, 0x83, 0x5B, 0x2B, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xAB, 0xE3, 0xE3, 0xD3, 0xB3, 0x93, 0x63, 0x2B, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x7A, 0x8B, 0x8B, 0x8B, 0x83, 0x75, 0x6D, 0x5D, 0x3D, 0x15,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x9A, 0xCD, 0xDD, 0xDD, 0xE5, 0xE5, 0xE5, 0xED, 0xDD, 0xAD, 0x75,
+    0xFA, 0xFA, 0xFA, 0xF2, 0xD2, 0xAD, 0xED, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xD5, 0x95,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xA5, 0xED, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xED, 0xB5, 0x75,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x3A, 0x0B, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xAA, 0x3B, 0x5B, 0x4B, 0x33, 0x0B, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x82, 0x6B, 0x73, 0x63, 0x53, 0x33, 0x13, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xAA, 0xD5, 0xE5, 0xE5, 0xE5, 0xD5, 0xB5, 0x8D, 0x5D, 0x25,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xA2, 0xE5, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xED, 0xB5, 0x75,
+    0xFA, 0xFA, 0xFA, 0xF2, 0xD2, 0xB5, 0xF5, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xD5, 0x95,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAD, 0xF5, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xED, 0xBD, 0x7D,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x42, 0x23, 0x1B, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x72, 0x9D, 0xA5, 0x9D, 0x85, 0x65, 0x3D, 0x0D, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x9A, 0xE5, 0xFD, 0xFD, 0xFD, 0xE5, 0xC5, 0x95, 0x65, 0x25,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xB5, 0xF5, 0xFD, 0xFD, 0xFD, 0xFD, 0xDD, 0xB5, 0x7D, 0x3D,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0xA5, 0xF5, 0xFD, 0xFD, 0xFD, 0xE5, 0xC5, 0x95, 0x65, 0x25,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x52, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xAA, 0x35, 0x55, 0x4D, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x8A, 0x65, 0x75, 0x6D, 0x55, 0x35, 0x0D, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x7A, 0x4D, 0x5D, 0x4D, 0x35, 0x15, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x52, 0x14, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x42, 0x24, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x32, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x4A, 0x34, 0x24, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x34, 0x5C, 0x4C, 0x34, 0x0C, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xA2, 0x4C, 0x6C, 0x5C, 0x44, 0x1C, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x92, 0x4C, 0x64, 0x54, 0x3C, 0x14, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x82, 0x34, 0x44, 0x34, 0x1C, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x3A, 0x34, 0x2C, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xAA, 0x54, 0x74, 0x64, 0x4C, 0x24, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0x8A, 0x8C, 0x9C, 0x8C, 0x74, 0x4C, 0x1C, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x6A, 0xA4, 0xAC, 0x9C, 0x84, 0x5C, 0x2C, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x5A, 0x9C, 0xA4, 0x94, 0x7C, 0x54, 0x24, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x52, 0x7C, 0x84, 0x74, 0x5C, 0x34, 0x04, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x3A, 0x14, 0x0C, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xA2, 0x54, 0x6C, 0x5C, 0x44, 0x1C, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x7A, 0xA4, 0xAC, 0x9C, 0x84, 0x5C, 0x2C, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x84, 0xCC, 0xD4, 0xC4, 0xA4, 0x84, 0x54, 0x14, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xAC, 0xE4, 0xDC, 0xD4, 0xB4, 0x94, 0x64, 0x24, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xC2, 0xB4, 0xDC, 0xD4, 0xCC, 0xAC, 0x8C, 0x5C, 0x1C, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x94, 0xBC, 0xBC, 0xAC, 0x94, 0x6C, 0x3C, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x9A, 0x2C, 0x44, 0x34, 0x39, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x7A, 0x94, 0x9C, 0x8C, 0x74, 0x4C, 0x1C, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x94, 0xDC, 0xDC, 0xCC, 0xB4, 0x8C, 0x5C, 0x1C, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xB2, 0xDC, 0xFC, 0xFC, 0xF4, 0xD4, 0xB4, 0x84, 0x44, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x8A, 0xEC, 0xFC, 0xFC, 0xFC, 0xE4, 0xBC, 0x8C, 0x54, 0x0C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x7C, 0xF4, 0xFC, 0xFC, 0xF4, 0xDC, 0xBC, 0x8C, 0x4C, 0x04,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x7A, 0xDC, 0xEC, 0xEC, 0xDC, 0xBC, 0x9C, 0x6C, 0x2C, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x22, 0x41, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x8A, 0x5C, 0x6C, 0x5C, 0x29, 0x81, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x74, 0xC4, 0xC4, 0xB4, 0x9C, 0x74, 0x44, 0x0C, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xB2, 0xE4, 0xFC, 0xFC, 0xF4, 0xD4, 0xB4, 0x84, 0x44, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x94, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xD4, 0xA4, 0x6C, 0x24,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xBC, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xE4, 0xB4, 0x7C, 0x34,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xC4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xDC, 0xAC, 0x74, 0x2C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xBC, 0xF4, 0xFC, 0xFC, 0xFC, 0xE4, 0xC4, 0x94, 0x54, 0x0C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x1A, 0x39, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x72, 0x84, 0x8C, 0x7C, 0x44, 0x79, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xB4, 0xE4, 0xE4, 0xD4, 0xBC, 0x94, 0x64, 0x24, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x84, 0xF4, 0xFC, 0xFC, 0xFC, 0xF4, 0xD4, 0xA4, 0x64, 0x1C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xC4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF4, 0xC4, 0x8C, 0x44,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xAA, 0xDC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xD4, 0x9C, 0x54,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xA2, 0xE4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xCC, 0x94, 0x4C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xAA, 0xDC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xDC, 0xAC, 0x74, 0x2C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x82, 0x2C, 0x31, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x52, 0xA4, 0xA4, 0x94, 0x64, 0x71, 0xA1, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xB2, 0xDC, 0xFC, 0xFC, 0xEC, 0xD4, 0xAC, 0x7C, 0x3C, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAC, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xE4, 0xB4, 0x7C, 0x34,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xAA, 0xDC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xDC, 0xA4, 0x5C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x82, 0xEC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xEC, 0xB4, 0x6C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x8C, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xE4, 0xAC, 0x64,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x82, 0xEC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF4, 0xC4, 0x8C, 0x44,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x7A, 0x3C, 0x29, 0xC1, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0x6C, 0xB4, 0xB4, 0xA4, 0x7C, 0x69, 0xA1, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x9A, 0xEC, 0xFC, 0xFC, 0xFC, 0xDC, 0xBC, 0x8C, 0x4C, 0x0C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xCA, 0xC4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF4, 0xC4, 0x8C, 0x44,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x92, 0xEC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xEC, 0xB4, 0x6C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x9C, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xC4, 0x7C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAC, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF4, 0xBC, 0x74,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x9C, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xD4, 0x9C, 0x54,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x7A, 0x44, 0x2C, 0xC1, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0x7C, 0xBC, 0xBC, 0xAC, 0x84, 0x61, 0xA1, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x8A, 0xEC, 0xFC, 0xFC, 0xFC, 0xE4, 0xC4, 0x94, 0x54, 0x0C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xC2, 0xD4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xCC, 0x94, 0x4C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x82, 0xEC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF4, 0xBC, 0x74,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAC, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xCC, 0x84,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xB4, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xC4, 0x7C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAC, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xDC, 0xA4, 0x5C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x7A, 0x44, 0x2C, 0xC1, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0x7C, 0xBC, 0xBC, 0xAC, 0x84, 0x61, 0xA1, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x8A, 0xEC, 0xFC, 0xFC, 0xFC, 0xE4, 0xC4, 0x94, 0x54, 0x0C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xC2, 0xD4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xCC, 0x94, 0x4C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x82, 0xEC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF4, 0xBC, 0x74,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAC, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xCC, 0x84,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xB4, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xC4, 0x7C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAC, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xDC, 0xA4, 0x5C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x7A, 0x3C, 0x29, 0xC1, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0x6C, 0xB4, 0xB4, 0xA4, 0x7C, 0x69, 0xA1, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x9A, 0xEC, 0xFC, 0xFC, 0xFC, 0xDC, 0xBC, 0x8C, 0x4C, 0x0C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xCA, 0xC4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF4, 0xC4, 0x8C, 0x44,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x92, 0xEC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xEC, 0xB4, 0x6C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x9C, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xC4, 0x7C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAC, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF4, 0xBC, 0x74,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x9C, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xD4, 0x9C, 0x54,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x82, 0x2C, 0x31, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x52, 0xA4, 0xA4, 0x94, 0x64, 0x71, 0xA1, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xB2, 0xDC, 0xFC, 0xFC, 0xEC, 0xD4, 0xAC, 0x7C, 0x3C, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAC, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xE4, 0xB4, 0x7C, 0x34,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xAA, 0xDC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xDC, 0xA4, 0x5C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x82, 0xEC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xEC, 0xB4, 0x6C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x8C, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xE4, 0xAC, 0x64,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x82, 0xEC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF4, 0xC4, 0x8C, 0x44,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x1A, 0x39, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x72, 0x84, 0x8C, 0x7C, 0x44, 0x79, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xB4, 0xE4, 0xE4, 0xD4, 0xBC, 0x94, 0x64, 0x24, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x84, 0xF4, 0xFC, 0xFC, 0xFC, 0xF4, 0xD4, 0xA4, 0x64, 0x1C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xC4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF4, 0xC4, 0x8C, 0x44,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xAA, 0xDC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xD4, 0x9C, 0x54,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xA2, 0xE4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xCC, 0x94, 0x4C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xAA, 0xDC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xDC, 0xAC, 0x74, 0x2C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x22, 0x41, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x8A, 0x5C, 0x6C, 0x5C, 0x29, 0x81, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x74, 0xC4, 0xC4, 0xB4, 0x9C, 0x74, 0x44, 0x0C, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xB2, 0xE4, 0xFC, 0xFC, 0xF4, 0xD4, 0xB4, 0x84, 0x44, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x94, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xD4, 0xA4, 0x6C, 0x24,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xBC, 0xF4, 0xFC, 0xFC, 0xFC, 0xFC, 0xE4, 0xB4, 0x7C, 0x34,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xC4, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xDC, 0xAC, 0x74, 0x2C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xBC, 0xF4, 0xFC, 0xFC, 0xFC, 0xE4, 0xC4, 0x94, 0x54, 0x0C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x9A, 0x2C, 0x44, 0x34, 0x39, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x7A, 0x94, 0x9C, 0x8C, 0x74, 0x4C, 0x1C, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x94, 0xDC, 0xDC, 0xCC, 0xB4, 0x8C, 0x5C, 0x1C, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xB2, 0xDC, 0xFC, 0xFC, 0xF4, 0xD4, 0xB4, 0x84, 0x44, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x8A, 0xEC, 0xFC, 0xFC, 0xFC, 0xE4, 0xBC, 0x8C, 0x54, 0x0C,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x7C, 0xF4, 0xFC, 0xFC, 0xF4, 0xDC, 0xBC, 0x8C, 0x4C, 0x04,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x7A, 0xDC, 0xEC, 0xEC, 0xDC, 0xBC, 0x9C, 0x6C, 0x2C, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x3A, 0x14, 0x0C, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xA2, 0x54, 0x6C, 0x5C, 0x44, 0x1C, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x7A, 0xA4, 0xAC, 0x9C, 0x84, 0x5C, 0x2C, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x84, 0xCC, 0xD4, 0xC4, 0xA4, 0x84, 0x54, 0x14, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xAC, 0xE4, 0xDC, 0xD4, 0xB4, 0x94, 0x64, 0x24, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xC2, 0xB4, 0xDC, 0xD4, 0xCC, 0xAC, 0x8C, 0x5C, 0x1C, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x94, 0xBC, 0xBC, 0xAC, 0x94, 0x6C, 0x3C, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x3A, 0x34, 0x2C, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xAA, 0x54, 0x74, 0x64, 0x4C, 0x24, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0x8A, 0x8C, 0x9C, 0x8C, 0x74, 0x4C, 0x1C, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x6A, 0xA4, 0xAC, 0x9C, 0x84, 0x5C, 0x2C, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x5A, 0x9C, 0xA4, 0x94, 0x7C, 0x54, 0x24, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x52, 0x7C, 0x84, 0x74, 0x5C, 0x34, 0x04, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xBA, 0x42, 0x2C, 0x24, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x34, 0x54, 0x4C, 0x34, 0x0C, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xA2, 0x4C, 0x64, 0x5C, 0x3C, 0x1C, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x92, 0x4C, 0x5C, 0x54, 0x3C, 0x14, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x82, 0x34, 0x44, 0x34, 0x1C, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x42, 0x00, 0x00, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x4A, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x3A, 0x43, 0x3B, 0x23, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xAA, 0x4B, 0x6B, 0x5B, 0x43, 0x23, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0x92, 0x6B, 0x7B, 0x6B, 0x53, 0x33, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x82, 0x63, 0x73, 0x63, 0x4B, 0x2B, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x72, 0x4B, 0x53, 0x4B, 0x2B, 0x0B, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x2A, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0xA2, 0x3A, 0x13, 0x0B, 0x49, 0x89, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xA2, 0x53, 0x6B, 0x5B, 0x43, 0x1B, 0x00, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x7A, 0xA3, 0xAB, 0x9B, 0x83, 0x5B, 0x2B, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x83, 0xCB, 0xD3, 0xC3, 0xA3, 0x83, 0x53, 0x13, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xAB, 0xE3, 0xDB, 0xD3, 0xB3, 0x93, 0x63, 0x23, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xC2, 0xB3, 0xDB, 0xD3, 0xCB, 0xAB, 0x8B, 0x5B, 0x1B, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xB2, 0x93, 0xBB, 0xBB, 0xAB, 0x93, 0x6B, 0x3B, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x8A, 0x22, 0x49, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x92, 0x4B, 0x63, 0x53, 0x31, 0x81, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x5B, 0xB3, 0xB3, 0xAB, 0x8B, 0x6B, 0x3B, 0x00, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xC2, 0xCB, 0xF3, 0xF3, 0xE3, 0xCB, 0xA3, 0x73, 0x3B, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x82, 0xEB, 0xFB, 0xFB, 0xFB, 0xF3, 0xCB, 0x9B, 0x5B, 0x1B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0xA3, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xDB, 0xAB, 0x6B, 0x2B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xB3, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xD3, 0xA3, 0x63, 0x23,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x9B, 0xF3, 0xFB, 0xFB, 0xF3, 0xDB, 0xB3, 0x83, 0x4B, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x82, 0x1B, 0x39, 0xC9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x6A, 0x93, 0x93, 0x83, 0x53, 0x79, 0xA9, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xCA, 0xC3, 0xEB, 0xEB, 0xDB, 0xC3, 0x9B, 0x6B, 0x33, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x93, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xDB, 0xAB, 0x6B, 0x23,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xC2, 0xD3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xCB, 0x93, 0x4B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xA2, 0xE3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xDB, 0xA3, 0x5B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x92, 0xEB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xD3, 0x9B, 0x53,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x9A, 0xE3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xEB, 0xBB, 0x7B, 0x33,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x7A, 0x3B, 0x29, 0xC1, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0x6B, 0xB3, 0xB3, 0xA3, 0x7B, 0x69, 0xA1, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x9A, 0xEB, 0xFB, 0xFB, 0xFB, 0xDB, 0xBB, 0x8B, 0x4B, 0x0B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xCA, 0xC3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF3, 0xC3, 0x8B, 0x43,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x92, 0xEB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xEB, 0xB3, 0x6B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x9B, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xC3, 0x7B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAB, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF3, 0xBB, 0x73,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x9B, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xD3, 0x9B, 0x53,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x7A, 0x43, 0x2B, 0xC1, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0x7B, 0xBB, 0xBB, 0xAB, 0x8B, 0x61, 0xA1, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x82, 0xEB, 0xFB, 0xFB, 0xFB, 0xEB, 0xC3, 0x93, 0x53, 0x13,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xC2, 0xD3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xCB, 0x93, 0x4B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xEA, 0x82, 0xEB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF3, 0xBB, 0x73,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAB, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xCB, 0x83,
+    0xFA, 0xFA, 0xFA, 0xF2, 0xD2, 0xBB, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xC3, 0x7B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xDA, 0xAB, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xDB, 0xA3, 0x5B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0x82, 0x33, 0x29, 0xC1, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x63, 0xAB, 0xB3, 0xA3, 0x73, 0x69, 0xA1, 0xA9, 0x89,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0xA2, 0xEB, 0xFB, 0xFB, 0xF3, 0xDB, 0xB3, 0x83, 0x4B, 0x00,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xD2, 0xC3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF3, 0xC3, 0x83, 0x43,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xF2, 0x9A, 0xE3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xEB, 0xAB, 0x63,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x93, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF3, 0xBB, 0x73,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0xA3, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF3, 0xB3, 0x6B,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xE2, 0x93, 0xF3, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xD3, 0x93, 0x4B
+};
+
+#endif // COLOR_LUT_H
@@ -1,4 +1,5 @@
 #include "ColorSensor.h"
+#include "ColorLut.h"
 #include "../Utils/Logger.h"
 
 ColorSensor::ColorSensor() : 
@@ -8,13 +9,20 @@ ColorSensor::ColorSensor() :
     lastCommandSent(0),
     lastR(0), lastG(0), lastB(0),
     lastH(0), lastS(0), lastL(0),
-    lastReadMillis(0) {
-    // 在构造函数中初始化颜色阈值
+    lastReadMillis(0),
+    useCalibratedModels(false) {
+    // 在构造函数中初始化颜色阈值和模型
+    loadDefaultCalibration();
+}
+
+void ColorSensor::loadDefaultCalibration() {
     initColorThresholds();
+    memcpy_P(colorModels, COLOR_DEFAULT_MODELS, sizeof(colorModels));
+    useCalibratedModels = false;
 }
 
 void ColorSensor::initColorThresholds() {
-    // 初始化颜色阈值
+    // 初始化颜色阈值（默认值，EEPROM中有校准记录时被替换）
     // 注意：这些值需要根据实际测试进行校准
     // 感为传感器使用0-240范围的HSL值
     
@@ -64,8 +72,8 @@ bool ColorSensor::begin() {
     i2cAddress = GANWEI_COLOR_SENSOR_ADDR;
     
     // 初始化I2C通讯
-    // Wire.begin() 是安全的，可以多次调用
-    Wire.begin();
+    // I2CBus::begin() 可以多次调用
+    I2CBus::begin();
     
     // 尝试与传感器通信
     isConnected = pingSensor();
@@ -73,6 +81,11 @@ bool ColorSensor::begin() {
     
     if (initialized) {
         Logger::info("Color", "感为颜色传感器初始化成功");
+        if (loadCalibration()) {
+            Logger::info("Color", "已加载EEPROM中的颜色校准");
+        } else {
+            Logger::info("Color", "EEPROM中没有有效的颜色校准，使用默认值");
+        }
     } else {
         Logger::error("Color", "无法连接到感为颜色传感器");
     }
@@ -81,28 +94,17 @@ bool ColorSensor::begin() {
 }
 
 bool ColorSensor::pingSensor() {
-    // 发送ping命令验证传感器连接
-    Wire.beginTransmission(i2cAddress);
-    Wire.write(CMD_PING);
-    uint8_t error = Wire.endTransmission(false); // 不发送停止位
+    // 发送ping命令并读取1字节响应验证传感器连接
+    uint8_t response = 0;
+    uint8_t error = I2CBus::transfer(i2cAddress, &CMD_PING, 1, &response, 1);
     
-    if (error != 0) {
+    if (error != I2C_OK) {
         // I2C通讯错误
         Logger::error("Color", "I2C通讯错误: %d", error);
         isConnected = false;
         return false;
     }
     
-    // 请求1字节的响应
-    if (Wire.requestFrom(i2cAddress, (uint8_t)1) != 1) {
-        Logger::error("Color", "未收到响应");
-        isConnected = false;
-        return false;
-    }
-    
-    // 读取响应字节
-    uint8_t response = Wire.read();
-    
     // 验证响应是否正确
     if (response != PING_RESPONSE) {
         Logger::error("Color", "响应不匹配: 0x%02X (预期: 0x%02X)", response, PING_RESPONSE);
@@ -119,12 +121,16 @@ SensorStatus ColorSensor::checkHealth() {
         return SensorStatus::NOT_INITIALIZED;
     }
     
-    // 通过ping测试传感器是否响应
-    if (pingSensor()) {
-        return SensorStatus::OK;
-    } else {
+    if (!isConnected) {
         return SensorStatus::ERROR_COMM;
     }
+    
+    // 根据总线统计判断，不再额外ping
+    I2CDeviceStats stats;
+    if (I2CBus::getDeviceStats(i2cAddress, stats) && stats.consecutiveErrors >= I2C_HEALTH_MAX_ERRORS) {
+        return stats.lastError == I2C_ERROR_TIMEOUT ? SensorStatus::ERROR_TIMEOUT : SensorStatus::ERROR_COMM;
+    }
+    return SensorStatus::OK;
 }
 
 bool ColorSensor::isInitialized() const {
@@ -137,36 +143,18 @@ bool ColorSensor::readSensorData(uint8_t command, uint8_t* dataBuffer, uint8_t n
     }
     
     // 对于RGB和HSL读取，仅在命令变化时发送命令
-    if (command != lastCommandSent || (command != CMD_READ_RGB && command != CMD_READ_HSL)) {
-        Wire.beginTransmission(i2cAddress);
-        Wire.write(command);
-        uint8_t error = Wire.endTransmission(false); // 不发送停止位
-        
-        if (error != 0) {
-            Logger::error("Color", "发送命令错误: %d", error);
-            return false;
-        }
-        
-        // 更新最后发送的命令（仅对RGB和HSL读取）
-        if (command == CMD_READ_RGB || command == CMD_READ_HSL) {
-            lastCommandSent = command;
-        }
-    }
-    
-    // 请求指定数量的字节
-    if (Wire.requestFrom(i2cAddress, numBytes) != numBytes) {
-        Logger::error("Color", "读取数据失败，请求 %d 字节", numBytes);
+    bool sendCmd = command != lastCommandSent || (command != CMD_READ_RGB && command != CMD_READ_HSL);
+    uint8_t error = I2CBus::transfer(i2cAddress, &command, sendCmd ? 1 : 0, dataBuffer, numBytes);
+    if (error != I2C_OK) {
+        // 失败后下次重新发送命令
+        lastCommandSent = 0;
+        Logger::error("Color", "读取数据失败，请求 %d 字节，错误 %d", numBytes, error);
         return false;
     }
     
-    // 读取数据到缓冲区
-    for (uint8_t i = 0; i < numBytes; i++) {
-        if (Wire.available()) {
-            dataBuffer[i] = Wire.read();
-        } else {
-            Logger::error("Color", "数据读取不完整");
-            return false;
-        }
+    // 更新最后发送的命令（仅对RGB和HSL读取）
+    if (command == CMD_READ_RGB || command == CMD_READ_HSL) {
+        lastCommandSent = command;
     }
     
     // 更新最后读取时间
@@ -179,11 +167,9 @@ bool ColorSensor::sendCommand(uint8_t command) {
         return false;
     }
     
-    Wire.beginTransmission(i2cAddress);
-    Wire.write(command);
-    uint8_t error = Wire.endTransmission(true); // 发送停止位
+    uint8_t error = I2CBus::write(i2cAddress, &command, 1);
     
-    if (error != 0) {
+    if (error != I2C_OK) {
         Logger::error("Color", "发送命令错误: %d", error);
         return false;
     }
@@ -238,6 +224,28 @@ bool ColorSensor::getColorHSL(uint8_t& h, uint8_t& s, uint8_t& l) {
     return true;
 }
 
+void ColorSensor::prepareHSLRequest(I2CRequest& request) const {
+    request.address = i2cAddress;
+    request.priority = I2C_PRIORITY_NORMAL;
+    // 与readSensorData()相同，命令未变化时直接读取
+    request.txData[0] = CMD_READ_HSL;
+    request.txLength = (lastCommandSent == CMD_READ_HSL) ? 0 : 1;
+    request.rxLength = 3;
+}
+
+bool ColorSensor::finishHSLRequest(const I2CRequest& request, uint8_t& h, uint8_t& s, uint8_t& l) {
+    if (request.state != I2C_REQUEST_DONE) {
+        lastCommandSent = 0;
+        return false;
+    }
+    lastCommandSent = CMD_READ_HSL;
+    lastH = h = request.rxData[0];
+    lastS = s = request.rxData[1];
+    lastL = l = request.rxData[2];
+    lastReadMillis = request.completedMs;
+    return true;
+}
+
 bool ColorSensor::getErrorStatus(uint8_t& errorByte) {
     return readSensorData(CMD_READ_ERROR, &errorByte, 1);
 }
@@ -258,7 +266,7 @@ bool ColorSensor::resetSensor() {
     return result;
 }
 
-ColorCode ColorSensor::identifyColorHSL(uint8_t h, uint8_t s, uint8_t l) {
+ColorCode ColorSensor::identifyColorHSL(uint8_t h, uint8_t s, uint8_t l) const {
     // 优先处理极端情况
     // 黑色判断：亮度低
     if (l <= colorThresholds[COLOR_BLACK].maxL) {
@@ -305,16 +313,166 @@ ColorCode ColorSensor::identifyColorHSL(uint8_t h, uint8_t s, uint8_t l) {
     return COLOR_UNKNOWN;
 }
 
-ColorCode ColorSensor::getColor() {
+// 量化到查找表的格子，取值0-240
+static inline uint8_t lutBin(uint8_t value, uint8_t bins) {
+    uint8_t bin = (uint16_t)value * bins / COLOR_LUT_HSL_MAX;
+    return bin < bins ? bin : bins - 1;
+}
+
+ColorCode ColorSensor::classifyHSL(uint8_t h, uint8_t s, uint8_t l, uint8_t& confidence) const {
+    if (useCalibratedModels) {
+        return classifyWithModels(h, s, l, confidence);
+    }
+    uint16_t index = ((uint16_t)lutBin(h, COLOR_LUT_H_BINS) * COLOR_LUT_S_BINS + lutBin(s, COLOR_LUT_S_BINS))
+                     * COLOR_LUT_L_BINS + lutBin(l, COLOR_LUT_L_BINS);
+    uint8_t entry = pgm_read_byte(&COLOR_LUT[index]);
+    confidence = (uint8_t)(((uint16_t)(entry >> 3) * 100 + COLOR_LUT_CONFIDENCE_MAX / 2) / COLOR_LUT_CONFIDENCE_MAX);
+    return static_cast<ColorCode>(entry & 0x07);
+}
+
+// 与 tools/color_lut.py 生成查找表的计算相同，只是不经过量化
+ColorCode ColorSensor::classifyWithModels(uint8_t h, uint8_t s, uint8_t l, uint8_t& confidence) const {
+    float distances[COLOR_COUNT];
+    int8_t best = -1;
+    for (uint8_t i = 0; i < COLOR_COUNT; i++) {
+        const ColorModel& model = colorModels[i];
+        if (!model.valid) {
+            distances[i] = -1;
+            continue;
+        }
+        float dh = colorHueDelta(h, model.mean[0]);
+        float ds = (float)s - model.mean[1];
+        float dl = (float)l - model.mean[2];
+        const float* m = model.invCov;
+        distances[i] = m[0] * dh * dh + m[3] * ds * ds + m[5] * dl * dl
+                       + 2.0f * (m[1] * dh * ds + m[2] * dh * dl + m[4] * ds * dl);
+        if (best < 0 || distances[i] < distances[best]) {
+            best = i;
+        }
+    }
+    
+    const float gate2 = COLOR_CLASSIFIER_GATE * COLOR_CLASSIFIER_GATE;
+    const float core2 = COLOR_CLASSIFIER_CORE * COLOR_CLASSIFIER_CORE;
+    if (best < 0 || distances[best] > gate2) {
+        confidence = 0;
+        return COLOR_UNKNOWN;
+    }
+    
+    // 最近颜色在 exp(-d²/2) 中所占的比例
+    float total = 0;
+    for (uint8_t i = 0; i < COLOR_COUNT; i++) {
+        if (distances[i] >= 0) {
+            total += expf(-(distances[i] - distances[best]) * 0.5f);
+        }
+    }
+    float ratio = 1.0f / total;
+    if (distances[best] > core2) {
+        ratio *= (gate2 - distances[best]) / (gate2 - core2);
+    }
+    confidence = (uint8_t)(ratio * 100.0f + 0.5f);
+    return static_cast<ColorCode>(best);
+}
+
+bool ColorSensor::loadCalibration() {
+    ColorCalibrationData data;
+    if (!ColorCalibrationStore::load(data)) {
+        return false;
+    }
+    applyCalibration(data);
+    return true;
+}
+
+bool ColorSensor::saveCalibration() {
+    ColorCalibrationData data;
+    getCalibration(data);
+    return ColorCalibrationStore::save(data);
+}
+
+void ColorSensor::resetCalibration() {
+    ColorCalibrationStore::erase();
+    loadDefaultCalibration();
+}
+
+void ColorSensor::applyCalibration(const ColorCalibrationData& data) {
+    memcpy(colorThresholds, data.thresholds, sizeof(colorThresholds));
+    memcpy(colorModels, data.models, sizeof(colorModels));
+    useCalibratedModels = true;
+}
+
+void ColorSensor::getCalibration(ColorCalibrationData& data) const {
+    memcpy(data.thresholds, colorThresholds, sizeof(colorThresholds));
+    memcpy(data.models, colorModels, sizeof(colorModels));
+}
+
+bool ColorSensor::calibrateColor(ColorCode color, uint8_t samples, uint16_t delayMs) {
+    if (color <= COLOR_UNKNOWN || color >= COLOR_COUNT) {
+        return false;
+    }
+    
+    ColorSampleAccumulator accumulator;
+    for (uint8_t i = 0; i < samples; i++) {
+        uint8_t h, s, l;
+        if (getColorHSL(h, s, l)) {
+            accumulator.add(h, s, l);
+        }
+        delay(delayMs);
+    }
+    
+    // 黑、白的色相不稳定，不参与分类
+    bool useHue = (color != COLOR_BLACK && color != COLOR_WHITE);
+    ColorThreshold threshold;
+    ColorModel model;
+    if (!accumulator.toThreshold(threshold) || !accumulator.toModel(model, useHue)) {
+        Logger::warning("Color", "有效样本不足 (%d/%d)", accumulator.getCount(), samples);
+        return false;
+    }
+    colorThresholds[color] = threshold;
+    colorModels[color] = model;
+    useCalibratedModels = true;
+    return true;
+}
+
+void ColorSensor::printCalibration() const {
+    Logger::info("Color", "分类方式: %s", useCalibratedModels ? "校准模型" : "默认查找表");
+    for (uint8_t i = COLOR_UNKNOWN + 1; i < COLOR_COUNT; i++) {
+        const ColorModel& model = colorModels[i];
+        const ColorThreshold& threshold = colorThresholds[i];
+        // AVR的printf不支持浮点，协方差逆矩阵对角线放大1000倍输出
+        Logger::info("Color", "颜色%d: 中心 H%d S%d L%d, 1/σ²x1000 H%d S%d L%d, 阈值 H%d-%d S%d-%d L%d-%d",
+                     i, model.mean[0], model.mean[1], model.mean[2],
+                     (int)(model.invCov[0] * 1000), (int)(model.invCov[3] * 1000), (int)(model.invCov[5] * 1000),
+                     threshold.minH, threshold.maxH, threshold.minS, threshold.maxS,
+                     threshold.minL, threshold.maxL);
+    }
+}
+
+ColorCode ColorSensor::getColor(uint8_t& confidence) {
     uint8_t h, s, l;
+    confidence = 0;
     
     // 读取HSL值
     if (!getColorHSL(h, s, l)) {
         return COLOR_UNKNOWN;
     }
     
-    // 使用HSL值识别颜色
-    return identifyColorHSL(h, s, l);
+    return classify(h, s, l, confidence);
+}
+
+ColorCode ColorSensor::classify(uint8_t h, uint8_t s, uint8_t l, uint8_t& confidence) const {
+#if COLOR_USE_CLASSIFIER
+    return classifyHSL(h, s, l, confidence);
+#else
+    // 固定阈值没有置信度，命中即视为确定
+    ColorCode color = identifyColorHSL(h, s, l);
+    confidence = (color == COLOR_UNKNOWN) ? 0 : 100;
+    return color;
+#endif
+}
+
+ColorCode ColorSensor::getColor() {
+    uint8_t confidence;
+    ColorCode color = getColor(confidence);
+    return confidence >= COLOR_MIN_CONFIDENCE ? color : COLOR_UNKNOWN;
 }
 
 void ColorSensor::debugPrint() {
@@ -360,12 +518,14 @@ void ColorSensor::debugPrint() {
     }
     
     // 识别颜色
-    ColorCode color;
-    if (hslSuccess) {
-        color = identifyColorHSL(h, s, l);
-    } else {
-        color = identifyColorHSL(lastH, lastS, lastL);
+    if (!hslSuccess) {
+        h = lastH;
+        s = lastS;
+        l = lastL;
     }
+    uint8_t confidence;
+    ColorCode color = classifyHSL(h, s, l, confidence);
+    ColorCode thresholdColor = identifyColorHSL(h, s, l);
     
     // 打印颜色名称
     const char* colorName;
@@ -378,5 +538,5 @@ void ColorSensor::debugPrint() {
         default:           colorName = "未知"; break;
     }
     
-    Logger::debug("Color", "检测到的颜色: %s", colorName);
+    Logger::debug("Color", "检测到的颜色: %s (置信度 %d%%，固定阈值结果: %d)", colorName, confidence, thresholdColor);
 } 
\ No newline at end of file
@@ -2,9 +2,10 @@
 #define COLOR_SENSOR_H
 
 #include <Arduino.h>
-#include <Wire.h>
 #include "../Utils/Config.h"
 #include "SensorCommon.h"
+#include "ColorCalibration.h"
+#include "I2CBus.h"
 
 // Ganwei Color Sensor I2C Commands
 const uint8_t CMD_READ_RGB = 0xD0;
@@ -28,22 +29,26 @@ private:
     uint8_t lastH, lastS, lastL;
     unsigned long lastReadMillis;
     
-    // 用于颜色识别的阈值
-    struct ColorThreshold {
-        // HSL阈值
-        uint8_t minH, maxH;  // 色相范围
-        uint8_t minS, maxS;  // 饱和度范围
-        uint8_t minL, maxL;  // 亮度范围
-    };
-    
     // 为每种颜色定义阈值
     ColorThreshold colorThresholds[COLOR_COUNT];
     
+    // 各颜色的分类模型（默认值与查找表相同）
+    ColorModel colorModels[COLOR_COUNT];
+    
+    // 为true时按colorModels计算分类（EEPROM记录或现场校准），否则查找表
+    bool useCalibratedModels;
+    
     // 初始化颜色阈值
     void initColorThresholds();
     
-    // 根据HSL值识别颜色
-    ColorCode identifyColorHSL(uint8_t h, uint8_t s, uint8_t l);
+    // 恢复默认阈值和模型
+    void loadDefaultCalibration();
+    
+    // 按colorModels计算马氏距离分类
+    ColorCode classifyWithModels(uint8_t h, uint8_t s, uint8_t l, uint8_t& confidence) const;
+    
+    // 根据HSL值识别颜色（固定阈值，COLOR_USE_CLASSIFIER为0时使用）
+    ColorCode identifyColorHSL(uint8_t h, uint8_t s, uint8_t l) const;
     
     // 读取传感器数据的辅助函数
     bool readSensorData(uint8_t command, uint8_t* dataBuffer, uint8_t numBytes);
@@ -63,15 +68,54 @@ public:
     // 检查传感器健康状态
     SensorStatus checkHealth();
     
-    // 获取识别的颜色
+    // 获取识别的颜色，置信度低于COLOR_MIN_CONFIDENCE时返回COLOR_UNKNOWN
     ColorCode getColor();
     
+    // 获取识别的颜色及置信度(0-100)，不做置信度过滤
+    ColorCode getColor(uint8_t& confidence);
+    
+    // 对HSL值分类，置信度0-100
+    // 使用默认校准时查表，O(1)；加载EEPROM记录或现场校准后按各颜色模型计算
+    ColorCode classifyHSL(uint8_t h, uint8_t s, uint8_t l, uint8_t& confidence) const;
+    
+    // 按COLOR_USE_CLASSIFIER选择的方法对已读取的HSL值分类，置信度0-100，不访问I2C
+    ColorCode classify(uint8_t h, uint8_t s, uint8_t l, uint8_t& confidence) const;
+    
+    // === 校准 ===
+    
+    // 从EEPROM加载校准记录（begin()中调用），没有有效记录时保持默认值
+    bool loadCalibration();
+    
+    // 将当前校准写入EEPROM
+    bool saveCalibration();
+    
+    // 清除EEPROM记录并恢复默认值
+    void resetCalibration();
+    
+    // 采样当前传感器前的物体，更新该颜色的阈值和模型（不写入EEPROM）
+    bool calibrateColor(ColorCode color, uint8_t samples, uint16_t delayMs);
+    
+    // 直接设置校准数据（例如TestColorCalibration的结果），之后按模型计算分类
+    void applyCalibration(const ColorCalibrationData& data);
+    void getCalibration(ColorCalibrationData& data) const;
+    
+    bool isUsingCalibratedModels() const { return useCalibratedModels; }
+    
+    // 打印各颜色模型
+    void printCalibration() const;
+    
     // 获取RGB值
     bool getColorRGB(uint8_t& r, uint8_t& g, uint8_t& b);
     
     // 获取HSL值
     bool getColorHSL(uint8_t& h, uint8_t& s, uint8_t& l);
     
+    // 准备读取HSL的I2C请求，由I2CBus队列执行（后台采样使用）
+    void prepareHSLRequest(I2CRequest& request) const;
+    
+    // 取出已执行请求的HSL值并更新缓存，请求失败时返回false
+    bool finishHSLRequest(const I2CRequest& request, uint8_t& h, uint8_t& s, uint8_t& l);
+    
     // 获取错误状态
     bool getErrorStatus(uint8_t& errorByte);
     
@@ -0,0 +1,68 @@
+#include "DistanceFilter.h"
+
+DistanceFilter::DistanceFilter()
+    : m_distance(0), m_variance(0), m_lastMs(0), m_valid(false), m_consecutiveRejects(0),
+      m_accepted(0), m_rejected(0), m_missed(0) {
+}
+
+void DistanceFilter::reset() {
+    m_valid = false;
+    m_consecutiveRejects = 0;
+}
+
+void DistanceFilter::initialize(float distance, unsigned long nowMs) {
+    m_distance = distance;
+    m_variance = DISTANCE_FILTER_MEAS_VAR;
+    m_lastMs = nowMs;
+    m_valid = true;
+    m_consecutiveRejects = 0;
+}
+
+bool DistanceFilter::update(float distance, unsigned long nowMs) {
+    if (distance < DISTANCE_FILTER_MIN_CM) {
+        // 无回波不修改估计，时间久了由 getEstimate() 判定失效
+        m_missed++;
+        return false;
+    }
+
+    if (!m_valid || nowMs - m_lastMs > DISTANCE_FILTER_STALE_MS) {
+        initialize(distance, nowMs);
+        m_accepted++;
+        return true;
+    }
+
+    // 预测：方差随时间增长
+    float predicted = m_variance + DISTANCE_FILTER_PROCESS_VAR * (float)(nowMs - m_lastMs);
+    float innovation = distance - m_distance;
+    float innovationVar = predicted + DISTANCE_FILTER_MEAS_VAR;
+    m_lastMs = nowMs;
+
+    if (innovation * innovation > DISTANCE_FILTER_GATE * DISTANCE_FILTER_GATE * innovationVar) {
+        m_rejected++;
+        if (++m_consecutiveRejects >= DISTANCE_FILTER_MAX_REJECTS) {
+            initialize(distance, nowMs);
+            return true;
+        }
+        // 保留增长后的方差，门限随之放宽
+        m_variance = predicted;
+        return false;
+    }
+
+    // 更新
+    float gain = predicted / innovationVar;
+    m_distance += gain * innovation;
+    m_variance = (1.0f - gain) * predicted;
+    m_consecutiveRejects = 0;
+    m_accepted++;
+    return true;
+}
+
+bool DistanceFilter::getEstimate(float& distance, float& variance, unsigned long nowMs) const {
+    unsigned long age = nowMs - m_lastMs;
+    if (!m_valid || age > DISTANCE_FILTER_STALE_MS) {
+        return false;
+    }
+    distance = m_distance;
+    variance = m_variance + DISTANCE_FILTER_PROCESS_VAR * (float)age;
+    return true;
+}
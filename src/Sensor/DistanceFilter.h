@@ -0,0 +1,53 @@
+#ifndef DISTANCE_FILTER_H
+#define DISTANCE_FILTER_H
+
+#include <Arduino.h>
+#include "../Utils/Config.h"
+
+/**
+ * 超声波距离的流式滤波器（标量卡尔曼 + 野值门限）
+ *
+ * 每次测量调用一次 update()，O(1)，不阻塞、不排序、不保存历史读数。
+ * 状态模型为随机游走：两次读数之间方差按 DISTANCE_FILTER_PROCESS_VAR × 间隔(ms) 增长，
+ * 因此读数越久，新读数的权重越大。
+ * 新息超过 DISTANCE_FILTER_GATE 倍标准差的读数被丢弃（回波丢失、串扰等）；
+ * 连续 DISTANCE_FILTER_MAX_REJECTS 次被丢弃说明目标确实变化（例如物块进入视野），
+ * 此时以最新读数重新初始化。
+ */
+class DistanceFilter {
+public:
+    DistanceFilter();
+
+    // 清除估计，下一次有效读数直接作为初值
+    void reset();
+
+    // 输入一次读数（cm），distance <= 0 表示超时无回波
+    // 返回读数是否被采纳
+    bool update(float distance, unsigned long nowMs);
+
+    // 获取当前估计值及其方差(cm²)，方差包含自上次读数以来的增长
+    // 尚无读数或超过 DISTANCE_FILTER_STALE_MS 未更新时返回 false
+    bool getEstimate(float& distance, float& variance, unsigned long nowMs) const;
+
+    bool isValid() const { return m_valid; }
+    unsigned long getLastUpdateMs() const { return m_lastMs; }
+
+    // 统计：采纳、野值、无回波的读数数量
+    uint16_t getAcceptedCount() const { return m_accepted; }
+    uint16_t getRejectedCount() const { return m_rejected; }
+    uint16_t getMissedCount() const { return m_missed; }
+
+private:
+    float m_distance;
+    float m_variance;
+    unsigned long m_lastMs;
+    bool m_valid;
+    uint8_t m_consecutiveRejects;
+    uint16_t m_accepted;
+    uint16_t m_rejected;
+    uint16_t m_missed;
+
+    void initialize(float distance, unsigned long nowMs);
+};
+
+#endif // DISTANCE_FILTER_H
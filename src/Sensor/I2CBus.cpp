@@ -0,0 +1,222 @@
+#include "I2CBus.h"
+#include "../Utils/Logger.h"
+
+// 没有超时的Wire在从机拉住总线时会永久阻塞主循环，不能静默退化
+#if !defined(WIRE_HAS_TIMEOUT)
+#error "I2CBus需要支持setWireTimeout()的Wire库（Arduino AVR core 1.8.3及以上）"
+#endif
+
+bool I2CBus::s_started = false;
+uint16_t I2CBus::s_recoveries = 0;
+I2CDeviceStats I2CBus::s_devices[I2C_MAX_DEVICES];
+uint8_t I2CBus::s_deviceCount = 0;
+I2CRequest* I2CBus::s_queue[I2C_QUEUE_SIZE];
+uint8_t I2CBus::s_queueCount = 0;
+
+void I2CBus::configureWire() {
+    Wire.begin();
+    Wire.setClock(I2C_CLOCK_HZ);
+    // 超时后由Wire复位TWI，传输返回错误而不是卡死
+    Wire.setWireTimeout(I2C_TIMEOUT_US, true);
+}
+
+void I2CBus::begin() {
+    if (s_started) {
+        return;
+    }
+    s_started = true;
+    
+    // 上电时从机可能停在读数据的中途拉住SDA（例如主控复位时）
+    pinMode(I2C_SDA_PIN, INPUT_PULLUP);
+    if (digitalRead(I2C_SDA_PIN) == LOW) {
+        Logger::warning("I2C", "SDA被拉低，尝试恢复总线");
+        recover();
+        return;
+    }
+    configureWire();
+}
+
+bool I2CBus::recover() {
+    s_recoveries++;
+    Wire.end();
+    
+    pinMode(I2C_SDA_PIN, INPUT_PULLUP);
+    pinMode(I2C_SCL_PIN, INPUT_PULLUP);
+    delayMicroseconds(5);
+    
+    // SCL被拉住（从机时钟延展卡死）时无法由主机恢复
+    bool released = digitalRead(I2C_SCL_PIN) == HIGH;
+    if (released) {
+        // 输出最多9个时钟，让从机移出剩余的数据位并释放SDA
+        for (uint8_t i = 0; i < 9 && digitalRead(I2C_SDA_PIN) == LOW; i++) {
+            pinMode(I2C_SCL_PIN, OUTPUT);
+            digitalWrite(I2C_SCL_PIN, LOW);
+            delayMicroseconds(5);
+            pinMode(I2C_SCL_PIN, INPUT_PULLUP);
+            delayMicroseconds(5);
+        }
+        released = digitalRead(I2C_SDA_PIN) == HIGH;
+        
+        // 发送STOP：SCL为高时SDA由低变高
+        pinMode(I2C_SDA_PIN, OUTPUT);
+        digitalWrite(I2C_SDA_PIN, LOW);
+        delayMicroseconds(5);
+        pinMode(I2C_SDA_PIN, INPUT_PULLUP);
+        delayMicroseconds(5);
+    }
+    
+    configureWire();
+    if (!released) {
+        Logger::error("I2C", "总线恢复失败（SDA=%d, SCL=%d）",
+                      digitalRead(I2C_SDA_PIN), digitalRead(I2C_SCL_PIN));
+    }
+    return released;
+}
+
+I2CDeviceStats* I2CBus::findDevice(uint8_t address) {
+    for (uint8_t i = 0; i < s_deviceCount; i++) {
+        if (s_devices[i].address == address) {
+            return &s_devices[i];
+        }
+    }
+    if (s_deviceCount == I2C_MAX_DEVICES) {
+        return nullptr;
+    }
+    I2CDeviceStats* device = &s_devices[s_deviceCount++];
+    memset(device, 0, sizeof(*device));
+    device->address = address;
+    return device;
+}
+
+uint8_t I2CBus::transfer(uint8_t address, const uint8_t* txData, uint8_t txLength,
+                         uint8_t* rxData, uint8_t rxLength) {
+    begin();
+    unsigned long start = micros();
+    uint8_t error = I2C_OK;
+    
+    if (txLength > 0 || rxLength == 0) {
+        Wire.beginTransmission(address);
+        for (uint8_t i = 0; i < txLength; i++) {
+            Wire.write(txData[i]);
+        }
+        // 后面还要读时不发STOP，使用重复起始
+        error = Wire.endTransmission(rxLength == 0);
+    }
+    
+    if (error == I2C_OK && rxLength > 0) {
+        uint8_t received = Wire.requestFrom(address, rxLength);
+        for (uint8_t i = 0; i < received && i < rxLength; i++) {
+            rxData[i] = Wire.read();
+        }
+        if (received != rxLength) {
+            error = I2C_ERROR_SHORT_READ;
+        }
+    }
+    
+    if (Wire.getWireTimeoutFlag()) {
+        Wire.clearWireTimeoutFlag();
+        error = I2C_ERROR_TIMEOUT;
+    }
+    unsigned long elapsed = micros() - start;
+    
+    I2CDeviceStats* device = findDevice(address);
+    if (device) {
+        device->transfers++;
+        device->lastError = error;
+        if (error == I2C_OK) {
+            uint16_t latency = elapsed > 0xFFFF ? 0xFFFF : (uint16_t)elapsed;
+            device->consecutiveErrors = 0;
+            device->lastLatencyUs = latency;
+            device->totalLatencyUs += latency;
+            if (latency > device->maxLatencyUs) {
+                device->maxLatencyUs = latency;
+            }
+        } else {
+            device->errors++;
+            if (device->consecutiveErrors < 255) {
+                device->consecutiveErrors++;
+            }
+            if (error == I2C_ERROR_TIMEOUT) {
+                device->timeouts++;
+            }
+        }
+    }
+    
+    if (error == I2C_ERROR_TIMEOUT) {
+        recover();
+    }
+    return error;
+}
+
+bool I2CBus::submit(I2CRequest& request) {
+    if (request.state == I2C_REQUEST_PENDING || s_queueCount == I2C_QUEUE_SIZE ||
+        request.txLength > I2C_REQUEST_MAX_TX || request.rxLength > I2C_REQUEST_MAX_RX) {
+        return false;
+    }
+    request.state = I2C_REQUEST_PENDING;
+    request.error = I2C_OK;
+    s_queue[s_queueCount++] = &request;
+    return true;
+}
+
+void I2CBus::cancel(I2CRequest& request) {
+    for (uint8_t i = 0; i < s_queueCount; i++) {
+        if (s_queue[i] == &request) {
+            for (uint8_t j = i + 1; j < s_queueCount; j++) {
+                s_queue[j - 1] = s_queue[j];
+            }
+            s_queueCount--;
+            break;
+        }
+    }
+    request.state = I2C_REQUEST_IDLE;
+}
+
+void I2CBus::poll() {
+    for (uint8_t n = 0; n < I2C_POLL_MAX_REQUESTS && s_queueCount > 0; n++) {
+        // 优先级最高的请求中最早提交的一个
+        uint8_t next = 0;
+        for (uint8_t i = 1; i < s_queueCount; i++) {
+            if (s_queue[i]->priority < s_queue[next]->priority) {
+                next = i;
+            }
+        }
+        I2CRequest* request = s_queue[next];
+        for (uint8_t i = next + 1; i < s_queueCount; i++) {
+            s_queue[i - 1] = s_queue[i];
+        }
+        s_queueCount--;
+        
+        request->error = transfer(request->address, request->txData, request->txLength,
+                                  request->rxData, request->rxLength);
+        request->state = request->error == I2C_OK ? I2C_REQUEST_DONE : I2C_REQUEST_FAILED;
+        request->completedMs = millis();
+    }
+}
+
+bool I2CBus::getDeviceStats(uint8_t address, I2CDeviceStats& stats) {
+    for (uint8_t i = 0; i < s_deviceCount; i++) {
+        if (s_devices[i].address == address) {
+            stats = s_devices[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+void I2CBus::resetStats() {
+    s_deviceCount = 0;
+    s_recoveries = 0;
+}
+
+void I2CBus::printStats() {
+    Logger::info("I2C", "时钟 %lu Hz，总线恢复 %u 次，队列 %d", 
+                 (unsigned long)I2C_CLOCK_HZ, s_recoveries, s_queueCount);
+    for (uint8_t i = 0; i < s_deviceCount; i++) {
+        const I2CDeviceStats& d = s_devices[i];
+        uint32_t ok = d.transfers - d.errors;
+        Logger::info("I2C", "0x%02X: 传输 %lu，错误 %lu（超时 %u，最近 %d），耗时 平均 %lu / 最大 %u us",
+                     d.address, (unsigned long)d.transfers, (unsigned long)d.errors, d.timeouts, d.lastError,
+                     (unsigned long)(ok ? d.totalLatencyUs / ok : 0), d.maxLatencyUs);
+    }
+}
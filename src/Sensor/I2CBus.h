@@ -0,0 +1,118 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "../Utils/Config.h"
+
+// 传输结果：0-4与Wire.endTransmission()相同
+#define I2C_OK                0
+#define I2C_ERROR_DATA_LONG   1
+#define I2C_ERROR_ADDR_NACK   2
+#define I2C_ERROR_DATA_NACK   3
+#define I2C_ERROR_OTHER       4
+#define I2C_ERROR_TIMEOUT     5   // 总线超时（已复位并尝试恢复）
+#define I2C_ERROR_SHORT_READ  6   // 读到的字节数不足
+
+#define I2C_REQUEST_MAX_TX    2
+#define I2C_REQUEST_MAX_RX    4
+
+// 排队请求的优先级，数值小的先执行
+enum I2CPriority : uint8_t {
+    I2C_PRIORITY_HIGH = 0,
+    I2C_PRIORITY_NORMAL,
+    I2C_PRIORITY_LOW
+};
+
+enum I2CRequestState : uint8_t {
+    I2C_REQUEST_IDLE = 0,
+    I2C_REQUEST_PENDING,   // 已提交，等待poll()执行
+    I2C_REQUEST_DONE,
+    I2C_REQUEST_FAILED     // error为失败原因
+};
+
+// 排队执行的一次传输：先写txData（重复起始），再读rxLength字节到rxData
+// 由调用者持有，提交后到完成前不能修改或销毁
+struct I2CRequest {
+    uint8_t address;
+    uint8_t priority;
+    uint8_t txData[I2C_REQUEST_MAX_TX];
+    uint8_t txLength;
+    uint8_t rxData[I2C_REQUEST_MAX_RX];
+    uint8_t rxLength;
+    uint8_t state;
+    uint8_t error;
+    unsigned long completedMs;  // 完成时间
+};
+
+// 单个设备的传输统计
+struct I2CDeviceStats {
+    uint8_t address;
+    uint8_t lastError;
+    uint8_t consecutiveErrors;
+    uint16_t timeouts;
+    uint32_t transfers;
+    uint32_t errors;
+    uint32_t totalLatencyUs;    // 成功传输的累计耗时
+    uint16_t lastLatencyUs;
+    uint16_t maxLatencyUs;
+};
+
+/**
+ * I2C总线管理（红外阵列与颜色传感器共用Wire）
+ *
+ * - begin() 设置 I2C_CLOCK_HZ 和Wire硬件超时，总线被拉住时先恢复
+ * - 直接传输 write()/read()/transfer() 用于实时性要求高的读取（红外巡线）
+ * - submit() 排队的请求由主循环中的 poll() 按优先级执行，每次调用最多 I2C_POLL_MAX_REQUESTS 个，
+ *   限制每个循环占用总线的时间
+ * - 超时后复位TWI，SDA被从机拉低时在SCL上输出最多9个时钟脉冲并发送STOP释放总线
+ * - 按设备地址统计传输次数、错误、超时和耗时，健康检查据此判断而不再额外ping
+ */
+class I2CBus {
+public:
+    // 可重复调用，只初始化一次
+    static void begin();
+    
+    // 写txLength字节后读rxLength字节（两者之间为重复起始），返回I2C_OK或错误码
+    static uint8_t transfer(uint8_t address, const uint8_t* txData, uint8_t txLength,
+                            uint8_t* rxData, uint8_t rxLength);
+    static uint8_t write(uint8_t address, const uint8_t* data, uint8_t length) {
+        return transfer(address, data, length, nullptr, 0);
+    }
+    static uint8_t read(uint8_t address, uint8_t* data, uint8_t length) {
+        return transfer(address, nullptr, 0, data, length);
+    }
+    // 只发地址检测设备是否应答
+    static uint8_t probe(uint8_t address) {
+        return transfer(address, nullptr, 0, nullptr, 0);
+    }
+    
+    // 提交请求，队列已满或请求已在队列中时返回false
+    static bool submit(I2CRequest& request);
+    // 取消尚未执行的请求
+    static void cancel(I2CRequest& request);
+    // 在主循环中调用，执行排队的请求
+    static void poll();
+    
+    // 释放被拉住的总线并重新初始化Wire，成功返回true
+    static bool recover();
+    
+    // 获取设备统计，该地址没有传输记录时返回false
+    static bool getDeviceStats(uint8_t address, I2CDeviceStats& stats);
+    static uint16_t getRecoveryCount() { return s_recoveries; }
+    static void resetStats();
+    static void printStats();
+    
+private:
+    static I2CDeviceStats* findDevice(uint8_t address);
+    static void configureWire();
+    
+    static bool s_started;
+    static uint16_t s_recoveries;
+    static I2CDeviceStats s_devices[I2C_MAX_DEVICES];
+    static uint8_t s_deviceCount;
+    static I2CRequest* s_queue[I2C_QUEUE_SIZE];   // 按提交顺序
+    static uint8_t s_queueCount;
+};
+
+#endif // I2C_BUS_H
@@ -1,5 +1,7 @@
 #include "Infrared.h"
 #include "../Utils/Logger.h"
+#include "../Utils/TraceRecorder.h"
+#include "I2CBus.h"
 
 InfraredArray::InfraredArray() : i2cAddress(0), isConnected(false), initialized(false) {
     // 初始化传感器数值
@@ -20,11 +22,10 @@ bool InfraredArray::begin() {
         return false;
     }
     
-    Wire.begin(); // 确保I2C总线已初始化
+    I2CBus::begin(); // 确保I2C总线已初始化
     
     // 简单测试I2C连接
-    Wire.beginTransmission(i2cAddress);
-    byte error = Wire.endTransmission();
+    uint8_t error = I2CBus::probe(i2cAddress);
     
     if (error == 0) {
         isConnected = true;
@@ -47,6 +48,7 @@ bool InfraredArray::begin() {
             case 2: errorMsg = "地址未应答(NACK)"; break;
             case 3: errorMsg = "数据未应答(NACK)"; break;
             case 4: errorMsg = "其他I2C错误"; break;
+            case I2C_ERROR_TIMEOUT: errorMsg = "总线超时"; break;
         }
         
         Logger::error("Infrared", "红外线传感器连接失败 (地址: 0x%02X) - 错误 %d: %s", 
@@ -63,13 +65,10 @@ SensorStatus InfraredArray::checkHealth() {
     if (!initialized) return SensorStatus::NOT_INITIALIZED;
     if (!isConnected) return SensorStatus::ERROR_COMM;
     
-    // 简单通信测试
-    Wire.beginTransmission(i2cAddress);
-    byte error = Wire.endTransmission();
-    
-    if (error != 0) {
-        isConnected = false;
-        return SensorStatus::ERROR_COMM;
+    // 根据总线统计判断，不再额外占用总线
+    I2CDeviceStats stats;
+    if (I2CBus::getDeviceStats(i2cAddress, stats) && stats.consecutiveErrors >= I2C_HEALTH_MAX_ERRORS) {
+        return stats.lastError == I2C_ERROR_TIMEOUT ? SensorStatus::ERROR_TIMEOUT : SensorStatus::ERROR_COMM;
     }
     
     return SensorStatus::OK;
@@ -81,17 +80,16 @@ void InfraredArray::update() {
     }
     
     // 根据示例代码，发送读取命令并处理数据
-    byte data = 0;
+    uint8_t data = 0;
     
-    Wire.beginTransmission(i2cAddress);
-    Wire.write(IR_READ_REGISTER);  // 使用常量替代硬编码的0x30寄存器地址
-    Wire.endTransmission();
+    if (I2CBus::write(i2cAddress, &IR_READ_REGISTER, 1) != I2C_OK) {
+        return; // 读取失败时保留上次的值
+    }
     
     delay(10); // 给设备足够时间处理请求
     
-    Wire.requestFrom(int(i2cAddress), int(1)); // 请求1个字节的数据
-    if (Wire.available()) {
-        data = Wire.read();
+    if (I2CBus::read(i2cAddress, &data, 1) != I2C_OK) {
+        return;
     }
     
     // 解析数据到各个传感器值
@@ -104,6 +102,8 @@ void InfraredArray::update() {
     sensorValues[6] = (data >> 1) & 0x01;
     sensorValues[7] = (data >> 0) & 0x01;
     
+    TRACE_INFRARED(data);
+    
     //Logger::debug("Infrared", "红外传感器值: %d,%d,%d,%d,%d,%d,%d,%d", 
     //             sensorValues[0], sensorValues[1], sensorValues[2], sensorValues[3],
     //             sensorValues[4], sensorValues[5], sensorValues[6], sensorValues[7]);
@@ -170,6 +170,21 @@ void InfraredArray::getAllSensorValues(uint16_t values[8]) const {
     }
 }
 
+void InfraredArray::formatValues(const uint16_t values[8], char* buffer, size_t bufferSize) {
+    if (bufferSize < 11) {
+        if (bufferSize > 0) {
+            buffer[0] = '\0';
+        }
+        return;
+    }
+    buffer[0] = '[';
+    for (int i = 0; i < 8; i++) {
+        buffer[1 + i] = (values[i] == 0) ? '0' : '1';
+    }
+    buffer[9] = ']';
+    buffer[10] = '\0';
+}
+
 bool InfraredArray::isLineDetected() {
     // 检查是否有任何传感器检测到线
     for (int i = 0; i < 8; i++) {
@@ -2,7 +2,6 @@
 #define INFRARED_H
 
 #include <Arduino.h>
-#include <Wire.h>
 #include "../Utils/Config.h"
 #include "SensorCommon.h"
 
@@ -51,6 +50,9 @@ public:
     // 填充传感器值到提供的数组
     void getAllSensorValues(uint16_t values[8]) const;
     
+    // 把8路数字量格式化为"[01100000]"（用于日志），bufferSize至少11
+    static void formatValues(const uint16_t values[8], char* buffer, size_t bufferSize);
+    
     // 判断是否检测到线
     bool isLineDetected();
     
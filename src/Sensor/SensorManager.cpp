@@ -1,15 +1,24 @@
 #include "SensorManager.h"
 #include "../Utils/Logger.h"
+#include "I2CBus.h"
 
 SensorManager::SensorManager() 
     : allSensorsInitialized(false), 
       lastValidDistance(0), 
       lastValidLinePosition(0), 
-      lastValidColor(COLOR_UNKNOWN) {
+      lastValidColor(COLOR_UNKNOWN),
+      colorSamplingEnabled(false),
+      nextColorSampleTime(0),
+      colorSampleHead(0),
+      colorSampleCount(0),
+      colorSampleSeq(0),
+      colorReadErrors(0) {
     // 初始化缓存数组
     for (int i = 0; i < 8; i++) {
         lastInfraredValues[i] = 0;
     }
+    memset(colorVotes, 0, sizeof(colorVotes));
+    memset(&colorRequest, 0, sizeof(colorRequest));
 }
 
 bool SensorManager::initAllSensors() {
@@ -105,7 +114,9 @@ bool SensorManager::checkAllSensorsHealth() {
 void SensorManager::updateAll() {
     // 更新各个传感器数据
     updateInfrared();
-    //updateColor();
+    // 执行排队的I2C请求（颜色采样等）
+    I2CBus::poll();
+    updateColor();
     // 主动更新超声波传感器
     // 超声波传感器在状态机中很重要，应当主动更新
     // float distance;
@@ -126,12 +137,106 @@ void SensorManager::updateInfrared() {
 }
 
 void SensorManager::updateColor() {
-    // 颜色传感器不需要主动调用update，由各方法自动更新
-    // 保留此方法以兼容现有代码
+    // 后台采样：未启用或未到采样时间时不访问I2C
+    if (!colorSamplingEnabled || !colorSensor.isInitialized()) {
+        return;
+    }
+    if (colorRequest.state == I2C_REQUEST_PENDING) {
+        return; // 等待I2CBus::poll()执行
+    }
+    unsigned long now = millis();
+    
+    if (colorRequest.state != I2C_REQUEST_IDLE) {
+        uint8_t h, s, l;
+        bool ok = colorSensor.finishHSLRequest(colorRequest, h, s, l);
+        colorRequest.state = I2C_REQUEST_IDLE;
+        if (ok) {
+            addColorSample(colorRequest.completedMs, h, s, l);
+        } else {
+            // 读取失败时推迟重试，避免传感器断开时每个循环都占用总线
+            colorReadErrors++;
+            nextColorSampleTime = now + COLOR_SAMPLE_RETRY_MS;
+        }
+    }
+    
+    if ((long)(now - nextColorSampleTime) < 0) {
+        return;
+    }
+    colorSensor.prepareHSLRequest(colorRequest);
+    if (I2CBus::submit(colorRequest)) {
+        nextColorSampleTime = now + COLOR_SAMPLE_INTERVAL_MS;
+    }
+}
+
+void SensorManager::addColorSample(unsigned long timeMs, uint8_t h, uint8_t s, uint8_t l) {
+    // 缓冲已满时移出最旧的读数
+    if (colorSampleCount == COLOR_SAMPLE_RING_SIZE) {
+        const ColorSample& oldest = colorSamples[colorSampleHead];
+        if (oldest.confidence >= COLOR_MIN_CONFIDENCE) {
+            colorVotes[oldest.color]--;
+        }
+    } else {
+        colorSampleCount++;
+    }
+    
+    ColorSample& sample = colorSamples[colorSampleHead];
+    sample.timeMs = timeMs;
+    sample.h = h;
+    sample.s = s;
+    sample.l = l;
+    sample.color = colorSensor.classify(h, s, l, sample.confidence);
+    if (sample.confidence >= COLOR_MIN_CONFIDENCE) {
+        colorVotes[sample.color]++;
+        lastValidColor = sample.color;
+    }
+    
+    colorSampleHead = (colorSampleHead + 1) % COLOR_SAMPLE_RING_SIZE;
+    colorSampleSeq++;
+}
+
+void SensorManager::setColorSampling(bool enable) {
+    if (enable && !colorSamplingEnabled) {
+        colorSampleHead = 0;
+        colorSampleCount = 0;
+        memset(colorVotes, 0, sizeof(colorVotes));
+        nextColorSampleTime = millis();
+    }
+    if (!enable) {
+        I2CBus::cancel(colorRequest);
+    }
+    colorSamplingEnabled = enable;
+}
+
+bool SensorManager::getLatestColorSample(ColorSample& sample) const {
+    if (colorSampleCount == 0) {
+        return false;
+    }
+    uint8_t latest = (colorSampleHead + COLOR_SAMPLE_RING_SIZE - 1) % COLOR_SAMPLE_RING_SIZE;
+    if (millis() - colorSamples[latest].timeMs > COLOR_SAMPLE_STALE_MS) {
+        return false;
+    }
+    sample = colorSamples[latest];
+    return true;
 }
 
-float SensorManager::getStableDistanceCm(int samples, int delayMs) {
-    return ultrasonicSensor.getStableDistanceCm(samples, delayMs);
+ColorCode SensorManager::getSampledColor(uint8_t& votes) const {
+    votes = 0;
+    ColorSample latest;
+    if (!getLatestColorSample(latest)) {
+        return COLOR_UNKNOWN;
+    }
+    uint8_t best = COLOR_UNKNOWN;
+    for (uint8_t i = COLOR_UNKNOWN + 1; i < COLOR_COUNT; i++) {
+        if (colorVotes[i] > colorVotes[best]) {
+            best = i;
+        }
+    }
+    votes = colorVotes[best];
+    return static_cast<ColorCode>(best);
+}
+
+float SensorManager::getStableDistanceCm() {
+    return ultrasonicSensor.getStableDistanceCm();
 }
 
 bool SensorManager::getDistanceCm(float& distance) {
@@ -306,6 +411,9 @@ void SensorManager::printAllDebugInfo() {
     Logger::debug("SensorMgr", "--- 颜色传感器 ---");
     colorSensor.debugPrint();
     
+    Logger::debug("SensorMgr", "--- I2C总线 ---");
+    I2CBus::printStats();
+    
     Logger::debug("SensorMgr", "=============================");
 }
 
@@ -318,4 +426,51 @@ void SensorManager::debugColorSensor() {
 }
 
 
- 
\ No newline at end of file
+ 
+
+bool SensorManager::handleCommand(const char* command) {
+    // 命令格式:
+    //   CAL [SHOW]                          打印颜色校准
+    //   CAL <RED|BLUE|YELLOW|BLACK|WHITE>   采样传感器前的物块，更新该颜色（未保存）
+    //   CAL SAVE                            写入EEPROM，重启后自动加载
+    //   CAL RESET                           清除EEPROM记录，恢复默认
+    if (strncasecmp(command, "CAL", 3) != 0 || (command[3] != ' ' && command[3] != '\0')) {
+        return false;
+    }
+    
+    const char* action = command + 3;
+    while (*action == ' ') {
+        action++;
+    }
+    
+    if (!colorSensor.isInitialized()) {
+        Logger::warning("ColorCal", "颜色传感器未初始化");
+        return true;
+    }
+    
+    static const char* const COLOR_NAMES[COLOR_COUNT] = { "UNKNOWN", "WHITE", "BLACK", "RED", "BLUE", "YELLOW" };
+    
+    if (*action == '\0' || strcasecmp(action, "SHOW") == 0) {
+        colorSensor.printCalibration();
+    } else if (strcasecmp(action, "SAVE") == 0) {
+        if (colorSensor.saveCalibration()) {
+            Logger::info("ColorCal", "颜色校准已写入EEPROM");
+        } else {
+            Logger::error("ColorCal", "颜色校准写入EEPROM失败");
+        }
+    } else if (strcasecmp(action, "RESET") == 0) {
+        colorSensor.resetCalibration();
+        Logger::info("ColorCal", "颜色校准已恢复默认");
+    } else {
+        for (uint8_t color = COLOR_WHITE; color < COLOR_COUNT; color++) {
+            if (strcasecmp(action, COLOR_NAMES[color]) == 0) {
+                if (colorSensor.calibrateColor((ColorCode)color, COLOR_CAL_SAMPLES, COLOR_CAL_SAMPLE_DELAY_MS)) {
+                    Logger::info("ColorCal", "%s 已校准，确认无误后发送 CAL SAVE 保存", COLOR_NAMES[color]);
+                }
+                return true;
+            }
+        }
+        Logger::warning("ColorCal", "未知校准命令: %s", action);
+    }
+    return true;
+}
@@ -7,6 +7,14 @@
 #include "ColorSensor.h"
 #include "SensorCommon.h"
 
+// 后台采样得到的一次颜色读数
+struct ColorSample {
+    unsigned long timeMs;   // 采样时间
+    uint8_t h, s, l;
+    ColorCode color;        // 分类结果（未做置信度过滤）
+    uint8_t confidence;     // 0-100
+};
+
 class SensorManager {
 private:
     InfraredArray infraredSensor;
@@ -22,9 +30,21 @@ private:
     ColorCode lastValidColor;  // 上次检测到的有效颜色
     uint16_t lastInfraredValues[8]; // 缓存的红外传感器值
     
+    // 颜色后台采样（环形缓冲，按时间顺序）
+    bool colorSamplingEnabled;
+    unsigned long nextColorSampleTime;
+    I2CRequest colorRequest;        // 排队中的HSL读取
+    ColorSample colorSamples[COLOR_SAMPLE_RING_SIZE];
+    uint8_t colorSampleHead;        // 下一个写入位置
+    uint8_t colorSampleCount;
+    uint16_t colorSampleSeq;        // 累计采样序号，用于判断是否有新读数
+    uint8_t colorVotes[COLOR_COUNT]; // 缓冲内各颜色的可信读数个数
+    uint16_t colorReadErrors;
+    
     // 内部更新函数
     void updateInfrared();
     void updateColor();
+    void addColorSample(unsigned long timeMs, uint8_t h, uint8_t s, uint8_t l);
     
 public:
     SensorManager();
@@ -61,11 +81,19 @@ public:
     // DEPRECATED: 请使用 getDistanceCm(float& distance) 替代
     float getUltrasonicDistance();
     
+    // 获取最近一次有效的距离读数（厘米），不触发测量，没有时为0
+    float getLastDistanceCm() const { return lastValidDistance; }
+    
     // 判断是否有障碍物在指定距离内
     bool isObstacleDetected(float threshold);
 
-    // 获取稳定过滤后的距离读数（厘米）
-    float getStableDistanceCm(int samples = 10, int delayMs = 2);
+    // 获取滤波后的距离读数（厘米），不阻塞；没有有效估计时返回 -1
+    float getStableDistanceCm();
+    
+    // 获取滤波后的距离（厘米）和方差(cm²)，不触发测量
+    bool getFilteredDistanceCm(float& distance, float& variance) const {
+        return ultrasonicSensor.getFilteredDistance(distance, variance);
+    }
     
     // 获取超声波脉冲持续时间
     unsigned long measurePulseDuration(){
@@ -107,6 +135,30 @@ public:
     // 获取颜色传感器HSL值到提供的引用参数
     bool getColorSensorHSL(uint8_t& h, uint8_t& s, uint8_t& l);
     
+    // --- 颜色后台采样 ---
+    // 启用后 updateAll() 每 COLOR_SAMPLE_INTERVAL_MS 向I2CBus提交一次HSL读取，完成后分类，
+    // 使用者读取缓存结果，不等待I2C；只在需要颜色的状态中启用
+    
+    // 启用/停用后台采样，启用时清空缓冲
+    void setColorSampling(bool enable);
+    bool isColorSampling() const { return colorSamplingEnabled; }
+    
+    // 最新一次读数，没有读数或超过 COLOR_SAMPLE_STALE_MS 时返回false
+    bool getLatestColorSample(ColorSample& sample) const;
+    
+    // 缓冲内可信读数（置信度不低于COLOR_MIN_CONFIDENCE）最多的颜色，
+    // votes为该颜色的读数个数；最新读数过期时返回COLOR_UNKNOWN
+    ColorCode getSampledColor(uint8_t& votes) const;
+    
+    // 累计采样序号，每次新读数加1
+    uint16_t getColorSampleSeq() const { return colorSampleSeq; }
+    
+    // 后台采样的I2C读取失败次数
+    uint16_t getColorReadErrors() const { return colorReadErrors; }
+    
+    // 颜色校准命令（CAL ...），不是校准命令时返回false
+    bool handleCommand(const char* command);
+    
     // === 调试功能 ===
     
     // 打印指定传感器的调试信息
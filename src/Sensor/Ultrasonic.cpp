@@ -1,6 +1,6 @@
 #include "Ultrasonic.h"
 #include "../Utils/Logger.h"
-#include <stdlib.h>  // 为了 qsort
+#include "../Utils/TraceRecorder.h"
 UltrasonicSensor::UltrasonicSensor() : trigPin(0), echoPin(0), initialized(false), lastPulseDuration(0) {
 }
 
@@ -57,6 +57,8 @@ unsigned long UltrasonicSensor::measurePulseDuration() {
     
     // 读取回波时间（微秒）
     lastPulseDuration = pulseIn(echoPin, HIGH, ULTRASONIC_PULSE_TIMEOUT);
+    TRACE_PULSE(lastPulseDuration);
+    filter.update(calculateDistance(lastPulseDuration), millis());
     
     if (lastPulseDuration == 0) {
     //    Logger::warning("Ultrasonic", "超声波脉冲检测超时");
@@ -111,69 +113,33 @@ void UltrasonicSensor::debugPrint() {
     Logger::debug("Ultrasonic", "状态: %s, Trig: %d, Echo: %d, 最近脉冲: %lu us, 计算距离: %.2f cm",
                  initialized ? "已初始化" : "未初始化", trigPin, echoPin, 
                  lastPulseDuration, distance);
+    
+    float filtered, variance;
+    if (filter.getEstimate(filtered, variance, millis())) {
+        Logger::debug("Ultrasonic", "滤波距离: %.2f cm, 方差: %.3f", filtered, variance);
+    }
+    Logger::debug("Ultrasonic", "读数统计: 采纳 %u, 野值 %u, 无回波 %u",
+                 filter.getAcceptedCount(), filter.getRejectedCount(), filter.getMissedCount());
 } 
 
-// qsort 的比较函数
-static int compareFloats(const void* a, const void* b) {
-    float fa = *(const float*)a;
-    float fb = *(const float*)b;
-    // 基本比较
-    if (fa < fb) return -1;
-    if (fa > fb) return 1;
-    return 0;
-}
-
-float UltrasonicSensor::getStableDistanceCm(int samples, int delayMs) {
+float UltrasonicSensor::getStableDistanceCm() {
     if (!initialized) {
         Logger::warning("Ultrasonic", "尝试在未初始化的状态下获取稳定距离");
         return -1.0f;
     }
 
-    if (samples < 3) {
-         Logger::warning("Ultrasonic", "获取稳定距离所需的样本数至少为 3，请求为 %d", samples);
-         return -1.0f; // 需要至少3个样本才能去掉最大最小值
+    // 最近刚测过则直接使用估计，避免连续触发时前一次回波未散尽
+    if (!filter.isValid() || millis() - filter.getLastUpdateMs() >= DISTANCE_FILTER_PING_MS) {
+        measurePulseDuration();
     }
 
-    float readings[10]; // 预分配最大样本数为10
-    int validCount = 0;
-
-    // 1. 进行多次测量
-    for (int i = 0; i < samples; ++i) {
-        float dist = getDistance();
-        // 2. 只存储有效读数 (大于 0)
-        if (dist > 0) {
-            readings[validCount++] = dist;
-        } else {
-            // 可以记录无效读数，帮助调试
-            // Logger::debug("Ultrasonic", "样本 %d/%d 无效 (%.2f)", i + 1, samples, dist);
-        }
-        // 3. 每次测量后延迟
-        if (i < samples - 1) { // 最后一次测量后不需要延迟
-           delay(delayMs);
-        }
-    }
-
-    // 4. 检查有效读数数量
-    if (validCount < 3) {
-        Logger::warning("Ultrasonic", "有效读数不足 (%d/%d)，无法计算稳定距离", validCount, samples);
-        return -1.0f; // 不足以移除最大最小值并计算平均
-    }
-
-    // 5. 对有效读数进行排序 (使用 stdlib 的 qsort)
-    qsort(readings, validCount, sizeof(float), compareFloats);
-
-    // 6. 计算去除最大最小值后的总和
-    float sum = 0; 
-    for (int i = 1; i < validCount - 1; ++i) {
-        sum += readings[i];
+    float distance, variance;
+    if (!getFilteredDistance(distance, variance)) {
+        return -1.0f;
     }
+    return distance;
+}
 
-    // 7. 计算平均值
-    float averageDistance = sum / (validCount - 2);
-
-    Logger::debug("Ultrasonic", "稳定距离计算: %d 个样本, %d 个有效读数, 移除 %.2f 和 %.2f, 平均值: %.2f cm",
-                  samples, validCount, readings[0], readings[validCount - 1], averageDistance);
-
-    // 8. 返回平均距离
-    return averageDistance;
-}
\ No newline at end of file
+bool UltrasonicSensor::getFilteredDistance(float& distance, float& variance) const {
+    return filter.getEstimate(distance, variance, millis());
+}
@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include "../Utils/Config.h"
 #include "SensorCommon.h"
+#include "DistanceFilter.h"
 
 class UltrasonicSensor {
 private:
@@ -11,6 +12,7 @@ private:
     uint8_t echoPin;  // 回声引脚
     bool initialized; // 初始化状态
     unsigned long lastPulseDuration; // 上次测量的脉冲时长
+    DistanceFilter filter;           // 每次测量都输入的距离滤波器
     
     // 距离计算函数
     float calculateDistance(unsigned long duration);
@@ -40,16 +42,20 @@ public:
     bool isObstacleDetected(float threshold);
     
     /**
-     * @brief 获取稳定过滤后的距离读数（厘米）。
+     * @brief 获取滤波后的距离读数（厘米），不阻塞。
      *
-     * 该函数进行多次测量，去除最大和最小值，然后计算剩余值的平均值，
-     * 以减少瞬时噪声或异常读数的影响。
+     * 每次 measurePulseDuration() 的读数都输入 DistanceFilter，这里直接返回当前估计；
+     * 距上次测量不足 DISTANCE_FILTER_PING_MS 时不再测量，否则先测量一次。
      *
-     * @param samples 要进行的测量次数 (默认 10)。
-     * @param delayMs 每次测量之间的延迟时间（毫秒）(默认 10)。
-     * @return float 稳定后的平均距离（厘米）。如果有效读数少于3个，返回 -1.0。
+     * @return float 滤波后的距离（厘米）。尚无有效估计时返回 -1.0。
      */
-    float getStableDistanceCm(int samples = 10, int delayMs = 2);
+    float getStableDistanceCm();
+
+    // 获取滤波后的距离和方差(cm²)，不触发测量；没有有效估计时返回 false
+    bool getFilteredDistance(float& distance, float& variance) const;
+
+    // 滤波器（统计信息）
+    const DistanceFilter& getFilter() const { return filter; }
 
     // 调试打印
     void debugPrint();
@@ -3,8 +3,9 @@
 #include "../Utils/BluetoothSerial.h"
 #include "../Utils/Logger.h"
 #include "../Utils/Config.h"
+#include "../Utils/FixedString.h"
 
-String receivedCommand = "";
+FixedString<64> receivedCommand;
 bool newCommandReceived = false;
 unsigned long lastDataSendTime = 0;
 const unsigned long DATA_SEND_INTERVAL = 1000; // 每秒发送一次数据
@@ -16,31 +17,31 @@ bool isLineDetected = true;
 
 // 处理命令
 void processCommand(const char* command) {
-  String cmd = String(command);
+  FixedString<64> cmd(command);
   cmd.trim();
   
   // 检查是否是带前缀的命令
   if (cmd.startsWith("$CMD:")) {
-    cmd = cmd.substring(5); // 去除前缀
+    cmd.removePrefix(5); // 去除前缀
   }
   
   Logger::info("收到指令: %s", cmd.c_str());
   
   if (cmd.startsWith("led")) {
     // 模拟LED控制命令
-    int ledValue = cmd.substring(3).toInt();
+    int ledValue = atoi(cmd.c_str() + 3);
     Logger::info("设置LED亮度: %d", ledValue);
     BtSerial.sendResponse("led", true);
   }
   else if (cmd.startsWith("speed")) {
     // 模拟速度设置命令
-    int speedValue = cmd.substring(5).toInt();
+    int speedValue = atoi(cmd.c_str() + 5);
     Logger::info("设置速度: %d", speedValue);
     BtSerial.sendResponse("speed", true);
   }
   else if (cmd.startsWith("debug")) {
     // 设置日志级别
-    int debugLevel = cmd.substring(5).toInt();
+    int debugLevel = atoi(cmd.c_str() + 5);
     Logger::setLogLevel(debugLevel);
     Logger::info("设置日志级别: %d", debugLevel);
     BtSerial.sendResponse("debug", true);
@@ -70,29 +71,15 @@ void processCommand(const char* command) {
     BtSerial.sendResponse("scan", true);
   }
   else if (cmd == "help") {
-    String helpMsg = "可用命令:\n";
-    helpMsg += "led[0-255] - 设置LED亮度\n";
-    helpMsg += "speed[0-255] - 设置速度\n";
-    helpMsg += "debug[1-4] - 设置日志级别\n";
-    helpMsg += "start - 开始测试\n";
-    helpMsg += "stop - 停止测试\n";
-    helpMsg += "scan - 模拟传感器扫描\n";
-    helpMsg += "help - 显示帮助";
-    
-    // 分行发送帮助信息
-    int start = 0;
-    int end = helpMsg.indexOf('\n');
-    while (end >= 0) {
-      String line = helpMsg.substring(start, end);
-      BtSerial.println(line.c_str());
-      start = end + 1;
-      end = helpMsg.indexOf('\n', start);
-    }
-    
-    // 发送最后一行
-    if (start < helpMsg.length()) {
-      BtSerial.println(helpMsg.substring(start).c_str());
-    }
+    // 逐行发送帮助信息
+    BtSerial.println("可用命令:");
+    BtSerial.println("led[0-255] - 设置LED亮度");
+    BtSerial.println("speed[0-255] - 设置速度");
+    BtSerial.println("debug[1-4] - 设置日志级别");
+    BtSerial.println("start - 开始测试");
+    BtSerial.println("stop - 停止测试");
+    BtSerial.println("scan - 模拟传感器扫描");
+    BtSerial.println("help - 显示帮助");
     
     BtSerial.sendResponse("help", true);
   }
@@ -162,9 +149,14 @@ void loop() {
   }
   
   // 处理硬件串口命令 (可同时使用硬件串口和蓝牙控制)
-  if (Serial.available() > 0) {
-    String cmd = Serial.readStringUntil('\n');
-    processCommand(cmd.c_str());
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+    if (c == '\n') {
+      processCommand(receivedCommand.c_str());
+      receivedCommand.clear();
+    } else {
+      receivedCommand.append(c);
+    }
   }
   
   // 简单延时
@@ -47,6 +47,9 @@ SampleData yellowSample = {255, 0, 255, 0, 255, 0, 0};
 SampleData blackSample = {255, 0, 255, 0, 255, 0, 0};
 SampleData whiteSample = {255, 0, 255, 0, 255, 0, 0};
 
+// 各颜色的样本累计（下标为ColorCode），用于生成写入EEPROM的校准记录
+ColorSampleAccumulator accumulators[COLOR_COUNT];
+
 // 更新样本数据
 void updateSampleData(SampleData& data, uint8_t h, uint8_t s, uint8_t l) {
   // 更新H分量（注意：红色可能跨越0度）
@@ -107,6 +110,8 @@ void printMenu() {
   Logger::info("r - 重置所有校准数据");
   Logger::info("p - 打印当前校准结果");
   Logger::info("c - 继续到下一步");
+  Logger::info("w - 将校准结果写入EEPROM（主程序启动时自动加载）");
+  Logger::info("e - 清除EEPROM中的校准，恢复默认");
   Logger::info("i - 显示传感器状态");
   Logger::info("? - 显示此菜单");
   Logger::info("===================================");
@@ -154,7 +159,8 @@ void printCalibrationResults() {
   Logger::info("==========================");
   
   if (currentState == STATE_COMPLETE) {
-    Logger::info("阈值设置建议 (可复制到ColorSensor.cpp中):");
+    Logger::info("保存本次串口日志，运行 python3 tools/color_lut.py --log <日志> 生成查找表");
+    Logger::info("使用固定阈值时(COLOR_USE_CLASSIFIER 0)的阈值设置建议 (可复制到ColorSensor.cpp中):");
     Logger::info("// 红色阈值 (H接近0或接近240)");
     Logger::info("colorThresholds[COLOR_RED].minH = %d;", redSample.minH);
     Logger::info("colorThresholds[COLOR_RED].maxH = %d; // 跨0判断", redSample.maxH);
@@ -206,6 +212,10 @@ void startCalibration() {
   blackSample = {255, 0, 255, 0, 255, 0, 0};
   whiteSample = {255, 0, 255, 0, 255, 0, 0};
   
+  for (uint8_t i = 0; i < COLOR_COUNT; i++) {
+    accumulators[i].reset();
+  }
+  
   // 设置初始状态
   currentState = STATE_AWAIT_RED;
   sampleCount = 0;
@@ -221,6 +231,9 @@ void resetCalibration() {
   yellowSample = {255, 0, 255, 0, 255, 0, 0};
   blackSample = {255, 0, 255, 0, 255, 0, 0};
   whiteSample = {255, 0, 255, 0, 255, 0, 0};
+  for (uint8_t i = 0; i < COLOR_COUNT; i++) {
+    accumulators[i].reset();
+  }
   
   currentState = STATE_IDLE;
   sampleCount = 0;
@@ -235,23 +248,29 @@ void sampleColor() {
   // 读取HSL值
   if (colorSensor.getColorHSL(h, s, l)) {
     SampleData* targetSample = nullptr;
+    ColorCode targetColor = COLOR_UNKNOWN;
     
     // 根据当前状态选择目标样本
     switch (currentState) {
       case STATE_SAMPLING_RED:
         targetSample = &redSample;
+        targetColor = COLOR_RED;
         break;
       case STATE_SAMPLING_BLUE:
         targetSample = &blueSample;
+        targetColor = COLOR_BLUE;
         break;
       case STATE_SAMPLING_YELLOW:
         targetSample = &yellowSample;
+        targetColor = COLOR_YELLOW;
         break;
       case STATE_SAMPLING_BLACK:
         targetSample = &blackSample;
+        targetColor = COLOR_BLACK;
         break;
       case STATE_SAMPLING_WHITE:
         targetSample = &whiteSample;
+        targetColor = COLOR_WHITE;
         break;
       default:
         return; // 不在采样状态
@@ -259,10 +278,13 @@ void sampleColor() {
     
     // 更新样本数据
     updateSampleData(*targetSample, h, s, l);
+    accumulators[targetColor].add(h, s, l);
     
     // 显示当前值
     Logger::info("样本 %d/%d - H:%d, S:%d, L:%d", 
                 sampleCount + 1, SAMPLES_PER_COLOR, h, s, l);
+    // 供 tools/color_lut.py --log 读取
+    Logger::info("CAL,%d,%d,%d,%d", targetColor, h, s, l);
     
     // 增加样本计数
     sampleCount++;
@@ -307,6 +329,37 @@ void sampleColor() {
   }
 }
 
+// 将已采样颜色的结果写入EEPROM，未采样的颜色保留当前值
+void saveCalibration() {
+  ColorCalibrationData data;
+  colorSensor.getCalibration(data);
+  
+  uint8_t updated = 0;
+  for (uint8_t i = COLOR_UNKNOWN + 1; i < COLOR_COUNT; i++) {
+    bool useHue = (i != COLOR_BLACK && i != COLOR_WHITE);
+    ColorThreshold threshold;
+    ColorModel model;
+    if (accumulators[i].toThreshold(threshold) && accumulators[i].toModel(model, useHue)) {
+      data.thresholds[i] = threshold;
+      data.models[i] = model;
+      updated++;
+    }
+  }
+  
+  if (updated == 0) {
+    Logger::warning("没有已采样的颜色，请先按's'校准");
+    return;
+  }
+  
+  colorSensor.applyCalibration(data);
+  if (colorSensor.saveCalibration()) {
+    Logger::info("已写入EEPROM（%d 种颜色已更新）", updated);
+    colorSensor.printCalibration();
+  } else {
+    Logger::error("写入EEPROM失败");
+  }
+}
+
 // 处理用户命令
 void processCommand(char command) {
   switch (command) {
@@ -356,6 +409,15 @@ void processCommand(char command) {
       }
       break;
       
+    case 'w':
+      saveCalibration();
+      break;
+      
+    case 'e':
+      colorSensor.resetCalibration();
+      Logger::info("EEPROM中的校准已清除，恢复默认");
+      break;
+      
     case 'i':
       Logger::info("传感器状态:");
       colorSensor.debugPrint();
@@ -8,6 +8,7 @@
 #include "../Control/LineFollower.h"
 #include "../Utils/Config.h"
 #include "../Utils/Logger.h"
+#include "../Utils/FixedString.h"
 
 // 函数声明
 void printHelp();
@@ -18,13 +19,13 @@ void executeJunctionAction(JunctionType junction);
 MotionController motionController;
 SensorManager sensorManager;
 LineDetector lineDetector;
-LineFollower* lineFollower;  // 使用指针，因为需要在setup中初始化
+LineFollower lineFollower(sensorManager);
 
 // 测试配置
 bool testRunning = true;
 bool autoMode = true;  // 添加自动模式控制
 bool newCommandReceived = false;
-String receivedCommand = "";
+FixedString<64> receivedCommand;
 unsigned long lastUpdateTime = 0;
 unsigned long junctionLastDetectedTime = 0;
 const unsigned long JUNCTION_DETECTION_COOLDOWN = 1500; // 路口检测冷却时间（毫秒）
@@ -122,7 +123,8 @@ void displaySensorStatus() {
 }
 
 // 处理串口命令
-void processCommand(String command) {
+void processCommand(const char* input) {
+    FixedString<64> command(input);
     command.trim();
     
     if (command.startsWith("start") || command == "s") {
@@ -130,8 +132,8 @@ void processCommand(String command) {
         autoMode = true;
         junctionCounter = 0;
         junctionHistoryIndex = 0;
-        lineFollower->reset();
-        lineFollower->setPIDParams(1.0, 0.0, 1.0); // 使用更优的PID参数
+        lineFollower.reset();
+        lineFollower.setPIDParams(1.0, 0.0, 1.0); // 使用更优的PID参数
         Logger::info("路口巡线测试启动(自动模式)");
         Logger::info("等待3秒后开始...");
         delay(3000);
@@ -152,16 +154,16 @@ void processCommand(String command) {
         Logger::info("切换到自动模式");
     }
     else if (command.startsWith("kp")) {
-        float value = command.substring(3).toFloat();
+        float value = atof(command.c_str() + 3);
         if (value >= 0) {
-            lineFollower->setPIDParams(value, lineFollower->getKi(), lineFollower->getKd());
+            lineFollower.setPIDParams(value, lineFollower.getKi(), lineFollower.getKd());
             Logger::info("设置Kp = %.2f", value);
         }
     }
     else if (command.startsWith("kd")) {
-        float value = command.substring(3).toFloat();
+        float value = atof(command.c_str() + 3);
         if (value >= 0) {
-            lineFollower->setPIDParams(lineFollower->getKp(), lineFollower->getKi(), value);
+            lineFollower.setPIDParams(lineFollower.getKp(), lineFollower.getKi(), value);
             Logger::info("设置Kd = %.2f", value);
         }
     }
@@ -202,9 +204,9 @@ void processCommand(String command) {
         Logger::info("后退完成");
     }
     else if (command.startsWith("speed")) {
-        int value = command.substring(6).toInt();
+        int value = atoi(command.c_str() + 6);
         if (value > 0) {
-            lineFollower->setBaseSpeed(value);
+            lineFollower.setBaseSpeed(value);
             Logger::info("设置基础速度 = %d", value);
         }
     }
@@ -212,7 +214,7 @@ void processCommand(String command) {
         junctionCounter = 0;
         junctionHistoryIndex = 0;
         lastJunctionType = NO_JUNCTION;
-        lineFollower->reset();
+        lineFollower.reset();
         Logger::info("重置路口计数和巡线状态");
     }
     else if (command.startsWith("history") || command == "h") {
@@ -283,10 +285,9 @@ void setup() {
     
     // 初始化巡线控制器
     // 假设LineFollower已被修改为接受SensorManager而不是InfraredArray
-    lineFollower = new LineFollower(sensorManager);
-    lineFollower->init();
-    lineFollower->setPIDParams(1.0, 0.0, 1.0); // 使用更优的PID参数
-    lineFollower->setBaseSpeed(FOLLOW_SPEED);
+    lineFollower.init();
+    lineFollower.setPIDParams(1.0, 0.0, 1.0); // 使用更优的PID参数
+    lineFollower.setBaseSpeed(FOLLOW_SPEED);
     Logger::info("JuncTest", "巡线控制器初始化成功");
     
     // 初始化历史记录数组
@@ -301,7 +302,7 @@ void setup() {
     while(Serial.available()) {
         Serial.read();
     }
-    receivedCommand = ""; // 确保命令缓冲为空
+    receivedCommand.clear(); // 确保命令缓冲为空
 }
 
 void loop() {
@@ -309,25 +310,35 @@ void loop() {
     sensorManager.updateAll();
     
     // 处理串口命令
-    if (Serial.available() > 0) {
-        String command = Serial.readStringUntil('\n');
-        command.trim();  // 移除首尾空格、回车和换行
+    bool lineReady = false;
+    while (Serial.available() > 0 && !lineReady) {
+        char c = Serial.read();
+        if (c == '\n') {
+            lineReady = true;
+        } else {
+            receivedCommand.append(c);
+        }
+    }
+    if (lineReady) {
+        FixedString<64> command = receivedCommand;
+        receivedCommand.clear();
+        command.trim();  // 移除首尾空格和回车
         
         // 调试输出
         Serial.print("收到命令: [");
-        Serial.print(command);
+        Serial.print(command.c_str());
         Serial.println("]");
         
         // 处理单字符命令
         if (command.length() == 1) {
-            char cmd = command.charAt(0);
+            char cmd = command.c_str()[0];
             switch (cmd) {
                 case 's':
                 case 'S':
                     testRunning = true;
                     junctionCounter = 0;
                     junctionHistoryIndex = 0;
-                    lineFollower->reset();
+                    lineFollower.reset();
                     Serial.println("启动巡线测试...");
                     delay(3000);
                     break;
@@ -344,7 +355,7 @@ void loop() {
                     junctionCounter = 0;
                     junctionHistoryIndex = 0;
                     lastJunctionType = NO_JUNCTION;
-                    lineFollower->reset();
+                    lineFollower.reset();
                     Serial.println("重置状态完成");
                     break;
                     
@@ -364,7 +375,7 @@ void loop() {
                 testRunning = true;
                 junctionCounter = 0;
                 junctionHistoryIndex = 0;
-                lineFollower->reset();
+                lineFollower.reset();
                 Serial.println("启动巡线测试...");
                 delay(3000);
             }
@@ -374,9 +385,9 @@ void loop() {
                 Serial.println("停止巡线测试");
             }
             else if (command.startsWith("speed")) {
-                int value = command.substring(5).toInt();
+                int value = atoi(command.c_str() + 5);
                 if (value > 0) {
-                    lineFollower->setBaseSpeed(value);
+                    lineFollower.setBaseSpeed(value);
                     Serial.print("设置速度 = ");
                     Serial.println(value);
                 }
@@ -418,7 +429,7 @@ void loop() {
         // 根据模式执行巡线
         if (autoMode) {
             // 自动模式下执行巡线
-            lineFollower->update();
+            lineFollower.update();
             
             // 每100ms更新一次状态信息
             if (currentTime - lastUpdateTime > 100) {
@@ -7,11 +7,12 @@
 #include "../Control/LineFollower.h"
 #include "../Utils/Config.h"
 #include "../Utils/Logger.h"
+#include "../Utils/FixedString.h"
 
 // 创建运动控制器和传感器管理器实例
 MotionController motionController;
 SensorManager sensorManager;
-LineFollower* lineFollower; // 使用指针，因为需要在setup中初始化
+LineFollower lineFollower(sensorManager);
 
 // 测试配置
 bool testRunning = true;
@@ -19,7 +20,7 @@ unsigned long lastUpdateTime = 0;
 bool autoMode = true;
 
 // 串口命令处理
-String receivedCommand = "";
+FixedString<64> receivedCommand;
 bool newCommandReceived = false;
 
 // 显示传感器状态
@@ -52,18 +53,19 @@ void displaySensorStatus() {
   unsigned long lineLastDetectedTime = 0; // 这只是为了显示，实际值在LineFollower类内部
   if (lineLastDetectedTime > 0) {
     unsigned long lostTime = millis() - lineLastDetectedTime;
-    Logger::info("丢线时间: %lu/%lu ms", lostTime, lineFollower->getMaxLineLostTime());
+    Logger::info("丢线时间: %lu/%lu ms", lostTime, lineFollower.getMaxLineLostTime());
   }
 }
 
 // 处理串口命令
-void processCommand(String command) {
+void processCommand(const char* input) {
+  FixedString<64> command(input);
   command.trim();
   
   if (command == "start" || command == "s") {
     testRunning = true;
     autoMode = true;
-    lineFollower->reset(); // 重置巡线状态
+    lineFollower.reset(); // 重置巡线状态
     Serial.println("巡线测试已启动(自动模式)");
   }
   else if (command == "stop" || command == "x") {
@@ -72,34 +74,34 @@ void processCommand(String command) {
     Serial.println("巡线测试已停止");
   }
   else if (command.startsWith("kp")) {
-    float value = command.substring(3).toFloat();
+    float value = atof(command.c_str() + 3);
     if (value >= 0) {
-      lineFollower->setPIDParams(value, lineFollower->getKi(), lineFollower->getKd());
+      lineFollower.setPIDParams(value, lineFollower.getKi(), lineFollower.getKd());
       Serial.print("设置Kp = ");
       Serial.println(value);
     }
   }
   else if (command.startsWith("ki")) {
-    float value = command.substring(3).toFloat();
+    float value = atof(command.c_str() + 3);
     if (value >= 0) {
-      lineFollower->setPIDParams(lineFollower->getKp(), value, lineFollower->getKd());
+      lineFollower.setPIDParams(lineFollower.getKp(), value, lineFollower.getKd());
       Serial.print("设置Ki = ");
       Serial.println(value);
     }
   }
   else if (command.startsWith("kd")) {
-    float value = command.substring(3).toFloat();
+    float value = atof(command.c_str() + 3);
     if (value >= 0) {
-      lineFollower->setPIDParams(lineFollower->getKp(), lineFollower->getKi(), value);
+      lineFollower.setPIDParams(lineFollower.getKp(), lineFollower.getKi(), value);
       Serial.print("设置Kd = ");
       Serial.println(value);
     }
   }
   else if (command.startsWith("lost")) {
     // 设置最长允许丢线时间
-    int value = command.substring(5).toInt();
+    int value = atoi(command.c_str() + 5);
     if (value >= 0) {
-      lineFollower->setLineLostParams(value);
+      lineFollower.setLineLostParams(value);
       Serial.print("设置最长允许丢线时间 = ");
       Serial.print(value);
       Serial.println("ms");
@@ -108,13 +110,13 @@ void processCommand(String command) {
   else if (command == "status") {
     displaySensorStatus();
     Serial.print("当前PID参数: Kp=");
-    Serial.print(lineFollower->getKp());
+    Serial.print(lineFollower.getKp());
     Serial.print(" Ki=");
-    Serial.print(lineFollower->getKi());
+    Serial.print(lineFollower.getKi());
     Serial.print(" Kd=");
-    Serial.println(lineFollower->getKd());
+    Serial.println(lineFollower.getKd());
     Serial.print("最长允许丢线时间: ");
-    Serial.print(lineFollower->getMaxLineLostTime());
+    Serial.print(lineFollower.getMaxLineLostTime());
     Serial.println("ms");
   }
   else if (command == "manual" || command == "m") {
@@ -129,10 +131,10 @@ void processCommand(String command) {
   }
   else if (command == "reset") {
     // 重置PID参数到默认值
-    lineFollower->setPIDParams(1.0, 0.0, 1.0);
-    lineFollower->setLineLostParams(2000);
-    lineFollower->setBaseSpeed(FOLLOW_SPEED);
-    lineFollower->reset();
+    lineFollower.setPIDParams(1.0, 0.0, 1.0);
+    lineFollower.setLineLostParams(2000);
+    lineFollower.setBaseSpeed(FOLLOW_SPEED);
+    lineFollower.reset();
     Serial.println("已重置所有参数到默认值");
   }
   else if (command == "help") {
@@ -247,9 +249,9 @@ void processCommand(String command) {
   }
   else if (command.startsWith("speed")) {
     // 设置基础速度
-    int value = command.substring(6).toInt();
+    int value = atoi(command.c_str() + 6);
     if (value > 0 && value <= 255) {
-      lineFollower->setBaseSpeed(value);
+      lineFollower.setBaseSpeed(value);
       Serial.print("设置基础速度 = ");
       Serial.println(value);
     }
@@ -289,8 +291,7 @@ void setup() {
   
   // 创建并初始化巡线控制器
   // 假设LineFollower已被修改为接受SensorManager而不是InfraredArray
-  lineFollower = new LineFollower(sensorManager);
-  lineFollower->init();
+  lineFollower.init();
   Logger::info("巡线控制器初始化成功");
   
   // 等待传感器稳定
@@ -311,14 +312,14 @@ void loop() {
         newCommandReceived = true;
       }
     } else {
-      receivedCommand += c;
+      receivedCommand.append(c);
     }
   }
   
   // 处理新命令
   if (newCommandReceived) {
-    processCommand(receivedCommand);
-    receivedCommand = "";
+    processCommand(receivedCommand.c_str());
+    receivedCommand.clear();
     newCommandReceived = false;
   }
   
@@ -329,7 +330,7 @@ void loop() {
     // 自动模式下执行巡线
     if (autoMode) {
       // 使用LineFollower类的update方法
-      lineFollower->update();
+      lineFollower.update();
       
       // 每100毫秒更新一次状态
       if (currentTime - lastUpdateTime > 100) {
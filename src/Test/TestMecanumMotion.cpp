@@ -329,7 +329,9 @@ void runLeftTurn90Test() {
     case INIT:
       // 初始化校准测试
       Serial.println("左转90度校准测试");
-      Serial.println("当前设定时间: " + String(LEFT_TURN_90_TIME) + " ms");
+      Serial.print("当前设定时间: ");
+      Serial.print(LEFT_TURN_90_TIME);
+      Serial.println(" ms");
       Serial.println("放置小车，并按下回车键开始测试...");
       
       // 进入等待状态
@@ -380,19 +382,25 @@ void runLeftTurn90Test() {
           case '+':
             // 增加时间
             LEFT_TURN_90_TIME += 50;
-            Serial.println("调整为: " + String(LEFT_TURN_90_TIME) + " ms");
+            Serial.print("调整为: ");
+            Serial.print(LEFT_TURN_90_TIME);
+            Serial.println(" ms");
             break;
             
           case '-':
             // 减少时间
             LEFT_TURN_90_TIME = max(50UL, LEFT_TURN_90_TIME - 50);
-            Serial.println("调整为: " + String(LEFT_TURN_90_TIME) + " ms");
+            Serial.print("调整为: ");
+            Serial.print(LEFT_TURN_90_TIME);
+            Serial.println(" ms");
             break;
             
           case 's':
             // 保存当前值
             // TODO: 如果需要持久化存储，可以使用EEPROM保存
-            Serial.println("左转90度时间参数已保存: " + String(LEFT_TURN_90_TIME) + " ms");
+            Serial.print("左转90度时间参数已保存: ");
+            Serial.print(LEFT_TURN_90_TIME);
+            Serial.println(" ms");
             Serial.println("建议将此值更新到代码中的LEFT_TURN_90_TIME常量中");
             break;
             
@@ -422,7 +430,9 @@ void runRightTurn90Test() {
     case INIT:
       // 初始化校准测试
       Serial.println("右转90度校准测试");
-      Serial.println("当前设定时间: " + String(RIGHT_TURN_90_TIME) + " ms");
+      Serial.print("当前设定时间: ");
+      Serial.print(RIGHT_TURN_90_TIME);
+      Serial.println(" ms");
       Serial.println("放置小车，并按下回车键开始测试...");
       
       // 进入等待状态
@@ -474,19 +484,25 @@ void runRightTurn90Test() {
           case '+':
             // 增加时间
             RIGHT_TURN_90_TIME += 50;
-            Serial.println("调整为: " + String(RIGHT_TURN_90_TIME) + " ms");
+            Serial.print("调整为: ");
+            Serial.print(RIGHT_TURN_90_TIME);
+            Serial.println(" ms");
             break;
             
           case '-':
             // 减少时间
             RIGHT_TURN_90_TIME = max(50UL, RIGHT_TURN_90_TIME - 50);
-            Serial.println("调整为: " + String(RIGHT_TURN_90_TIME) + " ms");
+            Serial.print("调整为: ");
+            Serial.print(RIGHT_TURN_90_TIME);
+            Serial.println(" ms");
             break;
             
           case 's':
             // 保存当前值
             // TODO: 如果需要持久化存储，可以使用EEPROM保存
-            Serial.println("右转90度时间参数已保存: " + String(RIGHT_TURN_90_TIME) + " ms");
+            Serial.print("右转90度时间参数已保存: ");
+            Serial.print(RIGHT_TURN_90_TIME);
+            Serial.println(" ms");
             Serial.println("建议将此值更新到代码中的RIGHT_TURN_90_TIME常量中");
             break;
             
@@ -516,7 +532,9 @@ void runUTurn180Test() {
     case INIT:
       // 初始化校准测试
       Serial.println("原地掉头180度校准测试");
-      Serial.println("当前设定时间: " + String(U_TURN_180_TIME) + " ms");
+      Serial.print("当前设定时间: ");
+      Serial.print(U_TURN_180_TIME);
+      Serial.println(" ms");
       Serial.println("放置小车，并按下回车键开始测试...");
       
       // 进入等待状态
@@ -564,19 +582,25 @@ void runUTurn180Test() {
           case '+':
             // 增加时间
             U_TURN_180_TIME += 50;
-            Serial.println("调整为: " + String(U_TURN_180_TIME) + " ms");
+            Serial.print("调整为: ");
+            Serial.print(U_TURN_180_TIME);
+            Serial.println(" ms");
             break;
             
           case '-':
             // 减少时间
             U_TURN_180_TIME = max(50UL, U_TURN_180_TIME - 50);
-            Serial.println("调整为: " + String(U_TURN_180_TIME) + " ms");
+            Serial.print("调整为: ");
+            Serial.print(U_TURN_180_TIME);
+            Serial.println(" ms");
             break;
             
           case 's':
             // 保存当前值
             // TODO: 如果需要持久化存储，可以使用EEPROM保存
-            Serial.println("原地掉头180度时间参数已保存: " + String(U_TURN_180_TIME) + " ms");
+            Serial.print("原地掉头180度时间参数已保存: ");
+            Serial.print(U_TURN_180_TIME);
+            Serial.println(" ms");
             Serial.println("建议将此值更新到代码中的U_TURN_180_TIME常量中");
             break;
             
@@ -5,6 +5,7 @@
 #include "../Control/ObstacleAvoidance.h"
 #include "../Utils/Logger.h"
 #include "../Utils/Config.h"
+#include "../Utils/FixedString.h"
 
 // 注意: 只有当定义了TEST_OBSTACLE_AVOIDANCE时，才会编译此文件
 #ifdef TEST_OBSTACLE_AVOIDANCE
@@ -21,6 +22,7 @@ bool g_isRunning = false;
 float g_lineSpeed = FOLLOW_SPEED;  // 使用Config.h中定义的巡线速度
 float g_obstacleThreshold = 20.0f;
 unsigned long g_lastStatusTime = 0;
+FixedString<32> g_commandBuffer;  // 串口命令逐字节接收，不阻塞主循环
 const int STATUS_INTERVAL_MS = 1000;
 
 // 函数声明
@@ -114,8 +116,14 @@ void loop() {
 
 // 处理串口命令
 void processSerialCommands() {
-    if (Serial.available()) {
-        String command = Serial.readStringUntil('\n');
+    while (Serial.available()) {
+        char c = Serial.read();
+        if (c != '\n') {
+            g_commandBuffer.append(c);
+            continue;
+        }
+        FixedString<32> command = g_commandBuffer;
+        g_commandBuffer.clear();
         command.trim();
         
         if (command.equalsIgnoreCase("start") || command == "s") {
@@ -137,8 +145,7 @@ void processSerialCommands() {
             Serial.println("测试已停止");
         }
         else if (command.startsWith("speed=")) {
-            String speedStr = command.substring(6);
-            int speed = speedStr.toInt();
+            int speed = atoi(command.c_str() + 6);
             if (speed >= 0 && speed <= 255) {
                 g_lineSpeed = speed;
                 lineFollower.setBaseSpeed(speed);
@@ -149,7 +156,7 @@ void processSerialCommands() {
             }
         }
         else if (command.startsWith("kp=")) {
-            float value = command.substring(3).toFloat();
+            float value = atof(command.c_str() + 3);
             if (value >= 0) {
                 lineFollower.setPIDParams(value, lineFollower.getKi(), lineFollower.getKd());
                 Serial.print("PID参数Kp设置为: ");
@@ -157,7 +164,7 @@ void processSerialCommands() {
             }
         }
         else if (command.startsWith("kd=")) {
-            float value = command.substring(3).toFloat();
+            float value = atof(command.c_str() + 3);
             if (value >= 0) {
                 lineFollower.setPIDParams(lineFollower.getKp(), lineFollower.getKi(), value);
                 Serial.print("PID参数Kd设置为: ");
@@ -165,8 +172,7 @@ void processSerialCommands() {
             }
         }
         else if (command.startsWith("threshold=")) {
-            String thresholdStr = command.substring(10);
-            float threshold = thresholdStr.toFloat();
+            float threshold = atof(command.c_str() + 10);
             if (threshold > 0) {
                 g_obstacleThreshold = threshold;
                 obstacleAvoidance.setObstacleThreshold(threshold);
@@ -92,39 +92,17 @@ void loop() {
     // 执行机械臂操作
     Logger::info("Test", "1. 执行抓取操作");
     
-    // 1.1 移动到抓取位置并打开夹爪
-    Logger::info("Test", "移动到抓取位置并打开夹爪");
-    roboticArm.adjustArm(2150, 450, -50);
+    // 1.1 抓取并放入物料盒（GRAB + STOW脚本）
+    Logger::info("Test", "播放GRAB脚本");
+    roboticArm.runScript(ARM_SCRIPT_GRAB);
     delay(2000);
-    
-    // 1.2 闭合夹爪抓取物体
-    Logger::info("Test", "闭合夹爪抓取物体");
-    roboticArm.adjustArm(2150, 450, 900);
-    delay(2000);
-    
-    // 1.3 抬起物体
-    Logger::info("Test", "抬起物体");
-    roboticArm.adjustArm(1500, 1600, 900);
-    delay(2000);
-    
-    // 1.4 微微松开夹爪
-    Logger::info("Test", "微微松开夹爪");
-    roboticArm.adjustArm(1500, 1600, 0);
-    delay(3000); // 等待3秒
-    
-    // 1.5 重新夹紧
-    Logger::info("Test", "重新夹紧");
-    roboticArm.adjustArm(1500, 1600, 900);
-    delay(2000);
-    
-    // 1.6 放下物体
-    Logger::info("Test", "放下物体");
-    roboticArm.adjustArm(2150, 450, 900);
+    Logger::info("Test", "播放STOW脚本");
+    roboticArm.runScript(ARM_SCRIPT_STOW);
     delay(2000);
     
-    // 1.7 完全松开夹爪
-    Logger::info("Test", "完全松开夹爪");
-    roboticArm.adjustArm(2150, 450, -50);
+    // 1.2 从物料盒取出并放下（RELEASE脚本）
+    Logger::info("Test", "播放RELEASE脚本");
+    roboticArm.runScript(ARM_SCRIPT_RELEASE);
     delay(2000);
     
     Logger::info("Test", "抓取操作完成");
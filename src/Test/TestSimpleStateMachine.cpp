@@ -19,6 +19,7 @@
 #include "../Control/SimpleStateMachine.h"      
 #include "../Utils/Logger.h"           
 #include "../Utils/Config.h"           
+#include "../Utils/SerialCommandParser.h"
 
 // --- 全局对象 ---
 SensorManager sensorManager;
@@ -27,6 +28,7 @@ RoboticArm roboticArm;
 LineFollower lineFollower(sensorManager); 
 NavigationController navigationController(sensorManager, motionController, lineFollower);
 SimpleStateMachine stateMachine(sensorManager, motionController, roboticArm, navigationController);
+SerialCommandParser usbCommandParser(Serial); // USB串口命令解析（Serial2由状态机自行处理）
 
 // --- 主程序配置 ---
 const int LOOP_DELAY_MS = 50; // 主循环延迟（毫秒）
@@ -75,32 +77,8 @@ void setup() {
   
   systemInitialized = true;
   
-  Serial.println("系统就绪，按回车键启动任务，输入'q'停止");
-  Logger::info("SYSTEM", "系统就绪，按回车键启动任务，输入'q'停止");
-}
-
-// --- 处理串口命令通用函数 ---
-void processCommand(String command) {
-  command.trim();
-  
-  if (command == " " || command == "\r" || command == "s") {
-    // 用户按下回车，启动任务
-    stateMachine.handleCommand("START");
-    Serial.println("任务已启动");
-    Logger::info("CMD", "任务已启动");
-  }
-  else if (command == "stop" || command == "q" || command == "Q") {
-    motionController.emergencyStop();
-    navigationController.stop();
-    Serial.println("系统已停止");
-    Logger::info("CMD", "系统已停止");
-  }
-  else if (command == "reset" || command == "r") {
-    stateMachine.handleCommand("RESET");
-    navigationController.init();
-    Serial.println("系统已重置");
-    Logger::info("CMD", "系统已重置");
-  }
+  Serial.println("系统就绪，输入's'启动任务，输入'q'停止");
+  Logger::info("SYSTEM", "系统就绪，输入's'启动任务，输入'q'停止");
 }
 
 // --- 主循环函数 ---
@@ -115,23 +93,12 @@ void loop() {
   // 2. 更新状态机
   stateMachine.update();
   
-  // 3. 处理USB串口命令
-  if (Serial.available() > 0) {
-    String command = Serial.readStringUntil('\n');
-    processCommand(command);
+  // 3. 处理USB串口命令（s/q/r 或 START/STOP/RESET，以及 ARM ... 调试命令）
+  if (usbCommandParser.poll() == SERIAL_EVENT_COMMAND) {
+    stateMachine.handleCommand(usbCommandParser.getCommand());
   }
   
-  // 4. 处理ESP32串口命令 (条件编译，只在ENABLE_ESP启用时)
-#if ENABLE_ESP
-  if (Serial2.available() > 0) {
-    String espCommand = Serial2.readStringUntil('\n');
-    // 记录收到的ESP命令
-    Serial.print("ESP命令: ");
-    Serial.println(espCommand);
-    // 处理命令
-    processCommand(espCommand);
-  }
-#endif
+  // 4. ESP32串口(Serial2)的命令和颜色代码已在stateMachine.update()中处理
   
   // 5. 循环延迟
   delay(LOOP_DELAY_MS);
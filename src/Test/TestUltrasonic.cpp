@@ -50,19 +50,29 @@ void loop() {
   if (success) {
     char distStr[10];
     dtostrf(distance, 6, 2, distStr);
-    Logger::info("距离: %.s cm", distStr);
+    Logger::info("Test", "距离: %s cm", distStr);
     
     // 检测是否有障碍物
     bool obstacle = (distance <= NO_OBJECT_THRESHOLD);
-    Logger::info("障碍物检测: %s", obstacle ? "有障碍物" : "无障碍物");
+    Logger::info("Test", "障碍物检测: %s", obstacle ? "有障碍物" : "无障碍物");
     
     // 检测是否达到抓取距离
     bool canGrab = (distance <= GRAB_DISTANCE);
-    Logger::info("抓取距离: %s", canGrab ? "可以抓取" : "距离太远");
+    Logger::info("Test", "抓取距离: %s", canGrab ? "可以抓取" : "距离太远");
   } else {
     Logger::warning("无法测量有效距离");
   }
-  
-  delay(500); // 每500ms更新一次
+
+  // 打印滤波结果（本次读数已输入滤波器）
+  float filtered, variance;
+  if (ultrasonicSensor.getFilteredDistance(filtered, variance)) {
+    char filteredStr[10];
+    char varianceStr[10];
+    dtostrf(filtered, 6, 2, filteredStr);
+    dtostrf(variance, 6, 3, varianceStr);
+    Logger::info("Test", "滤波距离: %s cm, 方差: %s", filteredStr, varianceStr);
+  }
+
+  delay(200); // 每200ms更新一次，需短于DISTANCE_FILTER_STALE_MS，否则滤波估计会过期
 } 
 #endif
\ No newline at end of file
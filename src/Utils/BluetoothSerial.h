@@ -3,8 +3,10 @@
 
 #include <Arduino.h>
 #include <SoftwareSerial.h>
+#include <new.h>
 #include "Config.h"
 #include "Logger.h"
+#include "FixedString.h"
 
 // 消息类型定义
 enum BtMessageType {
@@ -19,10 +21,14 @@ private:
     SoftwareSerial* btSerial;
     bool initialized;
     
+    // SoftwareSerial对象的静态存储，begin()中用placement new构造，避免堆分配
+    alignas(SoftwareSerial) uint8_t serialStorage[sizeof(SoftwareSerial)];
+    
     // 命令解析缓冲区
     static const int BT_BUFFER_SIZE = 128;
     char buffer[BT_BUFFER_SIZE];
     int bufferIndex;
+    bool discarding;    // 当前行超出缓冲区，丢弃到行尾
     
     // 蓝牙消息前缀
     static const char* MSG_PREFIX_COMMAND;
@@ -31,7 +37,7 @@ private:
     static const char* MSG_PREFIX_RESPONSE;
     
 public:
-    BluetoothSerial() : initialized(false), bufferIndex(0) {
+    BluetoothSerial() : btSerial(nullptr), initialized(false), bufferIndex(0), discarding(false) {
         memset(buffer, 0, BT_BUFFER_SIZE);
     }
     
@@ -41,7 +47,10 @@ public:
             return false;
         }
         
-        btSerial = new SoftwareSerial(rxPin, txPin);
+        // 只构造一次，重复调用begin()时复用已有对象
+        if (!btSerial) {
+            btSerial = new (serialStorage) SoftwareSerial(rxPin, txPin);
+        }
         btSerial->begin(baudRate);
         
         // 简单测试蓝牙是否就绪
@@ -113,11 +122,15 @@ public:
         return btSerial->print(tempBuffer);
     }
     
-    // 读取一行数据（直到换行符）
-    String readLine() {
-        if (!ENABLE_BLUETOOTH || !btSerial) return "";
-        
-        return btSerial->readStringUntil('\n');
+    // 读取一行数据（不等待）：每次主循环调用，只处理已到达的字节，
+    // 收到完整的一行时复制到line并返回true，超出line容量的部分被截断
+    template <size_t N>
+    bool readLine(FixedString<N>& line) {
+        if (!processReceivedData()) {
+            return false;
+        }
+        line = buffer;
+        return true;
     }
     
     // 发送命令响应
@@ -175,25 +188,34 @@ public:
         btSerial->println(message);
     }
     
-    // 处理接收到的数据
+    // 处理接收到的数据：读取已到达的字节，收到完整的一行时返回true（内容见getLastCommand()）
+    // 未完成的行保留到下次调用；超过缓冲区长度的行整行丢弃
     bool processReceivedData() {
-        if (!ENABLE_BLUETOOTH || !btSerial || !btSerial->available()) {
+        if (!ENABLE_BLUETOOTH || !btSerial) {
             return false;
         }
         
-        // 读取数据到缓冲区
-        while (btSerial->available() && bufferIndex < BT_BUFFER_SIZE - 1) {
+        while (btSerial->available()) {
             char c = btSerial->read();
             
             // 检测到行结束
             if (c == '\n' || c == '\r') {
-                if (bufferIndex > 0) {
+                bool complete = !discarding && bufferIndex > 0;
+                discarding = false;
+                if (complete) {
                     buffer[bufferIndex] = '\0';
                     bufferIndex = 0;
                     return true;
                 }
-            } else {
+                bufferIndex = 0;
+            } else if (discarding) {
+                continue;
+            } else if (bufferIndex < BT_BUFFER_SIZE - 1) {
                 buffer[bufferIndex++] = c;
+            } else {
+                Logger::warning("BT", "命令过长，已丢弃");
+                discarding = true;
+                bufferIndex = 0;
             }
         }
         
@@ -213,6 +235,7 @@ public:
             btSerial->read();
         }
         bufferIndex = 0;
+        discarding = false;
     }
     
     // 解析蓝牙消息类型
@@ -49,6 +49,16 @@
 // #define COLOR_SENSOR_ADDR    0x29  // 旧的TCS34725颜色传感器地址
 #define GANWEI_COLOR_SENSOR_ADDR 0x4c  // 感为颜色传感器地址 (7位地址，假设所有跳线都设置为1)
 
+// I2C总线（I2CBus）
+#define I2C_CLOCK_HZ          400000UL // 快速模式；线缆较长出现错误时改回100000
+#define I2C_TIMEOUT_US        3000  // 单次传输的硬件超时(us)，超时后复位TWI并恢复总线
+#define I2C_SDA_PIN           20    // Mega2560
+#define I2C_SCL_PIN           21
+#define I2C_MAX_DEVICES       4     // 统计的设备数
+#define I2C_QUEUE_SIZE        4     // 排队请求数
+#define I2C_POLL_MAX_REQUESTS 1     // 每次poll()最多执行的请求数
+#define I2C_HEALTH_MAX_ERRORS 3     // 连续失败达到此次数时健康检查报告通信错误
+
 // 运动参数
 #define MAX_SPEED            255
 #define TURN_SPEED           100
@@ -58,6 +68,7 @@
 
 // 阈值参数
 #define NO_OBJECT_THRESHOLD  50   // 超声波检测无障碍物阈值(cm)
+#define COLOR_WAIT_TIMEOUT   20000 // 抓取后等待颜色代码的超时时间(ms)
 #define GRAB_DISTANCE        10   // 抓取距离(cm)
 #define LINE_THRESHOLD       500  // 红外线检测阈值
 
@@ -68,6 +79,67 @@
 #define GRIPPER_CLOSE_ANGLE  90
 #define SERVO_DELAY          15   // 舵机移动延迟(ms)
 
+// 机械臂轨迹参数（速度单位：微秒/秒，加速度单位：微秒/秒²）
+#define ARM_BASE_MAX_VELOCITY    1200
+#define ARM_BASE_MAX_ACCEL       3000
+#define ARM_ARM_MAX_VELOCITY     1200
+#define ARM_ARM_MAX_ACCEL        3000
+#define ARM_CLAW_MAX_VELOCITY    2000
+#define ARM_CLAW_MAX_ACCEL       8000
+#define ARM_SETTLE_TIME          80   // 轨迹结束后等待舵机到位的时间(ms)
+#define ARM_SERVO_MIN_US         544  // 舵机脉宽下限(微秒)，与Servo库attach()默认值一致
+#define ARM_SERVO_MAX_US         2400 // 舵机脉宽上限(微秒)，与Servo库attach()默认值一致
+
+// 抓取距离窗口与流水线抓取参数（距离单位：cm）
+#define ARM_GRAB_MIN_DISTANCE          12.5f // 抓取窗口下限
+#define ARM_GRAB_MAX_DISTANCE          13.5f // 抓取窗口上限
+#define ARM_PIPELINED_GRAB             1     // 1: 接近物块时提前将机械臂放到预抓取姿态
+#define ARM_PREGRASP_TRIGGER_DISTANCE  25.0f // 距离小于此值时开始预抓取
+#define ARM_PREGRASP_SAFE_DISTANCE     15.0f // 预抓取未到位时小车必须停在此距离之外
+
+// 超声波距离滤波（标量卡尔曼，距离单位：cm）
+#define DISTANCE_FILTER_MEAS_VAR     1.0f  // 单次测量噪声方差(cm²)
+#define DISTANCE_FILTER_PROCESS_VAR  0.02f // 每毫秒距离变化的方差(cm²/ms)
+#define DISTANCE_FILTER_GATE         3.0f  // 新息超过该倍数标准差视为野值
+#define DISTANCE_FILTER_MAX_REJECTS  3     // 连续野值次数达到此值时认为目标变化，以新读数重新初始化
+#define DISTANCE_FILTER_MIN_CM       2.0f  // 有效读数下限，更近的读数视为无效
+#define DISTANCE_FILTER_STALE_MS     500   // 超过此时间没有新读数时估计失效
+#define DISTANCE_FILTER_PING_MS      30    // getStableDistanceCm() 两次测量的最小间隔
+
+// 颜色识别
+#define COLOR_USE_CLASSIFIER       1    // 1: 使用校准查找表（ColorLut.h，由tools/color_lut.py生成），0: 使用固定HSL阈值
+#define COLOR_MIN_CONFIDENCE       50   // getColor() 置信度低于此值(0-100)时返回COLOR_UNKNOWN
+#define COLOR_CLASSIFIER_CORE      3.0f // 距中心超过此倍数标准差后置信度开始降低（与tools/color_lut.py --core一致）
+#define COLOR_CLASSIFIER_GATE      5.0f // 距所有中心超过此倍数标准差时为未知（与tools/color_lut.py --gate一致）
+
+// 颜色校准（EEPROM）
+#define COLOR_CAL_EEPROM_ADDR      64   // 校准记录起始地址
+#define COLOR_CAL_VERSION          1    // 记录格式版本，ColorCalibrationData结构变化时加1
+#define COLOR_CAL_SAMPLES          20   // CAL <颜色> 命令的采样次数
+#define COLOR_CAL_SAMPLE_DELAY_MS  10   // 采样间隔(ms)
+
+// 颜色后台采样（SensorManager::updateColor）
+#define COLOR_SAMPLE_INTERVAL_MS   30   // 采样间隔(ms)
+#define COLOR_SAMPLE_RETRY_MS      500  // I2C读取失败后的重试间隔(ms)
+#define COLOR_SAMPLE_RING_SIZE     8    // 保留的最近读数个数
+#define COLOR_SAMPLE_STALE_MS      200  // 最新读数超过此时间视为过期
+
+// 抓取后物块颜色识别
+#define COLOR_ID_ONBOARD           1    // 1: 抓取后用颜色传感器识别，失败时再等待ESP32手动输入；0: 只等待手动输入
+#define COLOR_ID_STABLE_SAMPLES    5    // 连续读到同一颜色的次数，达到即确认
+#define COLOR_ID_MAX_SAMPLES       30   // 超过此采样次数仍未确认则放弃
+#define COLOR_ID_TIMEOUT_MS        2000 // 从开始识别算起的最长时间(ms)，收不到读数（传感器或I2C故障）时放弃
+
+// 路线规划
+#define USE_COURSE_PLANNER   1    // 1: 放置与返回基地按赛道图规划的路线行驶，0: 仅使用路口计数
+#define USE_ROUTE_REPLAY     1    // 1: 记录搜索路径，抓取后沿原路逆向回放
+#define ROUTE_RECORD_CAPACITY 32  // 路径记录环形缓冲区大小（2的幂，实际可存31个路口）
+
+// 任务调度
+#define MISSION_BLOCK_COUNT     2    // 默认需要搬运的物块数（可用MISSION BLOCKS命令修改）
+#define MISSION_MAX_PICKUPS     8    // 支持的最大取物区数量
+#define MISSION_UNKNOWN_PENALTY 60   // 未确认有物块的取物区额外代价(cm)，优先去已知有物块的区域
+
 // 路口类型
 enum JunctionType {
     NO_JUNCTION,
@@ -108,7 +180,8 @@ enum SystemState {
     BASE_ARRIVE,        // 到达基地
     END,                // 结束
     ERROR_STATE,        // 错误状态
-    CONTINUE_SEARCH     // 继续搜索状态
+    CONTINUE_SEARCH,    // 继续搜索状态
+    SYSTEM_STATE_COUNT  // 状态总数
 };
 
 // OBJECT_LOCATE子状态
@@ -129,6 +202,27 @@ enum LocateSubState {
 // Navigation Controller Stop-and-Check Parameters
 #define NAV_CHECK_FORWARD_DURATION 220  // 短距前进的持续时间 (ms)
 #define NAV_CHECK_FORWARD_SPEED    80   // 短距前进的速度 (0-255)
-#define NAV_CHECK_STABILIZE_DELAY  50   // 停车后等待稳定的时间 (ms)
+#define NAV_CHECK_STABILIZE_DELAY  50   // 停车后最长采样时间 (ms)，期间多帧投票
+#define NAV_CHECK_MIN_SETTLE       10   // 停车后等待车身稳定的时间 (ms)，之前的帧不参与投票
+#define NAV_CHECK_AGREE_FRAMES     3    // 连续多少帧完全一致即提前结束采样
+#define NAV_CHECK_MIN_CONFIDENCE   0.75f // 提前结束所需的最低投票置信度（各位多数比例的最小值）
+
+// 行进中路口分类（短距前进期间累积红外帧，置信度足够时不停车检测）
+#define NAV_ROLLING_CLASSIFY       1     // 1: 启用行进中分类，0: 始终停车检测
+#define NAV_ROLLING_MIN_FRAMES     5     // 至少需要的帧数
+#define NAV_ROLLING_ARM_FRAMES     2     // 侧向分支至少连续出现的帧数
+#define NAV_ROLLING_TAIL_FRAMES    3     // 越过横线后用于判断直行的帧数（不超过8）
+#define NAV_ROLLING_MIN_CONFIDENCE 0.75f // 低于此置信度时回退到停车检测
+
+// 传感器轨迹记录（二进制帧，主机端用tools/trace_capture.py采集，tools/replay离线回放）
+#ifndef ENABLE_TRACE
+#define ENABLE_TRACE         0       // 1: 每个导航周期输出一帧轨迹，0: 不编译记录代码
+#endif
+#define TRACE_SERIAL         Serial  // 轨迹输出串口，与日志共用时采集工具按同步字分离
+
+// 实时遥测（经Serial2发给ESP32，在网页 /telemetry 上显示）
+#define ENABLE_TELEMETRY      ENABLE_ESP // 1: 上电即输出，也可用 TEL ON/OFF 命令切换
+#define TELEMETRY_INTERVAL_MS 50         // 输出间隔，网页按浏览器刷新率拉取最新一帧
+#define TELEMETRY_LINE_MAX    63         // 单行最大长度，须小于AVR串口发送缓冲区(64字节)，否则整行永远放不下
 
 #endif // CONFIG_H 
\ No newline at end of file
@@ -0,0 +1,146 @@
+#ifndef FIXED_STRING_H
+#define FIXED_STRING_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * 固定容量字符串，用于替代Arduino String
+ * 
+ * 存储空间在对象内部（N个字符+结束符），不使用堆内存。
+ * 超出容量的内容会被截断，并通过truncated()报告。
+ * 只依赖C标准库，Mega与ESP32共用。
+ */
+template <size_t N>
+class FixedString {
+public:
+    FixedString() : m_length(0), m_truncated(false) {
+        m_data[0] = '\0';
+    }
+    
+    FixedString(const char* str) : m_length(0), m_truncated(false) {
+        m_data[0] = '\0';
+        append(str);
+    }
+    
+    FixedString& operator=(const char* str) {
+        clear();
+        append(str);
+        return *this;
+    }
+    
+    // 追加字符串，返回是否完整追加
+    bool append(const char* str) {
+        if (str == nullptr) {
+            return true;
+        }
+        return append(str, strlen(str));
+    }
+    
+    // 追加指定长度的字符（不要求以'\0'结尾）
+    bool append(const char* str, size_t len) {
+        size_t room = N - m_length;
+        bool fits = (len <= room);
+        if (!fits) {
+            len = room;
+            m_truncated = true;
+        }
+        memcpy(m_data + m_length, str, len);
+        m_length += len;
+        m_data[m_length] = '\0';
+        return fits;
+    }
+    
+    bool append(char c) {
+        if (m_length >= N) {
+            m_truncated = true;
+            return false;
+        }
+        m_data[m_length++] = c;
+        m_data[m_length] = '\0';
+        return true;
+    }
+    
+    // 格式化追加，返回是否完整追加
+    bool appendf(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        bool ok = vappendf(format, args);
+        va_end(args);
+        return ok;
+    }
+    
+    bool vappendf(const char* format, va_list args) {
+        size_t room = N - m_length;
+        int written = vsnprintf(m_data + m_length, room + 1, format, args);
+        if (written < 0) {
+            m_data[m_length] = '\0';
+            return false;
+        }
+        if ((size_t)written > room) {
+            m_length = N;
+            m_truncated = true;
+            return false;
+        }
+        m_length += written;
+        return true;
+    }
+    
+    FixedString& operator+=(const char* str) { append(str); return *this; }
+    FixedString& operator+=(char c) { append(c); return *this; }
+    
+    bool operator==(const char* str) const { return strcmp(m_data, str) == 0; }
+    bool operator!=(const char* str) const { return strcmp(m_data, str) != 0; }
+    
+    bool equalsIgnoreCase(const char* str) const { return strcasecmp(m_data, str) == 0; }
+    bool startsWith(const char* prefix) const { return strncmp(m_data, prefix, strlen(prefix)) == 0; }
+    
+    // 去掉首尾空白字符
+    void trim() {
+        size_t start = 0;
+        while (start < m_length && isspace((unsigned char)m_data[start])) {
+            start++;
+        }
+        size_t end = m_length;
+        while (end > start && isspace((unsigned char)m_data[end - 1])) {
+            end--;
+        }
+        m_length = end - start;
+        memmove(m_data, m_data + start, m_length);
+        m_data[m_length] = '\0';
+    }
+    
+    // 删除开头的count个字符
+    void removePrefix(size_t count) {
+        if (count > m_length) {
+            count = m_length;
+        }
+        m_length -= count;
+        memmove(m_data, m_data + count, m_length + 1);
+    }
+    
+    void clear() {
+        m_length = 0;
+        m_truncated = false;
+        m_data[0] = '\0';
+    }
+    
+    const char* c_str() const { return m_data; }
+    char* data() { return m_data; }
+    size_t length() const { return m_length; }
+    bool isEmpty() const { return m_length == 0; }
+    bool truncated() const { return m_truncated; }
+    
+    char operator[](size_t index) const { return index < m_length ? m_data[index] : '\0'; }
+    
+    static size_t capacity() { return N; }
+    
+private:
+    char m_data[N + 1];
+    size_t m_length;
+    bool m_truncated;
+};
+
+#endif // FIXED_STRING_H
@@ -0,0 +1,111 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * 固定容量环形缓冲区
+ * 
+ * N必须是2的幂。读写索引各自只由一方修改，因此单生产者/单消费者
+ * （例如中断或回调写入、主循环读取）时无需加锁；多生产者需自行加锁。
+ * 实际可存放N-1个元素。
+ */
+template <typename T, size_t N>
+class RingBuffer {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "RingBuffer容量必须是2的幂");
+    
+public:
+    RingBuffer() : m_head(0), m_tail(0), m_dropped(0) {}
+    
+    // 写入一个元素，满时返回false并计入丢弃数
+    bool push(const T& item) {
+        size_t head = m_head;
+        size_t next = (head + 1) & MASK;
+        if (next == m_tail) {
+            m_dropped++;
+            return false;
+        }
+        m_items[head] = item;
+        m_head = next;
+        return true;
+    }
+    
+    // 批量写入，返回实际写入的数量
+    size_t push(const T* items, size_t count) {
+        size_t written = 0;
+        while (written < count && push(items[written])) {
+            written++;
+        }
+        if (written < count) {
+            // 第一次失败已计数一次
+            m_dropped += count - written - 1;
+        }
+        return written;
+    }
+    
+    // 取出一个元素，空时返回false
+    bool pop(T& item) {
+        size_t tail = m_tail;
+        if (tail == m_head) {
+            return false;
+        }
+        item = m_items[tail];
+        m_tail = (tail + 1) & MASK;
+        return true;
+    }
+    
+    // 批量取出，返回实际取出的数量
+    size_t pop(T* items, size_t maxCount) {
+        size_t count = 0;
+        while (count < maxCount && pop(items[count])) {
+            count++;
+        }
+        return count;
+    }
+    
+    // 取出最新写入的元素（后进先出，仅在没有并发读写时调用）
+    bool popNewest(T& item) {
+        size_t head = m_head;
+        if (head == m_tail) {
+            return false;
+        }
+        head = (head - 1) & MASK;
+        item = m_items[head];
+        m_head = head;
+        return true;
+    }
+    
+    // 查看队首元素但不取出
+    bool peek(T& item) const {
+        size_t tail = m_tail;
+        if (tail == m_head) {
+            return false;
+        }
+        item = m_items[tail];
+        return true;
+    }
+    
+    size_t size() const { return (m_head - m_tail) & MASK; }
+    size_t available() const { return (N - 1) - size(); }
+    bool isEmpty() const { return m_head == m_tail; }
+    bool isFull() const { return ((m_head + 1) & MASK) == m_tail; }
+    
+    // 因已满被丢弃的元素数
+    uint32_t getDroppedCount() const { return m_dropped; }
+    
+    // 清空（仅在没有并发读写时调用）
+    void clear() { m_head = m_tail = 0; }
+    
+    static size_t capacity() { return N - 1; }
+    
+private:
+    static const size_t MASK = N - 1;
+    
+    T m_items[N];
+    volatile size_t m_head;     // 写索引，仅生产者修改
+    volatile size_t m_tail;     // 读索引，仅消费者修改
+    volatile uint32_t m_dropped;
+};
+
+#endif // RING_BUFFER_H
@@ -0,0 +1,175 @@
+#include "SerialCommandParser.h"
+#include "Logger.h"
+
+SerialCommandParser::SerialCommandParser(Stream& stream)
+    : m_stream(stream)
+    , m_length(0)
+    , m_discarding(false)
+    , m_color(COLOR_UNKNOWN)
+    , m_overflowCount(0)
+    , m_sequence(0)
+    , m_lineStartUs(0)
+    , m_dispatchUs(0)
+    , m_recentNext(0)
+    , m_duplicateCount(0) {
+    m_buffer[0] = '\0';
+    memset(m_recent, 0, sizeof(m_recent));
+}
+
+SerialEventType SerialCommandParser::poll() {
+    while (m_stream.available() > 0) {
+        char c = m_stream.read();
+        
+        if (c == '\n' || c == '\r') {
+            if (m_discarding) {
+                m_discarding = false;
+                m_length = 0;
+                continue;
+            }
+            if (m_length == 0) {
+                // 忽略空行及\r\n中的第二个结束符
+                continue;
+            }
+            
+            m_buffer[m_length] = '\0';
+            m_length = 0;
+            SerialEventType event = parseLine();
+            if (event != SERIAL_EVENT_NONE) {
+                // 剩余字节留到下次poll处理
+                m_dispatchUs = micros();
+                return event;
+            }
+            continue;
+        }
+        
+        if (m_discarding) {
+            continue;
+        }
+        
+        if (m_length >= MAX_LINE_LENGTH) {
+            m_discarding = true;
+            m_overflowCount++;
+            Logger::warning("SerialParser", "命令过长(>%d字节)，已丢弃", MAX_LINE_LENGTH);
+            continue;
+        }
+        
+        if (m_length == 0) {
+            m_lineStartUs = micros();
+        }
+        m_buffer[m_length++] = c;
+    }
+    
+    return SERIAL_EVENT_NONE;
+}
+
+SerialEventType SerialCommandParser::parseLine() {
+    // 去掉首尾空白
+    char* start = m_buffer;
+    while (*start == ' ' || *start == '\t') {
+        start++;
+    }
+    char* end = start + strlen(start);
+    while (end > start && (end[-1] == ' ' || end[-1] == '\t')) {
+        end--;
+    }
+    *end = '\0';
+    if (start != m_buffer) {
+        memmove(m_buffer, start, end - start + 1);
+    }
+    
+    if (m_buffer[0] == '\0') {
+        return SERIAL_EVENT_NONE;
+    }
+    
+    // 可靠命令：去掉序号，重复的命令只重发回复
+    m_sequence = 0;
+    if (m_buffer[0] == '#') {
+        if (!stripSequence()) {
+            Logger::warning("SerialParser", "命令序号格式错误: %s", m_buffer);
+            return SERIAL_EVENT_NONE;
+        }
+        if (replayIfDuplicate()) {
+            return SERIAL_EVENT_NONE;
+        }
+        if (m_buffer[0] == '\0') {
+            return SERIAL_EVENT_INVALID;
+        }
+    }
+    
+    // 纯数字行视为颜色代码
+    bool allDigits = true;
+    for (const char* p = m_buffer; *p; p++) {
+        if (!isdigit(*p)) {
+            allDigits = false;
+            break;
+        }
+    }
+    
+    if (!allDigits) {
+        return SERIAL_EVENT_COMMAND;
+    }
+    
+    int colorValue = atoi(m_buffer);
+    if (colorValue >= COLOR_WHITE && colorValue <= COLOR_YELLOW) {
+        m_color = static_cast<ColorCode>(colorValue);
+        Logger::info("SerialParser", "解析到有效颜色代码: %d", colorValue);
+        return SERIAL_EVENT_COLOR;
+    }
+    
+    Logger::warning("SerialParser", "收到无效或超出范围的颜色代码值: %s", m_buffer);
+    return m_sequence != 0 ? SERIAL_EVENT_INVALID : SERIAL_EVENT_NONE;
+}
+
+bool SerialCommandParser::stripSequence() {
+    char* endptr;
+    unsigned long sequence = strtoul(m_buffer + 1, &endptr, 10);
+    if (endptr == m_buffer + 1 || *endptr != ':' || sequence == 0 || sequence > 0xFFFF) {
+        return false;
+    }
+    m_sequence = (uint16_t)sequence;
+    memmove(m_buffer, endptr + 1, strlen(endptr + 1) + 1);
+    return true;
+}
+
+bool SerialCommandParser::replayIfDuplicate() {
+    for (uint8_t i = 0; i < RECENT_COUNT; i++) {
+        if (m_recent[i].sequence == m_sequence) {
+            m_duplicateCount++;
+            sendReply(m_sequence, m_recent[i].ok, m_recent[i].reason, false);
+            return true;
+        }
+    }
+    return false;
+}
+
+void SerialCommandParser::acknowledge(bool ok, const char* reason) {
+    if (m_sequence == 0) {
+        return;
+    }
+    RecentCommand& entry = m_recent[m_recentNext];
+    entry.sequence = m_sequence;
+    entry.ok = ok;
+    entry.reason = reason;
+    m_recentNext = (m_recentNext + 1) % RECENT_COUNT;
+    
+    sendReply(m_sequence, ok, reason, true);
+    // 每个事件只回复一次
+    m_sequence = 0;
+}
+
+void SerialCommandParser::sendReply(uint16_t sequence, bool ok, const char* reason, bool withTiming) {
+    unsigned long now = micros();
+    m_stream.print(ok ? "$ACK:" : "$NAK:");
+    m_stream.print(sequence);
+    if (ok && withTiming) {
+        // 接收耗时（读到行首到整行解析完）和执行耗时（解析完到回复）
+        m_stream.print(',');
+        m_stream.print(m_dispatchUs - m_lineStartUs);
+        m_stream.print(',');
+        m_stream.print(now - m_dispatchUs);
+    } else if (!ok && reason != nullptr) {
+        m_stream.print(',');
+        m_stream.print(reason);
+    }
+    m_stream.print('\n');
+}
@@ -0,0 +1,91 @@
+#ifndef SERIAL_COMMAND_PARSER_H
+#define SERIAL_COMMAND_PARSER_H
+
+#include <Arduino.h>
+#include "Config.h"
+
+// 解析结果事件类型
+enum SerialEventType {
+    SERIAL_EVENT_NONE,     // 尚未收到完整的一行
+    SERIAL_EVENT_COLOR,    // 纯数字行：颜色代码
+    SERIAL_EVENT_COMMAND,  // 其他行：文本命令
+    SERIAL_EVENT_INVALID   // 带序号但内容无效的行（如超出范围的颜色），需回复NAK
+};
+
+/**
+ * 增量式串口命令解析器
+ * 
+ * 每次poll()只读取串口中已到达的字节，不等待、不分配堆内存。
+ * 收到完整的一行（以\r或\n结尾）后返回一个事件：
+ * - 只包含数字的行解析为颜色代码（1-5有效）
+ * - 其余非空行作为命令文本，去掉首尾空白后交给上层处理
+ * 超过缓冲区长度的行会被整行丢弃。
+ * 
+ * 可靠命令：行首带序号 "#<序号>:<内容>"（序号1-65535）的行需要确认，
+ * 上层执行后调用acknowledge()回复 "$ACK:<序号>,<接收us>,<执行us>" 或 "$NAK:<序号>,<原因>"。
+ * 接收us为读到行首字节到整行解析完的时间，执行us为解析完到回复的时间，供延时测量使用。
+ * 发送方未收到确认时会用同一序号重发；最近处理过的序号直接重发缓存的回复
+ * （ACK不带耗时），命令不会被重复执行。不带序号的行照旧处理，不回复。
+ */
+class SerialCommandParser {
+public:
+    static const uint8_t MAX_LINE_LENGTH = 64;
+    static const uint8_t RECENT_COUNT = 8;     // 用于去重的最近序号数
+    
+    explicit SerialCommandParser(Stream& stream);
+    
+    // 读取已到达的字节，收到完整的一行时返回对应事件
+    SerialEventType poll();
+    
+    // 最近一次SERIAL_EVENT_COLOR事件的颜色
+    ColorCode getColor() const { return m_color; }
+    
+    // 最近一次SERIAL_EVENT_COMMAND事件的命令文本（下一次poll前有效）
+    const char* getCommand() const { return m_buffer; }
+    
+    // 最近一次事件的序号，0表示不带序号（无需确认）
+    uint16_t getSequence() const { return m_sequence; }
+    
+    // 回复最近一次事件：ok为false时reason说明原因；不带序号的事件忽略
+    void acknowledge(bool ok, const char* reason = nullptr);
+    
+    // 因过长被丢弃的行数
+    uint16_t getOverflowCount() const { return m_overflowCount; }
+    
+    // 收到的重复命令数（已重发缓存的回复）
+    uint16_t getDuplicateCount() const { return m_duplicateCount; }
+    
+private:
+    Stream& m_stream;
+    char m_buffer[MAX_LINE_LENGTH + 1];
+    uint8_t m_length;
+    bool m_discarding;       // 当前行已溢出，丢弃到行尾
+    ColorCode m_color;
+    uint16_t m_overflowCount;
+    uint16_t m_sequence;
+    unsigned long m_lineStartUs;   // 读到当前行首字节的时间
+    unsigned long m_dispatchUs;    // 最近一次事件解析完成的时间
+    
+    // 最近处理过的序号及其回复，环形覆盖
+    struct RecentCommand {
+        uint16_t sequence;
+        bool ok;
+        const char* reason;   // 字符串常量
+    };
+    RecentCommand m_recent[RECENT_COUNT];
+    uint8_t m_recentNext;
+    uint16_t m_duplicateCount;
+    
+    // 解析缓冲区中的完整一行
+    SerialEventType parseLine();
+    
+    // 去掉行首的 "#<序号>:"，成功时设置m_sequence
+    bool stripSequence();
+    
+    // 序号在最近处理过的记录中时重发回复并返回true
+    bool replayIfDuplicate();
+    
+    void sendReply(uint16_t sequence, bool ok, const char* reason, bool withTiming);
+};
+
+#endif // SERIAL_COMMAND_PARSER_H
@@ -0,0 +1,82 @@
+#ifndef STATIC_VECTOR_H
+#define STATIC_VECTOR_H
+
+#include <stddef.h>
+
+/**
+ * 固定容量数组，用于替代动态分配的列表
+ * 
+ * 元素存放在对象内部，容量N在编译期确定，满时push_back返回false。
+ * 要求T可默认构造和赋值（本项目中均为简单结构体）。
+ */
+template <typename T, size_t N>
+class StaticVector {
+public:
+    StaticVector() : m_size(0) {}
+    
+    bool push_back(const T& item) {
+        if (m_size >= N) {
+            return false;
+        }
+        m_items[m_size++] = item;
+        return true;
+    }
+    
+    void pop_back() {
+        if (m_size > 0) {
+            m_size--;
+        }
+    }
+    
+    // 删除指定位置的元素，后面的元素前移以保持顺序
+    void erase(size_t index) {
+        if (index >= m_size) {
+            return;
+        }
+        for (size_t i = index + 1; i < m_size; i++) {
+            m_items[i - 1] = m_items[i];
+        }
+        m_size--;
+    }
+    
+    // 只保留满足条件的元素，返回删除的数量
+    template <typename Predicate>
+    size_t remove_if(Predicate pred) {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_size; i++) {
+            if (!pred(m_items[i])) {
+                m_items[kept++] = m_items[i];
+            }
+        }
+        size_t removed = m_size - kept;
+        m_size = kept;
+        return removed;
+    }
+    
+    // 调整元素数量（不超过容量），新增元素保留原值
+    void resize(size_t count) { m_size = (count <= N) ? count : N; }
+    
+    void clear() { m_size = 0; }
+    
+    T& operator[](size_t index) { return m_items[index]; }
+    const T& operator[](size_t index) const { return m_items[index]; }
+    
+    T& back() { return m_items[m_size - 1]; }
+    const T& back() const { return m_items[m_size - 1]; }
+    
+    T* begin() { return m_items; }
+    T* end() { return m_items + m_size; }
+    const T* begin() const { return m_items; }
+    const T* end() const { return m_items + m_size; }
+    
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    bool full() const { return m_size >= N; }
+    static size_t capacity() { return N; }
+    
+private:
+    T m_items[N];
+    size_t m_size;
+};
+
+#endif // STATIC_VECTOR_H
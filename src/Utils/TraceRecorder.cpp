@@ -0,0 +1,231 @@
+#include "TraceRecorder.h"
+
+HardwareSerial* TraceRecorder::s_out = nullptr;
+TraceFrame TraceRecorder::s_frame = {};
+unsigned long TraceRecorder::s_frameStartUs = 0;
+unsigned long TraceRecorder::s_frameCount = 0;
+unsigned long TraceRecorder::s_droppedCount = 0;
+
+// 小端写入
+static uint8_t* putU16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint8_t* putU32(uint8_t* p, uint32_t v) {
+    p = putU16(p, (uint16_t)(v & 0xFFFF));
+    return putU16(p, (uint16_t)(v >> 16));
+}
+
+static uint16_t getU16(const uint8_t* p) {
+    return (uint16_t)p[0] | ((uint16_t)p[1] << 8);
+}
+
+static uint32_t getU32(const uint8_t* p) {
+    return (uint32_t)getU16(p) | ((uint32_t)getU16(p + 2) << 16);
+}
+
+// 运动分量量化为±127
+static int8_t quantize(float v) {
+    float scaled = v * 100.0f;
+    if (scaled > 127.0f) scaled = 127.0f;
+    if (scaled < -127.0f) scaled = -127.0f;
+    return (int8_t)(scaled >= 0 ? scaled + 0.5f : scaled - 0.5f);
+}
+
+void TraceRecorder::begin(HardwareSerial* out) {
+    s_out = out;
+    s_frameCount = 0;
+    s_droppedCount = 0;
+    memset(&s_frame, 0, sizeof(s_frame));
+}
+
+void TraceRecorder::noteInfrared(uint8_t raw) {
+    s_frame.infrared = raw;
+}
+
+void TraceRecorder::notePulse(unsigned long pulseUs) {
+    s_frame.pulseUs = pulseUs > 0xFFFF ? 0xFFFF : (uint16_t)pulseUs;
+    s_frame.flags |= TRACE_FLAG_PULSE;
+}
+
+void TraceRecorder::noteMotor(float vx, float vy, float omega, int speed) {
+    s_frame.vx = quantize(vx);
+    s_frame.vy = quantize(vy);
+    s_frame.omega = quantize(omega);
+    s_frame.speed = (uint8_t)constrain(speed, 0, 255);
+    s_frame.flags |= TRACE_FLAG_MOTOR;
+}
+
+void TraceRecorder::beginFrame() {
+    // 红外、脉宽和电机指令保留上一周期的值，只清除本周期标志
+    s_frame.timeMs = millis();
+    s_frame.flags = 0;
+    s_frameStartUs = micros();
+}
+
+void TraceRecorder::endFrame(uint8_t navState, uint8_t junction) {
+    if (!s_out) {
+        return;
+    }
+    unsigned long cost = micros() - s_frameStartUs;
+    s_frame.costUs = cost > 0xFFFF ? 0xFFFF : (uint16_t)cost;
+    s_frame.navState = navState;
+    s_frame.junction = junction;
+
+    uint8_t buffer[MAX_RECORD];
+    uint8_t length = encodeFrame(s_frame, buffer);
+    if (s_out->availableForWrite() < length) {
+        s_droppedCount++;
+        return;
+    }
+    s_out->write(buffer, length);
+    s_frameCount++;
+}
+
+void TraceRecorder::event(TraceEventType type, uint8_t a, uint8_t b) {
+    if (!s_out) {
+        return;
+    }
+    TraceEvent ev;
+    ev.timeMs = millis();
+    ev.type = (uint8_t)type;
+    ev.a = a;
+    ev.b = b;
+
+    uint8_t buffer[MAX_RECORD];
+    uint8_t length = encodeEvent(ev, buffer);
+    // 事件决定回放时导航控制器的状态，发送缓冲不足时等待而不丢弃
+    s_out->write(buffer, length);
+}
+
+uint8_t TraceRecorder::frameRecord(uint8_t type, const uint8_t* payload, uint8_t length, uint8_t* out) {
+    uint8_t checksum = type ^ length;
+    out[0] = SYNC1;
+    out[1] = SYNC2;
+    out[2] = type;
+    out[3] = length;
+    for (uint8_t i = 0; i < length; i++) {
+        out[4 + i] = payload[i];
+        checksum ^= payload[i];
+    }
+    out[4 + length] = checksum;
+    return length + 5;
+}
+
+uint8_t TraceRecorder::encodeFrame(const TraceFrame& frame, uint8_t* out) {
+    uint8_t payload[FRAME_PAYLOAD];
+    uint8_t* p = putU32(payload, frame.timeMs);
+    *p++ = frame.infrared;
+    p = putU16(p, frame.pulseUs);
+    *p++ = (uint8_t)frame.vx;
+    *p++ = (uint8_t)frame.vy;
+    *p++ = (uint8_t)frame.omega;
+    *p++ = frame.speed;
+    *p++ = frame.navState;
+    *p++ = frame.junction;
+    *p++ = frame.flags;
+    putU16(p, frame.costUs);
+    return frameRecord(TRACE_RECORD_FRAME, payload, FRAME_PAYLOAD, out);
+}
+
+uint8_t TraceRecorder::encodeEvent(const TraceEvent& ev, uint8_t* out) {
+    uint8_t payload[EVENT_PAYLOAD];
+    uint8_t* p = putU32(payload, ev.timeMs);
+    *p++ = ev.type;
+    *p++ = ev.a;
+    *p = ev.b;
+    return frameRecord(TRACE_RECORD_EVENT, payload, EVENT_PAYLOAD, out);
+}
+
+bool TraceRecorder::decodeFrame(const uint8_t* payload, uint8_t length, TraceFrame& frame) {
+    if (length != FRAME_PAYLOAD) {
+        return false;
+    }
+    frame.timeMs = getU32(payload);
+    frame.infrared = payload[4];
+    frame.pulseUs = getU16(payload + 5);
+    frame.vx = (int8_t)payload[7];
+    frame.vy = (int8_t)payload[8];
+    frame.omega = (int8_t)payload[9];
+    frame.speed = payload[10];
+    frame.navState = payload[11];
+    frame.junction = payload[12];
+    frame.flags = payload[13];
+    frame.costUs = getU16(payload + 14);
+    return true;
+}
+
+bool TraceRecorder::decodeEvent(const uint8_t* payload, uint8_t length, TraceEvent& ev) {
+    if (length != EVENT_PAYLOAD) {
+        return false;
+    }
+    ev.timeMs = getU32(payload);
+    ev.type = payload[4];
+    ev.a = payload[5];
+    ev.b = payload[6];
+    return true;
+}
+
+void TraceParser::reset() {
+    m_stage = WAIT_SYNC1;
+    m_type = 0;
+    m_length = 0;
+    m_received = 0;
+    m_checksum = 0;
+    m_errors = 0;
+}
+
+bool TraceParser::feed(uint8_t byte) {
+    switch (m_stage) {
+        case WAIT_SYNC1:
+            if (byte == TraceRecorder::SYNC1) {
+                m_stage = WAIT_SYNC2;
+            }
+            return false;
+
+        case WAIT_SYNC2:
+            if (byte == TraceRecorder::SYNC2) {
+                m_stage = READ_TYPE;
+            } else if (byte != TraceRecorder::SYNC1) {
+                m_stage = WAIT_SYNC1;
+            }
+            return false;
+
+        case READ_TYPE:
+            m_type = byte;
+            m_checksum = byte;
+            m_stage = READ_LENGTH;
+            return false;
+
+        case READ_LENGTH:
+            if (byte > TraceRecorder::MAX_PAYLOAD) {
+                m_errors++;
+                m_stage = WAIT_SYNC1;
+                return false;
+            }
+            m_length = byte;
+            m_checksum ^= byte;
+            m_received = 0;
+            m_stage = m_length > 0 ? READ_PAYLOAD : READ_CHECKSUM;
+            return false;
+
+        case READ_PAYLOAD:
+            m_payload[m_received++] = byte;
+            m_checksum ^= byte;
+            if (m_received >= m_length) {
+                m_stage = READ_CHECKSUM;
+            }
+            return false;
+
+        case READ_CHECKSUM:
+            m_stage = WAIT_SYNC1;
+            if (byte != m_checksum) {
+                m_errors++;
+                return false;
+            }
+            return true;
+    }
+    return false;
+}
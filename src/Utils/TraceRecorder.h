@@ -0,0 +1,153 @@
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include <Arduino.h>
+#include "Config.h"
+
+/**
+ * 传感器轨迹记录
+ *
+ * 每个导航周期（NavigationController::update）输出一帧二进制记录：
+ * 时间戳、红外原始字节、超声波脉宽、电机指令、导航状态和路口判定。
+ * 状态机对导航控制器的调用（恢复巡线、预期路口等）作为事件记录，
+ * 主机端回放工具（tools/replay）按顺序重放，使回放与实车走同一条代码路径。
+ *
+ * 记录格式（小端）：
+ *   0xA5 0x5A | 类型(1) | 长度(1) | 数据(长度) | 校验(1)
+ * 校验为类型、长度和数据的逐字节异或。与文本日志共用串口时，
+ * 采集工具按同步字和校验把二进制记录与日志行分开。
+ */
+
+// 记录类型
+enum TraceRecordType {
+    TRACE_RECORD_FRAME = 1,  // 导航周期帧
+    TRACE_RECORD_EVENT = 2   // 导航控制事件
+};
+
+// 事件类型
+enum TraceEventType {
+    TRACE_EVENT_NAV_INIT = 1,   // NavigationController::init
+    TRACE_EVENT_NAV_RESUME,     // resumeFollowing
+    TRACE_EVENT_NAV_STOP,       // stop
+    TRACE_EVENT_NAV_EXPECT,     // setExpectedJunction，a = 路口类型
+    TRACE_EVENT_NAV_SPEED,      // setBaseSpeed，a = 速度
+    TRACE_EVENT_NAV_AVOID,      // 避障设置，a = 是否启用，b = 是否反向
+    TRACE_EVENT_SYSTEM_STATE    // 状态机切换，a = 原状态，b = 新状态（仅供查看）
+};
+
+// 帧标志
+#define TRACE_FLAG_PULSE  0x01  // 本周期测量过超声波
+#define TRACE_FLAG_MOTOR  0x02  // 本周期下发过电机指令
+
+// 导航周期帧
+struct TraceFrame {
+    uint32_t timeMs;    // 周期开始时的millis()
+    uint8_t infrared;   // 红外原始字节，bit7为0号（最左）传感器，0表示黑线
+    uint16_t pulseUs;   // 最近一次超声波脉宽 (us)，0表示超时
+    int8_t vx;          // 最近一次电机指令：麦轮运动分量×100
+    int8_t vy;
+    int8_t omega;
+    uint8_t speed;      // 最近一次电机指令的速度，急停为0
+    uint8_t navState;   // 周期结束时的NavigationState
+    uint8_t junction;   // 周期结束时检测到的JunctionType
+    uint8_t flags;      // TRACE_FLAG_*
+    uint16_t costUs;    // 本周期导航处理耗时 (us)
+};
+
+// 导航控制事件
+struct TraceEvent {
+    uint32_t timeMs;
+    uint8_t type;       // TraceEventType
+    uint8_t a;
+    uint8_t b;
+};
+
+class TraceRecorder {
+public:
+    static const uint8_t SYNC1 = 0xA5;
+    static const uint8_t SYNC2 = 0x5A;
+    static const uint8_t FRAME_PAYLOAD = 16;
+    static const uint8_t EVENT_PAYLOAD = 7;
+    static const uint8_t MAX_PAYLOAD = FRAME_PAYLOAD;
+    static const uint8_t MAX_RECORD = MAX_PAYLOAD + 5;
+
+    // 开始向指定串口输出轨迹，传入nullptr停止
+    static void begin(HardwareSerial* out);
+    static bool isActive() { return s_out != nullptr; }
+
+    // 采样钩子（由各驱动调用，只更新当前帧内容）
+    static void noteInfrared(uint8_t raw);
+    static void notePulse(unsigned long pulseUs);
+    static void noteMotor(float vx, float vy, float omega, int speed);
+
+    // 导航周期开始/结束，结束时输出一帧
+    static void beginFrame();
+    static void endFrame(uint8_t navState, uint8_t junction);
+
+    // 输出一条事件
+    static void event(TraceEventType type, uint8_t a = 0, uint8_t b = 0);
+
+    // 已输出帧数 / 因串口发送缓冲不足而丢弃的记录数
+    static unsigned long getFrameCount() { return s_frameCount; }
+    static unsigned long getDroppedCount() { return s_droppedCount; }
+
+    // 编解码（主机端回放工具共用），返回写入的字节数
+    static uint8_t encodeFrame(const TraceFrame& frame, uint8_t* out);
+    static uint8_t encodeEvent(const TraceEvent& ev, uint8_t* out);
+    static bool decodeFrame(const uint8_t* payload, uint8_t length, TraceFrame& frame);
+    static bool decodeEvent(const uint8_t* payload, uint8_t length, TraceEvent& ev);
+
+private:
+    static HardwareSerial* s_out;
+    static TraceFrame s_frame;
+    static unsigned long s_frameStartUs;
+    static unsigned long s_frameCount;
+    static unsigned long s_droppedCount;
+
+    // 加上同步字、长度和校验后写出，发送缓冲不足时丢弃整条记录而不阻塞
+    static void writeRecord(uint8_t type, const uint8_t* payload, uint8_t length);
+    static uint8_t frameRecord(uint8_t type, const uint8_t* payload, uint8_t length, uint8_t* out);
+};
+
+/**
+ * 轨迹流解析器：逐字节输入，跳过同步字之外的内容（如文本日志），
+ * 校验通过时返回true，随后可读取类型和数据
+ */
+class TraceParser {
+public:
+    TraceParser() { reset(); }
+
+    void reset();
+    bool feed(uint8_t byte);
+
+    uint8_t getType() const { return m_type; }
+    uint8_t getLength() const { return m_length; }
+    const uint8_t* getPayload() const { return m_payload; }
+    unsigned long getErrorCount() const { return m_errors; }
+
+private:
+    enum ParseStage { WAIT_SYNC1, WAIT_SYNC2, READ_TYPE, READ_LENGTH, READ_PAYLOAD, READ_CHECKSUM };
+
+    ParseStage m_stage;
+    uint8_t m_type;
+    uint8_t m_length;
+    uint8_t m_received;
+    uint8_t m_checksum;
+    uint8_t m_payload[TraceRecorder::MAX_PAYLOAD];
+    unsigned long m_errors;
+};
+
+// 驱动中的记录钩子，ENABLE_TRACE为0时不产生任何代码
+#if ENABLE_TRACE
+#define TRACE_INFRARED(raw)               TraceRecorder::noteInfrared(raw)
+#define TRACE_PULSE(us)                   TraceRecorder::notePulse(us)
+#define TRACE_MOTOR(vx, vy, omega, speed) TraceRecorder::noteMotor((vx), (vy), (omega), (speed))
+#define TRACE_EVENT(...)                  TraceRecorder::event(__VA_ARGS__)
+#else
+#define TRACE_INFRARED(raw)               ((void)0)
+#define TRACE_PULSE(us)                   ((void)0)
+#define TRACE_MOTOR(vx, vy, omega, speed) ((void)0)
+#define TRACE_EVENT(...)                  ((void)0)
+#endif
+
+#endif // TRACE_RECORDER_H
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+"""
+颜色分类查找表生成
+
+由各颜色在 HSL 空间的中心和协方差生成 src/Sensor/ColorLut.h。
+分类规则为马氏距离最近中心，色相按 0-240 循环计算距离（红色跨 0 无需特殊处理）；
+置信度为各颜色按 exp(-d²/2) 归一化后最近颜色所占的比例，
+距最近中心超过 --core 个标准差后线性降低，超过 --gate 个标准差的格子为未知。
+
+生成:  python3 tools/color_lut.py
+重新校准:
+  1. 编译上传 TestColorCalibration（TEST_COLOR_CALIBRATION），按提示依次采样，串口日志保存为 cal.log
+     （每个样本输出一行 CAL,<颜色代码>,<H>,<S>,<L>）
+  2. python3 tools/color_lut.py --log cal.log
+     有样本（至少 3 个）的颜色用样本重新计算中心和协方差，其余沿用 tools/color_calibration.json；
+     加 --save 把新结果写回 JSON。
+只在场地上临时调整时不必重新生成：主程序的 CAL 命令或 TestColorCalibration 的 w 命令
+把校准写入 EEPROM，启动时加载后按模型直接计算，不再查表（见 src/Sensor/ColorCalibration.h）。
+"""
+
+import argparse
+import json
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+CONFIG_H = os.path.join(ROOT, "src", "Utils", "Config.h")
+DEFAULT_CALIBRATION = os.path.join(ROOT, "tools", "color_calibration.json")
+DEFAULT_OUTPUT = os.path.join(ROOT, "src", "Sensor", "ColorLut.h")
+
+HSL_MAX = 240           # 感为传感器 HSL 取值 0-240
+MIN_STD = 2.0           # 标准差下限，避免样本过于集中时协方差奇异
+CONFIDENCE_LEVELS = 31  # 置信度占 5 位
+
+
+def color_codes():
+    """从 Config.h 读取 ColorCode 枚举"""
+    with open(CONFIG_H, encoding="utf-8") as f:
+        text = f.read()
+    return {name: int(value) for name, value in re.findall(r"COLOR_(\w+)\s*=\s*(\d+)", text)}
+
+
+def hue_delta(a, b):
+    """色相差，循环到 [-120, 120)"""
+    return (a - b + HSL_MAX / 2) % HSL_MAX - HSL_MAX / 2
+
+
+def invert(m):
+    """2x2 或 3x3 矩阵求逆"""
+    if len(m) == 2:
+        (a, b), (c, d) = m
+        det = a * d - b * c
+        return [[d / det, -b / det], [-c / det, a / det]]
+    det = (m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+           - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+           + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]))
+    inv = [[0.0] * 3 for _ in range(3)]
+    for i in range(3):
+        for j in range(3):
+            rows = [r for r in range(3) if r != j]
+            cols = [c for c in range(3) if c != i]
+            minor = (m[rows[0]][cols[0]] * m[rows[1]][cols[1]]
+                     - m[rows[0]][cols[1]] * m[rows[1]][cols[0]])
+            inv[i][j] = (-1) ** (i + j) * minor / det
+    return inv
+
+
+class ColorModel:
+    def __init__(self, name, mean, cov, use_hue):
+        self.name = name
+        # 固件中中心按整数保存，查找表也按整数中心计算
+        self.mean = [int(round(mean[0])) % HSL_MAX, int(round(mean[1])), int(round(mean[2]))]
+        self.use_hue = use_hue
+        dims = [0, 1, 2] if use_hue else [1, 2]
+        self.dims = dims
+        self.cov = cov
+        self.inv = invert([[cov[i][j] for j in dims] for i in dims])
+
+    @classmethod
+    def from_json(cls, name, entry):
+        use_hue = entry.get("hue", True)
+        if "cov" in entry:
+            cov = entry["cov"]
+        else:
+            cov = [[0.0] * 3 for _ in range(3)]
+            for i, std in enumerate(entry["std"]):
+                cov[i][i] = max(std, MIN_STD) ** 2
+        return cls(name, entry["mean"], cov, use_hue)
+
+    @classmethod
+    def from_samples(cls, name, samples, use_hue):
+        # 色相取圆周平均
+        angle_x = sum(math.cos(2 * math.pi * h / HSL_MAX) for h, _, _ in samples)
+        angle_y = sum(math.sin(2 * math.pi * h / HSL_MAX) for h, _, _ in samples)
+        mean_h = (math.atan2(angle_y, angle_x) / (2 * math.pi) * HSL_MAX) % HSL_MAX
+        mean = [mean_h,
+                sum(s for _, s, _ in samples) / len(samples),
+                sum(l for _, _, l in samples) / len(samples)]
+        deltas = [(hue_delta(h, mean[0]), s - mean[1], l - mean[2]) for h, s, l in samples]
+        cov = [[sum(d[i] * d[j] for d in deltas) / (len(samples) - 1) for j in range(3)]
+               for i in range(3)]
+        for i in range(3):
+            cov[i][i] += MIN_STD ** 2
+        return cls(name, mean, cov, use_hue)
+
+    def to_json(self):
+        entry = {"mean": self.mean,
+                 "cov": [[round(v, 2) for v in row] for row in self.cov]}
+        if not self.use_hue:
+            entry["hue"] = False
+        return entry
+
+    def inverse3(self):
+        """协方差逆矩阵扩展到 H/S/L 三维，不使用色相时 H 相关项为 0"""
+        inv = [[0.0] * 3 for _ in range(3)]
+        for a, i in enumerate(self.dims):
+            for b, j in enumerate(self.dims):
+                inv[i][j] = self.inv[a][b]
+        return inv
+
+    def distance2(self, h, s, l):
+        delta = [hue_delta(h, self.mean[0]), s - self.mean[1], l - self.mean[2]]
+        d = [delta[i] for i in self.dims]
+        return sum(d[i] * self.inv[i][j] * d[j] for i in range(len(d)) for j in range(len(d)))
+
+
+def read_samples(paths):
+    """从校准日志读取 CAL,<颜色代码>,<H>,<S>,<L>"""
+    samples = {}
+    pattern = re.compile(r"CAL,(\d+),(\d+),(\d+),(\d+)")
+    for path in paths:
+        with open(path, encoding="utf-8", errors="replace") as f:
+            for line in f:
+                match = pattern.search(line)
+                if match:
+                    code, h, s, l = map(int, match.groups())
+                    samples.setdefault(code, []).append((h, s, l))
+    return samples
+
+
+def classify(models, codes, h, s, l, core, gate):
+    """返回 (颜色代码, 置信度 0-31)"""
+    distances = [(m.distance2(h, s, l), m) for m in models]
+    distances.sort(key=lambda item: item[0])
+    best_d2, best = distances[0]
+    if best_d2 > gate * gate:
+        return codes["UNKNOWN"], 0
+    weights = [math.exp(-(d2 - best_d2) / 2) for d2, _ in distances]
+    confidence = weights[0] / sum(weights)
+    if best_d2 > core * core:
+        confidence *= (gate * gate - best_d2) / (gate * gate - core * core)
+    return codes[best.name], int(round(confidence * CONFIDENCE_LEVELS))
+
+
+def bin_center(index, bins):
+    return (index + 0.5) * HSL_MAX / bins
+
+
+def build_table(models, codes, bins, core, gate):
+    h_bins, s_bins, l_bins = bins
+    table = []
+    for hb in range(h_bins):
+        for sb in range(s_bins):
+            for lb in range(l_bins):
+                code, confidence = classify(models, codes, bin_center(hb, h_bins),
+                                            bin_center(sb, s_bins), bin_center(lb, l_bins), core, gate)
+                table.append(code | (confidence << 3))
+    return table
+
+
+def c_float(value):
+    text = "%.6g" % (value if value != 0 else 0.0)
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def write_header(path, models, codes, table, bins, core, gate, sources):
+    h_bins, s_bins, l_bins = bins
+    lines = [
+        "// 由 tools/color_lut.py 生成，请勿手动修改",
+        "// 校准数据: " + ", ".join(sources),
+        "// 马氏距离最近中心，超过 %.1f 个标准差置信度开始降低，超过 %.1f 个标准差为未知" % (core, gate),
+        "//",
+        "// 颜色      中心 H/S/L            标准差 H/S/L",
+    ]
+    for m in models:
+        std = [math.sqrt(m.cov[i][i]) for i in range(3)]
+        hue = "%5.1f" % m.mean[0] if m.use_hue else "    -"
+        hue_std = "%5.1f" % std[0] if m.use_hue else "    -"
+        lines.append("// %-8s %s %5.1f %5.1f    %s %5.1f %5.1f" % (
+            m.name, hue, m.mean[1], m.mean[2], hue_std, std[1], std[2]))
+    lines += [
+        "//",
+        "// 只能被 ColorSensor.cpp 包含",
+        "",
+        "#ifndef COLOR_LUT_H",
+        "#define COLOR_LUT_H",
+        "",
+        "#include <avr/pgmspace.h>",
+        "#include \"ColorCalibration.h\"",
+        "",
+        "#define COLOR_LUT_H_BINS %d" % h_bins,
+        "#define COLOR_LUT_S_BINS %d" % s_bins,
+        "#define COLOR_LUT_L_BINS %d" % l_bins,
+        "#define COLOR_LUT_HSL_MAX %d" % HSL_MAX,
+        "#define COLOR_LUT_CONFIDENCE_MAX %d" % CONFIDENCE_LEVELS,
+        "",
+        "// 生成查找表所用的模型（下标为颜色代码），是EEPROM校准记录的默认值",
+        "// 有效, 中心 H/S/L, 协方差逆矩阵 HH/HS/HL/SS/SL/LL",
+        "static const ColorModel COLOR_DEFAULT_MODELS[%d] PROGMEM = {" % (max(codes.values()) + 1),
+    ]
+    by_code = {codes[m.name]: m for m in models}
+    for code in range(max(codes.values()) + 1):
+        m = by_code.get(code)
+        if m is None:
+            lines.append("    { 0, { 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },")
+            continue
+        inv = m.inverse3()
+        upper = [inv[0][0], inv[0][1], inv[0][2], inv[1][1], inv[1][2], inv[2][2]]
+        lines.append("    { 1, { %d, %d, %d }, { %s } }, // %s" % (
+            m.mean[0], m.mean[1], m.mean[2], ", ".join(c_float(v) for v in upper), m.name))
+    lines += [
+        "};",
+        "",
+        "// 下标 (H格 * S格数 + S格) * L格数 + L格；每字节低3位为颜色代码，高5位为置信度",
+        "static const uint8_t COLOR_LUT[%d] PROGMEM = {" % len(table),
+    ]
+    row = s_bins * l_bins
+    for start in range(0, len(table), row):
+        chunk = table[start:start + row]
+        for offset in range(0, len(chunk), 16):
+            lines.append("    " + ", ".join("0x%02X" % v for v in chunk[offset:offset + 16]) + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    lines += ["};", "", "#endif // COLOR_LUT_H", ""]
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="生成颜色分类查找表")
+    parser.add_argument("--calibration", default=DEFAULT_CALIBRATION, help="校准数据 JSON")
+    parser.add_argument("--log", action="append", default=[], help="TestColorCalibration 的串口日志（可多次指定）")
+    parser.add_argument("--save", action="store_true", help="把由样本更新的结果写回校准 JSON")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT, help="输出头文件")
+    parser.add_argument("--bins", default="48,8,16", help="H,S,L 量化格数（默认 48,8,16）")
+    parser.add_argument("--core", type=float, default=3.0, help="置信度开始降低的标准差倍数（默认3）")
+    parser.add_argument("--gate", type=float, default=5.0, help="未知判定的标准差倍数（默认5）")
+    args = parser.parse_args()
+
+    codes = color_codes()
+    names = {code: name for name, code in codes.items()}
+    with open(args.calibration, encoding="utf-8") as f:
+        calibration = json.load(f)
+
+    samples = read_samples(args.log)
+    models = []
+    for name, entry in calibration["colors"].items():
+        model = ColorModel.from_json(name, entry)
+        own = samples.get(codes[name], [])
+        if len(own) >= 3:
+            model = ColorModel.from_samples(name, own, model.use_hue)
+            print("%s: 使用 %d 个样本" % (name, len(own)))
+        elif own:
+            print("%s: 样本不足（%d），沿用校准文件" % (name, len(own)))
+        models.append(model)
+    for code in samples:
+        if names.get(code) not in calibration["colors"]:
+            print("忽略未知颜色代码 %d 的样本" % code, file=sys.stderr)
+
+    bins = tuple(int(v) for v in args.bins.split(","))
+    table = build_table(models, codes, bins, args.core, args.gate)
+    sources = [os.path.relpath(args.calibration, ROOT)] + [os.path.basename(p) for p in args.log]
+    write_header(args.output, models, codes, table, bins, args.core, args.gate, sources)
+
+    counts = {}
+    for value in table:
+        counts[names[value & 0x07]] = counts.get(names[value & 0x07], 0) + 1
+    print("%d 格（%d 字节）: %s" % (len(table), len(table),
+          ", ".join("%s %d" % item for item in sorted(counts.items()))))
+
+    if args.save and samples:
+        calibration["colors"] = {m.name: m.to_json() for m in models}
+        with open(args.calibration, "w", encoding="utf-8") as f:
+            json.dump(calibration, f, ensure_ascii=False, indent=2)
+            f.write("\n")
+
+
+if __name__ == "__main__":
+    main()
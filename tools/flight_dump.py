@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""
+ESP32 黑匣子记录解码
+
+下载:  curl -o flight.bin http://<esp-ip>/recorder/download
+       （重启后: http://<esp-ip>/recorder/saved）
+解码:  python3 tools/flight_dump.py flight.bin [--trace run.bin]
+
+按接收时间逐行输出 Arduino 发来的文本，标注块（冻结原因等）以 ** 标出。
+数据中夹带的导航轨迹记录（TRACE_SERIAL 设为 Serial2 时）可用 --trace 提取，
+交给 tools/replay 回放。块格式见 esp/src/FlightRecorder.h。
+"""
+
+import argparse
+import struct
+import sys
+
+from trace_capture import StreamSplitter
+
+ANNOTATION_FLAG = 0x8000
+
+
+def read_chunks(data):
+    """逐块返回 (时间戳ms, 是否标注, 数据)"""
+    pos = 0
+    while pos + 6 <= len(data):
+        timestamp, length = struct.unpack_from("<IH", data, pos)
+        size = length & ~ANNOTATION_FLAG
+        pos += 6
+        if pos + size > len(data):
+            break
+        yield timestamp, bool(length & ANNOTATION_FLAG), data[pos:pos + size]
+        pos += size
+
+
+def main():
+    parser = argparse.ArgumentParser(description="解码 ESP32 黑匣子记录")
+    parser.add_argument("input", help="从 /recorder/download 或 /recorder/saved 下载的文件")
+    parser.add_argument("--trace", help="把其中的导航轨迹记录写入此文件")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+
+    splitter = StreamSplitter()
+    trace = open(args.trace, "wb") if args.trace else None
+    records = 0
+    line = bytearray()
+    line_time = None
+
+    for timestamp, annotation, payload in read_chunks(data):
+        if annotation:
+            print("[%10.3f] ** %s" % (timestamp / 1000.0, payload.decode("utf-8", "replace")))
+            continue
+        found, text = splitter.feed(payload)
+        if trace:
+            for _, raw in found:
+                trace.write(raw)
+        records += len(found)
+        # 每行标注该行第一个字节的接收时间
+        for b in text:
+            if line_time is None:
+                line_time = timestamp
+            if b == 0x0A:
+                print("[%10.3f] %s" % (line_time / 1000.0, line.decode("utf-8", "replace").rstrip("\r")))
+                line.clear()
+                line_time = None
+            else:
+                line.append(b)
+
+    if line:
+        print("[%10.3f] %s" % (line_time / 1000.0, line.decode("utf-8", "replace")))
+    if trace:
+        trace.close()
+        print("轨迹记录 %d 条 -> %s" % (records, args.trace), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+"""
+命令通道端到端延时测试
+
+逐条发送可靠命令（默认 PING），上一条确认后再发下一条，统计各段耗时的分布。
+协议见 src/Utils/SerialCommandParser.h 和 esp/src/CommandChannel.h。
+
+三种对象:
+  --ws ws://<esp-ip>/ws     主机代替浏览器，测试完整链路（需要 websocket-client）
+  --port /dev/ttyUSB0       主机代替 ESP32，经 USB 转串口直接连接 Arduino 的 Serial2（需要 pyserial）
+  --standin                 主机同时代替 ESP32 和 Arduino：启动 tools/replay/mega_standin
+                            （编译自固件中的 SerialCommandParser），按 --baud 模拟串口传输时间
+
+回归检查:
+  python3 tools/latency_bench.py --standin --csv base.csv
+  python3 tools/latency_bench.py --standin --baud 57600 --baseline base.csv
+与基准相比中位数或 P99 变慢超过 --tolerance（默认 20%）时返回 1。
+"""
+
+import argparse
+import csv
+import json
+import os
+import random
+import subprocess
+import sys
+import threading
+import time
+
+RETRY_TIMEOUT_S = 0.1   # 与 esp/src/CommandChannel.h 中 CMD_RETRY_TIMEOUT_MS 一致
+MAX_RETRIES = 4         # 与 CMD_MAX_RETRIES 一致
+BITS_PER_BYTE = 10      # 8N1
+
+FIELDS = ["seq", "retries", "total_ms", "queue_us", "rtt_us", "mega_recv_us", "mega_act_us", "reply_us"]
+
+# 各环节：名称与取值函数（毫秒），与 esp/web/bench.html 一致
+HOPS = [
+    ("总往返", lambda s: s["total_ms"]),
+    ("WiFi/浏览器", lambda s: s["total_ms"] - (s["queue_us"] + s["rtt_us"] + s["reply_us"]) / 1000.0),
+    ("ESP32 收到->写串口", lambda s: s["queue_us"] / 1000.0),
+    ("串口往返(不含Arduino处理)", lambda s: (s["rtt_us"] - s["mega_recv_us"] - s["mega_act_us"]) / 1000.0),
+    ("Arduino 接收整行", lambda s: s["mega_recv_us"] / 1000.0),
+    ("Arduino 执行->回复", lambda s: s["mega_act_us"] / 1000.0),
+    ("ESP32 收到确认->回复", lambda s: s["reply_us"] / 1000.0),
+]
+
+
+class SerialLink:
+    """ESP32 一侧的串口：pyserial 端口或 mega_standin 进程的管道"""
+
+    def __init__(self, write, read_line, baud=None):
+        self.write_raw = write
+        self.read_line = read_line
+        self.baud = baud
+
+    def wire_time(self, nbytes):
+        return nbytes * BITS_PER_BYTE / self.baud if self.baud else 0.0
+
+    def write(self, data):
+        # 模拟串口传输：整行传完 Arduino 才能解析
+        delay = self.wire_time(len(data))
+        if delay:
+            time.sleep(delay)
+        self.write_raw(data)
+
+
+class EspStandIn:
+    """按 CommandChannel 的规则发送命令：序号、超时重发、等待 ACK/NAK"""
+
+    def __init__(self, link, drop=0.0):
+        self.link = link
+        self.drop = drop
+        self.seq = random.randint(1, 0xFFFF)
+        self.replies = {}
+        self.cond = threading.Condition()
+        threading.Thread(target=self._reader, daemon=True).start()
+
+    def _reader(self):
+        while True:
+            line = self.link.read_line()
+            if line is None:
+                return
+            received = time.perf_counter()
+            text = line.decode("utf-8", "replace").strip()
+            if not (text.startswith("$ACK:") or text.startswith("$NAK:")):
+                continue
+            # 回复传完才能被 ESP32 收到
+            received += self.link.wire_time(len(line))
+            parts = text[5:].split(",")
+            with self.cond:
+                self.replies.setdefault(int(parts[0]), (text[:4] == "$ACK", parts[1:], received))
+                self.cond.notify_all()
+
+    def send(self, command):
+        seq = self.seq
+        self.seq = 1 if self.seq == 0xFFFF else self.seq + 1
+        line = ("#%d:%s\n" % (seq, command)).encode()
+        first_sent = None
+        for attempt in range(MAX_RETRIES + 1):
+            sent = time.perf_counter()
+            if first_sent is None:
+                first_sent = sent
+            if random.random() >= self.drop:
+                self.link.write(line)
+            with self.cond:
+                self.cond.wait_for(lambda: seq in self.replies, timeout=RETRY_TIMEOUT_S)
+                reply = self.replies.pop(seq, None)
+            if reply is not None:
+                ok, fields, received = reply
+                if not ok or len(fields) < 2:
+                    return None
+                return {
+                    "seq": seq, "retries": attempt,
+                    "total_ms": (received - first_sent) * 1000.0,
+                    "queue_us": 0, "rtt_us": int((received - first_sent) * 1e6),
+                    "mega_recv_us": int(fields[0]), "mega_act_us": int(fields[1]), "reply_us": 0,
+                }
+        return None
+
+
+class WebSocketClient:
+    """代替浏览器，经 ESP32 的 /ws 发送 {"cmd":..,"id":..}"""
+
+    def __init__(self, url):
+        try:
+            import websocket
+        except ImportError:
+            sys.exit("需要websocket-client: pip install websocket-client")
+        self.ws = websocket.create_connection(url, timeout=2)
+        self.next_id = 1
+
+    def send(self, command):
+        tag = self.next_id
+        self.next_id += 1
+        started = time.perf_counter()
+        self.ws.send(json.dumps({"cmd": command, "id": tag}))
+        while True:
+            try:
+                message = self.ws.recv()
+            except Exception:
+                return None
+            # 二进制消息是 Arduino 日志
+            if not isinstance(message, str) or not message.startswith("{"):
+                continue
+            result = json.loads(message)
+            if result.get("type") != "ack" or result.get("id") != tag:
+                continue
+            if not result.get("ok") or "megaRecvUs" not in result:
+                return None
+            return {
+                "seq": result["seq"], "retries": result["retries"],
+                "total_ms": (time.perf_counter() - started) * 1000.0,
+                "queue_us": result["queueUs"], "rtt_us": result["rtt"],
+                "mega_recv_us": result["megaRecvUs"], "mega_act_us": result["megaActUs"],
+                "reply_us": result["replyUs"],
+            }
+
+
+def open_target(args):
+    if args.ws:
+        return WebSocketClient(args.ws)
+
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("需要pyserial: pip install pyserial")
+        port = serial.Serial(args.port, args.baud, timeout=1)
+
+        def read_line():
+            line = port.readline()
+            return line if line else b""
+        # 真实串口已有传输时间，不再模拟
+        return EspStandIn(SerialLink(port.write, read_line), args.drop)
+
+    standin = os.path.join(os.path.dirname(os.path.abspath(__file__)), "replay", "mega_standin")
+    if not os.path.exists(standin):
+        sys.exit("请先编译替身: make -C tools/replay")
+    proc = subprocess.Popen([standin, "--loop-us", str(args.loop_us), "--act-us", str(args.act_us)],
+                            stdin=subprocess.PIPE, stdout=subprocess.PIPE, bufsize=0)
+
+    def write(data):
+        proc.stdin.write(data)
+
+    def read_line():
+        line = proc.stdout.readline()
+        return line if line else None
+    return EspStandIn(SerialLink(write, read_line, args.baud), args.drop)
+
+
+def percentile(values, p):
+    return values[min(len(values) - 1, int(p * len(values)))]
+
+
+def summarize(samples):
+    """返回 {环节: (最小, 中位数, P90, P99, 最大, 平均)}"""
+    summary = {}
+    for name, value in HOPS:
+        values = sorted(value(s) for s in samples)
+        summary[name] = (values[0], percentile(values, 0.5), percentile(values, 0.9),
+                         percentile(values, 0.99), values[-1], sum(values) / len(values))
+    return summary
+
+
+def print_summary(summary):
+    print("%-28s %8s %8s %8s %8s %8s %8s" % ("环节(ms)", "最小", "中位数", "P90", "P99", "最大", "平均"))
+    for name, row in summary.items():
+        print("%-28s %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f" % ((name,) + row))
+
+
+def load_csv(path):
+    with open(path, newline="") as f:
+        return [{k: float(v) for k, v in row.items()} for row in csv.DictReader(f)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="命令通道端到端延时测试")
+    target = parser.add_mutually_exclusive_group(required=True)
+    target.add_argument("--ws", metavar="URL", help="ESP32 的 WebSocket 地址，例如 ws://192.168.1.10/ws")
+    target.add_argument("--port", help="直接连接 Arduino Serial2 的串口")
+    target.add_argument("--standin", action="store_true", help="使用主机替身代替 ESP32 和 Arduino")
+    parser.add_argument("-n", "--count", type=int, default=200, help="发送次数（默认200）")
+    parser.add_argument("--interval", type=float, default=20, help="两次之间的间隔 ms（默认20）")
+    parser.add_argument("--command", default="PING", help="发送的命令（默认PING）")
+    parser.add_argument("-b", "--baud", type=int, default=115200, help="串口波特率，替身按此模拟传输时间")
+    parser.add_argument("--loop-us", type=int, default=2000, help="替身主循环间隔 us（默认2000）")
+    parser.add_argument("--act-us", type=int, default=0, help="替身命令执行耗时 us（默认0）")
+    parser.add_argument("--drop", type=float, default=0.0, help="按此概率丢弃发送，检查重发和去重")
+    parser.add_argument("--csv", help="保存每条命令的原始耗时")
+    parser.add_argument("--baseline", help="与此 CSV 比较中位数和 P99")
+    parser.add_argument("--tolerance", type=float, default=0.2, help="允许变慢的比例（默认0.2）")
+    args = parser.parse_args()
+
+    client = open_target(args)
+    samples = []
+    failures = 0
+    for i in range(args.count):
+        sample = client.send(args.command)
+        if sample is None:
+            failures += 1
+        else:
+            samples.append(sample)
+        time.sleep(args.interval / 1000.0)
+        print("\r%d/%d" % (i + 1, args.count), end="", file=sys.stderr)
+    print(file=sys.stderr)
+
+    if not samples:
+        sys.exit("没有成功的命令")
+    retries = sum(s["retries"] for s in samples)
+    print("成功 %d，失败 %d，重发 %d" % (len(samples), failures, retries))
+    summary = summarize(samples)
+    print_summary(summary)
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            writer = csv.DictWriter(f, fieldnames=FIELDS)
+            writer.writeheader()
+            writer.writerows(samples)
+
+    if args.baseline:
+        base = summarize(load_csv(args.baseline))
+        regressed = False
+        total = HOPS[0][0]
+        for label, index in (("中位数", 1), ("P99", 3)):
+            old, new = base[total][index], summary[total][index]
+            change = (new - old) / old if old > 0 else 0.0
+            print("基准%s %.3f ms -> %.3f ms (%+.0f%%)" % (label, old, new, change * 100))
+            if change > args.tolerance:
+                regressed = True
+        if regressed:
+            print("延时超出基准 %.0f%%" % (args.tolerance * 100))
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
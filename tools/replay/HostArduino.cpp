@@ -0,0 +1,91 @@
+#include <Arduino.h>
+#include <Wire.h>
+#include "HostIO.h"
+#include "../../src/Utils/Config.h"
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
+HardwareSerial Serial2;
+HardwareSerial Serial3;
+TwoWire Wire;
+
+// 虚拟时钟（微秒）与当前帧的传感器输入
+static unsigned long long s_clockUs = 0;
+static uint8_t s_infrared = 0xFF;
+static unsigned long s_pulseUs = 0;
+
+void HostIO::setTime(unsigned long ms) {
+    s_clockUs = (unsigned long long)ms * 1000ULL;
+}
+
+void HostIO::setTimeMicros(unsigned long long us) {
+    s_clockUs = us;
+}
+
+void HostIO::setInfrared(uint8_t raw) {
+    s_infrared = raw;
+}
+
+void HostIO::setPulse(unsigned long us) {
+    s_pulseUs = us;
+}
+
+unsigned long millis() {
+    return (unsigned long)(s_clockUs / 1000ULL);
+}
+
+unsigned long micros() {
+    return (unsigned long)s_clockUs;
+}
+
+// 阻塞延时推进虚拟时钟，与实车上delay()之后读到的millis()一致
+void delay(unsigned long ms) {
+    s_clockUs += (unsigned long long)ms * 1000ULL;
+}
+
+void delayMicroseconds(unsigned int us) {
+    s_clockUs += us;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return HIGH; }  // I2C上拉，总线空闲
+int analogRead(uint8_t) { return 0; }
+void analogWrite(uint8_t, int) {}
+
+unsigned long pulseIn(uint8_t, uint8_t, unsigned long) {
+    return s_pulseUs;
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+long random(long howBig) {
+    return howBig > 0 ? rand() % howBig : 0;
+}
+
+long random(long howSmall, long howBig) {
+    return howBig > howSmall ? howSmall + random(howBig - howSmall) : howSmall;
+}
+
+uint8_t TwoWire::endTransmission(bool) {
+    return m_address == INFRARED_ARRAY_ADDR ? 0 : 2;  // 其余设备按地址未应答处理
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, uint8_t) {
+    m_pending = (address == INFRARED_ARRAY_ADDR && quantity > 0) ? 1 : 0;
+    return m_pending;
+}
+
+int TwoWire::read() {
+    if (m_pending == 0) {
+        return -1;
+    }
+    m_pending = 0;
+    return s_infrared;
+}
+
+int TwoWire::peek() {
+    return m_pending ? s_infrared : -1;
+}
@@ -0,0 +1,14 @@
+#ifndef REPLAY_HOST_IO_H
+#define REPLAY_HOST_IO_H
+
+#include <Arduino.h>
+
+// 回放程序向主机端Arduino接口注入的时间和传感器输入
+namespace HostIO {
+    void setTime(unsigned long ms);
+    void setTimeMicros(unsigned long long us);
+    void setInfrared(uint8_t raw);
+    void setPulse(unsigned long us);
+}
+
+#endif // REPLAY_HOST_IO_H
@@ -0,0 +1,142 @@
+// Arduino 端命令处理的主机替身
+//
+// 用标准输入/输出代替 Serial2，直接运行固件中的 SerialCommandParser，
+// 按与 SimpleStateMachine::pollSerialCommands() 相同的规则回复 ACK/NAK。
+// 由 tools/latency_bench.py --standin 启动，用于在没有硬件时测量协议本身的延时，
+// 以及修改缓冲、重发参数后的回归检查。
+//
+// 用法: mega_standin [--loop-us N] [--act-us N]
+//   --loop-us  模拟主循环中其余工作的耗时（两次 poll 之间的间隔），默认 2000
+//   --act-us   模拟命令执行耗时，默认 0
+
+#include <Arduino.h>
+#include <fcntl.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include "HostIO.h"
+#include "../../src/Utils/SerialCommandParser.h"
+
+#undef min
+#undef max
+
+// 非阻塞读取标准输入，写入先缓存，每个循环结束时一次写出（相当于 UART 发送缓冲）
+class PipeSerial : public Stream {
+public:
+    PipeSerial() : m_inLen(0), m_inPos(0), m_outLen(0), m_closed(false) {
+        fcntl(0, F_SETFL, fcntl(0, F_GETFL) | O_NONBLOCK);
+    }
+
+    int available() override {
+        if (m_inPos == m_inLen && !m_closed) {
+            ssize_t n = ::read(0, m_in, sizeof(m_in));
+            if (n == 0) {
+                m_closed = true;
+            }
+            m_inLen = n > 0 ? (size_t)n : 0;
+            m_inPos = 0;
+        }
+        return (int)(m_inLen - m_inPos);
+    }
+    int read() override { return available() > 0 ? m_in[m_inPos++] : -1; }
+    int peek() override { return available() > 0 ? m_in[m_inPos] : -1; }
+
+    size_t write(uint8_t b) override {
+        if (m_outLen == sizeof(m_out)) {
+            flush();
+        }
+        m_out[m_outLen++] = b;
+        return 1;
+    }
+    using Print::write;
+
+    void flush() {
+        size_t done = 0;
+        while (done < m_outLen) {
+            ssize_t n = ::write(1, m_out + done, m_outLen - done);
+            if (n <= 0) {
+                break;
+            }
+            done += (size_t)n;
+        }
+        m_outLen = 0;
+    }
+
+    bool isClosed() const { return m_closed; }
+
+private:
+    uint8_t m_in[256];
+    size_t m_inLen;
+    size_t m_inPos;
+    uint8_t m_out[256];
+    size_t m_outLen;
+    bool m_closed;
+};
+
+static unsigned long long monotonicMicros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static void syncClock() {
+    HostIO::setTimeMicros(monotonicMicros());
+}
+
+// 与 SimpleStateMachine::handleCommand() 中可直接识别的命令一致
+static bool isKnownCommand(const char* command) {
+    static const char* const KNOWN[] = { "START", "S", "STOP", "Q", "RESET", "R", "PING",
+                                         "STATS", "STATS RESET", "TEL ON", "TEL OFF" };
+    for (size_t i = 0; i < sizeof(KNOWN) / sizeof(KNOWN[0]); i++) {
+        if (strcasecmp(command, KNOWN[i]) == 0) {
+            return true;
+        }
+    }
+    return strncasecmp(command, "ARM ", 4) == 0 || strncasecmp(command, "MISSION ", 8) == 0 ||
+           strncasecmp(command, "CAL", 3) == 0;
+}
+
+int main(int argc, char** argv) {
+    unsigned long loopUs = 2000;
+    unsigned long actUs = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--loop-us") == 0 && i + 1 < argc) {
+            loopUs = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--act-us") == 0 && i + 1 < argc) {
+            actUs = strtoul(argv[++i], nullptr, 10);
+        } else {
+            fprintf(stderr, "用法: %s [--loop-us N] [--act-us N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    PipeSerial serial;
+    SerialCommandParser parser(serial);
+
+    while (!serial.isClosed()) {
+        syncClock();
+        SerialEventType event;
+        while ((event = parser.poll()) != SERIAL_EVENT_NONE) {
+            if (event == SERIAL_EVENT_COLOR) {
+                parser.acknowledge(true);
+            } else if (event == SERIAL_EVENT_COMMAND) {
+                bool handled = isKnownCommand(parser.getCommand());
+                if (handled && actUs > 0) {
+                    usleep(actUs);
+                }
+                syncClock();
+                parser.acknowledge(handled, "rejected");
+            } else {
+                parser.acknowledge(false, "invalid");
+            }
+            syncClock();
+        }
+        serial.flush();
+        if (loopUs > 0) {
+            usleep(loopUs);
+        }
+    }
+    return 0;
+}
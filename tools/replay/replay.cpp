@@ -0,0 +1,319 @@
+/**
+ * 导航轨迹回放
+ *
+ * 读取固件输出的轨迹文件（见src/Utils/TraceRecorder.h），把每帧的红外字节和
+ * 超声波脉宽送入真实的LineFollower / LineDetector / NavigationController代码，
+ * 按记录的事件重建状态机对导航控制器的调用，逐帧比较导航状态、路口判定和
+ * 电机指令，并统计每帧处理耗时。
+ *
+ * 用法: replay <trace.bin> [-v] [-o replayed.bin] [-n 最多打印的差异数]
+ * 返回值: 0 无差异，1 存在差异，2 参数或文件错误
+ */
+
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+#include "HostIO.h"
+#include "../../src/Sensor/SensorManager.h"
+#include "../../src/Motor/MotionController.h"
+#include "../../src/Control/LineFollower.h"
+#include "../../src/Control/NavigationController.h"
+#include "../../src/Utils/Logger.h"
+#include "../../src/Utils/TraceRecorder.h"
+
+// Arduino的min/max宏与std::min/std::max冲突
+#undef min
+#undef max
+
+struct TraceRecord {
+    uint8_t type;
+    TraceFrame frame;
+    TraceEvent event;
+};
+
+static const char* const NAV_STATE_NAMES[] = {
+    "STOPPED", "FOLLOWING_LINE", "POTENTIAL_JUNCTION", "MOVING_TO_STOP",
+    "STOPPED_FOR_CHECK", "AT_JUNCTION", "AVOIDING_RIGHT", "AVOIDING_FORWARD",
+    "AVOIDING_LEFT", "AVOIDING_LEFT_FIRST", "AVOIDING_FORWARD_REVERSE",
+    "AVOIDING_RIGHT_FINDLINE", "VERIFYING_ALL_WHITE", "ERROR"
+};
+
+static const char* const JUNCTION_NAMES[] = {
+    "NO_JUNCTION", "T_LEFT", "T_RIGHT", "T_FORWARD", "CROSS",
+    "LEFT_TURN", "RIGHT_TURN", "END_OF_LINE"
+};
+
+static const char* navStateName(uint8_t state) {
+    return state < sizeof(NAV_STATE_NAMES) / sizeof(NAV_STATE_NAMES[0]) ? NAV_STATE_NAMES[state] : "?";
+}
+
+static const char* junctionName(uint8_t junction) {
+    return junction < sizeof(JUNCTION_NAMES) / sizeof(JUNCTION_NAMES[0]) ? JUNCTION_NAMES[junction] : "?";
+}
+
+// 回放输出：日志按需打印，轨迹记录收集后与原始帧比较
+static bool s_verbose = false;
+static std::vector<uint8_t> s_output;
+static size_t s_outputParsed = 0;
+
+static void logSink(const uint8_t* data, size_t size) {
+    if (s_verbose) {
+        fwrite(data, 1, size, stdout);
+    }
+}
+
+static void traceSink(const uint8_t* data, size_t size) {
+    s_output.insert(s_output.end(), data, data + size);
+}
+
+static bool loadTrace(const char* path, std::vector<TraceRecord>& records, unsigned long& errors) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    TraceParser parser;
+    int c;
+    while ((c = fgetc(file)) != EOF) {
+        if (!parser.feed((uint8_t)c)) {
+            continue;
+        }
+        TraceRecord record;
+        memset(&record, 0, sizeof(record));
+        record.type = parser.getType();
+        bool ok = false;
+        if (record.type == TRACE_RECORD_FRAME) {
+            ok = TraceRecorder::decodeFrame(parser.getPayload(), parser.getLength(), record.frame);
+        } else if (record.type == TRACE_RECORD_EVENT) {
+            ok = TraceRecorder::decodeEvent(parser.getPayload(), parser.getLength(), record.event);
+        }
+        if (ok) {
+            records.push_back(record);
+        }
+    }
+    fclose(file);
+    errors = parser.getErrorCount();
+    return true;
+}
+
+// 取出回放新产生的最后一帧
+static bool takeReplayedFrame(TraceFrame& frame) {
+    static TraceParser parser;
+    bool found = false;
+    for (; s_outputParsed < s_output.size(); s_outputParsed++) {
+        if (parser.feed(s_output[s_outputParsed]) && parser.getType() == TRACE_RECORD_FRAME) {
+            found = TraceRecorder::decodeFrame(parser.getPayload(), parser.getLength(), frame) || found;
+        }
+    }
+    return found;
+}
+
+static void applyEvent(const TraceEvent& ev, NavigationController& nav) {
+    switch (ev.type) {
+        case TRACE_EVENT_NAV_INIT:
+            nav.init();
+            break;
+        case TRACE_EVENT_NAV_RESUME:
+            nav.resumeFollowing();
+            break;
+        case TRACE_EVENT_NAV_STOP:
+            nav.stop();
+            break;
+        case TRACE_EVENT_NAV_EXPECT:
+            nav.setExpectedJunction((JunctionType)ev.a);
+            break;
+        case TRACE_EVENT_NAV_SPEED:
+            nav.setBaseSpeed(ev.a);
+            break;
+        case TRACE_EVENT_NAV_AVOID:
+            nav.setObstacleAvoidanceEnabled(ev.a != 0);
+            nav.setObstacleAvoidanceReverse(ev.b != 0);
+            break;
+        case TRACE_EVENT_SYSTEM_STATE:
+            if (s_verbose) {
+                printf("[%lu] 系统状态 %u -> %u\n", (unsigned long)ev.timeMs, ev.a, ev.b);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static bool motorDiffers(const TraceFrame& a, const TraceFrame& b) {
+    // 允许±1的量化误差（AVR与主机浮点舍入可能不同）
+    return abs(a.vx - b.vx) > 1 || abs(a.vy - b.vy) > 1 ||
+           abs(a.omega - b.omega) > 1 || abs(a.speed - b.speed) > 1;
+}
+
+static void printUsage() {
+    fprintf(stderr, "用法: replay <trace.bin> [-v] [-o replayed.bin] [-n 最多打印的差异数]\n");
+}
+
+int main(int argc, char** argv) {
+    const char* inputPath = nullptr;
+    const char* outputPath = nullptr;
+    long maxDiffLines = 20;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) {
+            s_verbose = true;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            maxDiffLines = atol(argv[++i]);
+        } else if (!inputPath && argv[i][0] != '-') {
+            inputPath = argv[i];
+        } else {
+            printUsage();
+            return 2;
+        }
+    }
+    if (!inputPath) {
+        printUsage();
+        return 2;
+    }
+
+    std::vector<TraceRecord> records;
+    unsigned long parseErrors = 0;
+    if (!loadTrace(inputPath, records, parseErrors)) {
+        fprintf(stderr, "无法打开轨迹文件: %s\n", inputPath);
+        return 2;
+    }
+
+    // 首帧的红外字节用于初始化时的读数
+    for (size_t i = 0; i < records.size(); i++) {
+        if (records[i].type == TRACE_RECORD_FRAME) {
+            HostIO::setInfrared(records[i].frame.infrared);
+            HostIO::setTime(records[i].frame.timeMs);
+            break;
+        }
+    }
+
+    Serial.setSink(logSink);
+    Serial1.setSink(traceSink);
+    Logger::init();
+    Logger::setGlobalLogLevel(s_verbose ? LOG_LEVEL_DEBUG : LOG_LEVEL_ERROR);
+
+    SensorManager sensorManager;
+    MotionController motionController;
+    LineFollower lineFollower(sensorManager);
+    NavigationController navigation(sensorManager, motionController, lineFollower);
+
+    sensorManager.initAllSensors();
+    motionController.init();
+    TraceRecorder::begin(&Serial1);
+
+    unsigned long frames = 0;
+    unsigned long events = 0;
+    unsigned long stateDiffs = 0;
+    unsigned long junctionDiffs = 0;
+    unsigned long motorDiffs = 0;
+    long printed = 0;
+    std::vector<double> hostCostUs;
+    unsigned long long deviceCostSum = 0;
+    unsigned long deviceCostMax = 0;
+    std::vector<uint8_t> recordedJunctions;
+    std::vector<uint8_t> replayedJunctions;
+    uint8_t lastRecordedState = NAV_STOPPED;
+    uint8_t lastReplayedState = NAV_STOPPED;
+
+    for (size_t i = 0; i < records.size(); i++) {
+        const TraceRecord& record = records[i];
+        if (record.type == TRACE_RECORD_EVENT) {
+            HostIO::setTime(record.event.timeMs);
+            applyEvent(record.event, navigation);
+            events++;
+            continue;
+        }
+
+        const TraceFrame& recorded = record.frame;
+        HostIO::setInfrared(recorded.infrared);
+        HostIO::setPulse(recorded.pulseUs);
+        sensorManager.updateAll();
+        // 红外读取中的延时不计入：导航周期从记录的时间戳开始
+        HostIO::setTime(recorded.timeMs);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        navigation.update();
+        std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+        hostCostUs.push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+        deviceCostSum += recorded.costUs;
+        deviceCostMax = std::max(deviceCostMax, (unsigned long)recorded.costUs);
+        frames++;
+
+        TraceFrame replayed;
+        if (!takeReplayedFrame(replayed)) {
+            fprintf(stderr, "回放未产生轨迹帧（是否以ENABLE_TRACE=1编译？）\n");
+            return 2;
+        }
+
+        // 进入AT_JUNCTION即为一次路口判定
+        if (recorded.navState == NAV_AT_JUNCTION && lastRecordedState != NAV_AT_JUNCTION) {
+            recordedJunctions.push_back(recorded.junction);
+        }
+        if (replayed.navState == NAV_AT_JUNCTION && lastReplayedState != NAV_AT_JUNCTION) {
+            replayedJunctions.push_back(replayed.junction);
+        }
+        lastRecordedState = recorded.navState;
+        lastReplayedState = replayed.navState;
+
+        bool stateDiff = recorded.navState != replayed.navState;
+        bool junctionDiff = recorded.junction != replayed.junction;
+        bool motorDiff = motorDiffers(recorded, replayed);
+        stateDiffs += stateDiff;
+        junctionDiffs += junctionDiff;
+        motorDiffs += motorDiff;
+
+        if ((stateDiff || junctionDiff || motorDiff) && printed < maxDiffLines) {
+            printed++;
+            printf("帧%lu t=%lums IR=0x%02X 脉宽=%uus\n", frames, (unsigned long)recorded.timeMs,
+                   recorded.infrared, recorded.pulseUs);
+            printf("  记录: %-24s %-12s 电机(%d,%d,%d)@%u\n", navStateName(recorded.navState),
+                   junctionName(recorded.junction), recorded.vx, recorded.vy, recorded.omega, recorded.speed);
+            printf("  回放: %-24s %-12s 电机(%d,%d,%d)@%u\n", navStateName(replayed.navState),
+                   junctionName(replayed.junction), replayed.vx, replayed.vy, replayed.omega, replayed.speed);
+        }
+    }
+
+    if (outputPath) {
+        FILE* out = fopen(outputPath, "wb");
+        if (!out) {
+            fprintf(stderr, "无法写入: %s\n", outputPath);
+            return 2;
+        }
+        fwrite(s_output.data(), 1, s_output.size(), out);
+        fclose(out);
+    }
+
+    printf("\n== 回放结果: %s ==\n", inputPath);
+    printf("帧数 %lu，事件 %lu，校验错误 %lu\n", frames, events, parseErrors);
+    printf("导航状态差异 %lu 帧，路口类型差异 %lu 帧，电机指令差异 %lu 帧\n",
+           stateDiffs, junctionDiffs, motorDiffs);
+
+    printf("路口判定（记录 -> 回放）:\n");
+    size_t decisions = std::max(recordedJunctions.size(), replayedJunctions.size());
+    unsigned long decisionDiffs = 0;
+    for (size_t i = 0; i < decisions; i++) {
+        const char* a = i < recordedJunctions.size() ? junctionName(recordedJunctions[i]) : "-";
+        const char* b = i < replayedJunctions.size() ? junctionName(replayedJunctions[i]) : "-";
+        bool same = strcmp(a, b) == 0;
+        decisionDiffs += !same;
+        printf("  #%-3lu %-12s -> %-12s%s\n", (unsigned long)i + 1, a, b, same ? "" : "  *");
+    }
+
+    if (!hostCostUs.empty()) {
+        std::vector<double> sorted(hostCostUs);
+        std::sort(sorted.begin(), sorted.end());
+        double sum = 0;
+        for (size_t i = 0; i < sorted.size(); i++) {
+            sum += sorted[i];
+        }
+        printf("主机每帧耗时 (us): 平均 %.2f，P50 %.2f，P99 %.2f，最大 %.2f\n",
+               sum / sorted.size(), sorted[sorted.size() / 2],
+               sorted[(sorted.size() * 99) / 100], sorted.back());
+        printf("实车每帧耗时 (us，含阻塞延时): 平均 %.0f，最大 %lu\n",
+               (double)deviceCostSum / frames, deviceCostMax);
+    }
+
+    return (stateDiffs || junctionDiffs || motorDiffs || decisionDiffs) ? 1 : 0;
+}
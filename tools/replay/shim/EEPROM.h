@@ -0,0 +1,38 @@
+#ifndef REPLAY_EEPROM_H
+#define REPLAY_EEPROM_H
+
+// 主机端EEPROM：进程内的4KB内存，初始为擦除状态(0xFF)，不保存到文件
+// 与AVR库一样每个翻译单元一个EEPROM对象，存储区共用
+
+#include <stdint.h>
+#include <string.h>
+
+class EEPROMClass {
+public:
+    uint8_t read(int address) const { return inRange(address) ? storage()[address] : 0xFF; }
+    void write(int address, uint8_t value) {
+        if (inRange(address)) {
+            storage()[address] = value;
+        }
+    }
+    void update(int address, uint8_t value) { write(address, value); }
+    uint16_t length() const { return SIZE; }
+
+private:
+    static const int SIZE = 4096;
+
+    static uint8_t* storage() {
+        static uint8_t data[SIZE];
+        static bool erased = false;
+        if (!erased) {
+            memset(data, 0xFF, sizeof(data));
+            erased = true;
+        }
+        return data;
+    }
+    static bool inRange(int address) { return address >= 0 && address < SIZE; }
+};
+
+static EEPROMClass EEPROM;
+
+#endif // REPLAY_EEPROM_H
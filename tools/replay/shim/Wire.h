@@ -0,0 +1,42 @@
+#ifndef REPLAY_WIRE_H
+#define REPLAY_WIRE_H
+
+// 主机端I2C：只有红外阵列应答，读回轨迹中当前帧的红外字节
+
+#include <Arduino.h>
+
+// 与AVR core一致，I2CBus要求Wire支持超时
+#define WIRE_HAS_TIMEOUT
+
+class TwoWire : public Stream {
+public:
+    TwoWire() : m_address(0), m_pending(0) {}
+
+    void begin() {}
+    void end() {}
+    void setClock(uint32_t) {}
+    void setWireTimeout(uint32_t, bool) {}
+    bool getWireTimeoutFlag() { return false; }
+    void clearWireTimeoutFlag() {}
+
+    void beginTransmission(uint8_t address) { m_address = address; }
+    void beginTransmission(int address) { beginTransmission((uint8_t)address); }
+    uint8_t endTransmission(bool sendStop = true);
+
+    uint8_t requestFrom(uint8_t address, uint8_t quantity, uint8_t sendStop = 1);
+    uint8_t requestFrom(int address, int quantity) { return requestFrom((uint8_t)address, (uint8_t)quantity); }
+
+    size_t write(uint8_t) override { return 1; }
+    using Print::write;
+    int available() override { return m_pending; }
+    int read() override;
+    int peek() override;
+
+private:
+    uint8_t m_address;
+    uint8_t m_pending;
+};
+
+extern TwoWire Wire;
+
+#endif // REPLAY_WIRE_H
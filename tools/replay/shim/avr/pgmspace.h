@@ -0,0 +1,31 @@
+#ifndef REPLAY_PGMSPACE_H
+#define REPLAY_PGMSPACE_H
+
+// 主机端没有独立的程序存储空间，PROGMEM数据按普通内存访问
+
+#include <string.h>
+#include <strings.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_float(addr) (*(const float*)(addr))
+#define pgm_read_ptr(addr)   (*(const void* const*)(addr))
+
+#define memcpy_P     memcpy
+#define strcmp_P     strcmp
+#define strncmp_P    strncmp
+#define strcasecmp_P strcasecmp
+#define strlen_P     strlen
+#define strcpy_P     strcpy
+#define strncpy_P    strncpy
+#define snprintf_P   snprintf
+#define vsnprintf_P  vsnprintf
+
+#endif // REPLAY_PGMSPACE_H
@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+"""
+导航轨迹采集工具
+
+从串口读取固件输出（ENABLE_TRACE=1），把二进制轨迹记录写入文件，
+其余内容（文本日志）照常打印到终端。记录格式见 src/Utils/TraceRecorder.h。
+
+采集:  python3 tools/trace_capture.py -p /dev/ttyUSB0 -o run1.bin [--log run1.log]
+查看:  python3 tools/trace_capture.py --dump run1.bin > run1.csv
+回放:  make -C tools/replay && tools/replay/replay run1.bin
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+SYNC = b"\xA5\x5A"
+MAX_PAYLOAD = 16
+
+RECORD_FRAME = 1
+RECORD_EVENT = 2
+
+FRAME_FORMAT = "<IBHbbbBBBBH"
+EVENT_FORMAT = "<IBBB"
+
+NAV_STATES = [
+    "STOPPED", "FOLLOWING_LINE", "POTENTIAL_JUNCTION", "MOVING_TO_STOP",
+    "STOPPED_FOR_CHECK", "AT_JUNCTION", "AVOIDING_RIGHT", "AVOIDING_FORWARD",
+    "AVOIDING_LEFT", "AVOIDING_LEFT_FIRST", "AVOIDING_FORWARD_REVERSE",
+    "AVOIDING_RIGHT_FINDLINE", "VERIFYING_ALL_WHITE", "ERROR",
+]
+
+JUNCTIONS = [
+    "NO_JUNCTION", "T_LEFT", "T_RIGHT", "T_FORWARD", "CROSS",
+    "LEFT_TURN", "RIGHT_TURN", "END_OF_LINE",
+]
+
+EVENTS = {
+    1: "NAV_INIT", 2: "NAV_RESUME", 3: "NAV_STOP", 4: "NAV_EXPECT",
+    5: "NAV_SPEED", 6: "NAV_AVOID", 7: "SYSTEM_STATE",
+}
+
+
+def checksum(data):
+    value = 0
+    for b in data:
+        value ^= b
+    return value
+
+
+class StreamSplitter:
+    """把串口字节流拆分为轨迹记录和文本"""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.errors = 0
+
+    def feed(self, data):
+        """返回 (记录列表[(类型, 原始字节)], 文本字节)"""
+        self.buffer.extend(data)
+        records = []
+        text = bytearray()
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                # 末尾的0xA5可能是下一个同步字的一半
+                keep = 1 if self.buffer.endswith(SYNC[:1]) else 0
+                text.extend(self.buffer[:len(self.buffer) - keep])
+                del self.buffer[:len(self.buffer) - keep]
+                break
+            text.extend(self.buffer[:start])
+            del self.buffer[:start]
+            if len(self.buffer) < 4:
+                break
+            length = self.buffer[3]
+            if length > MAX_PAYLOAD:
+                self.errors += 1
+                text.extend(self.buffer[:1])
+                del self.buffer[:1]
+                continue
+            total = length + 5
+            if len(self.buffer) < total:
+                break
+            raw = bytes(self.buffer[:total])
+            if checksum(raw[2:-1]) != raw[-1]:
+                self.errors += 1
+                text.extend(self.buffer[:1])
+                del self.buffer[:1]
+                continue
+            records.append((raw[2], raw))
+            del self.buffer[:total]
+        return records, bytes(text)
+
+
+def decode(record_type, raw):
+    payload = raw[4:-1]
+    if record_type == RECORD_FRAME and len(payload) == struct.calcsize(FRAME_FORMAT):
+        return struct.unpack(FRAME_FORMAT, payload)
+    if record_type == RECORD_EVENT and len(payload) == struct.calcsize(EVENT_FORMAT):
+        return struct.unpack(EVENT_FORMAT, payload)
+    return None
+
+
+def name(table, index):
+    return table[index] if index < len(table) else str(index)
+
+
+def dump(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    splitter = StreamSplitter()
+    records, _ = splitter.feed(data)
+    print("kind,time_ms,ir,pulse_us,vx,vy,omega,speed,nav_state,junction,flags,cost_us,event,a,b")
+    for record_type, raw in records:
+        fields = decode(record_type, raw)
+        if fields is None:
+            continue
+        if record_type == RECORD_FRAME:
+            t, ir, pulse, vx, vy, omega, speed, nav, junction, flags, cost = fields
+            print("frame,%d,0x%02X,%d,%d,%d,%d,%d,%s,%s,%d,%d,,," % (
+                t, ir, pulse, vx, vy, omega, speed,
+                name(NAV_STATES, nav), name(JUNCTIONS, junction), flags, cost))
+        else:
+            t, kind, a, b = fields
+            print("event,%d,,,,,,,,,,,%s,%d,%d" % (t, EVENTS.get(kind, str(kind)), a, b))
+    if splitter.errors:
+        print("校验错误: %d" % splitter.errors, file=sys.stderr)
+
+
+def capture(args):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("需要pyserial: pip install pyserial")
+
+    port = serial.Serial(args.port, args.baud, timeout=0.1)
+    splitter = StreamSplitter()
+    frames = 0
+    events = 0
+    started = time.time()
+    log = open(args.log, "wb") if args.log else None
+    print("采集中: %s @ %d -> %s (Ctrl+C结束)" % (args.port, args.baud, args.output), file=sys.stderr)
+    try:
+        with open(args.output, "wb") as out:
+            while True:
+                data = port.read(4096)
+                if not data:
+                    continue
+                records, text = splitter.feed(data)
+                for record_type, raw in records:
+                    out.write(raw)
+                    if record_type == RECORD_FRAME:
+                        frames += 1
+                    else:
+                        events += 1
+                if text:
+                    sys.stdout.buffer.write(text)
+                    sys.stdout.flush()
+                    if log:
+                        log.write(text)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        port.close()
+        if log:
+            log.close()
+    elapsed = max(time.time() - started, 1e-3)
+    print("\n帧 %d（%.1f 帧/秒），事件 %d，校验错误 %d" % (
+        frames, frames / elapsed, events, splitter.errors), file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="采集或查看导航轨迹")
+    parser.add_argument("-p", "--port", help="串口，例如 /dev/ttyUSB0 或 COM3")
+    parser.add_argument("-b", "--baud", type=int, default=115200, help="波特率（默认115200）")
+    parser.add_argument("-o", "--output", default="trace.bin", help="轨迹文件（默认trace.bin）")
+    parser.add_argument("--log", help="同时保存文本日志")
+    parser.add_argument("--dump", metavar="TRACE", help="把轨迹文件解码为CSV输出")
+    args = parser.parse_args()
+
+    if args.dump:
+        dump(args.dump)
+    elif args.port:
+        capture(args)
+    else:
+        parser.error("需要 --port 或 --dump")
+
+
+if __name__ == "__main__":
+    main()